@@ -126,6 +126,9 @@ endif()
 
 option(TEST_WITH_VALGRIND "Set to ON to enable valgrind tests" OFF)
 
+# the per-function passes of Code Listener run on a pool of threads
+find_package(Threads REQUIRED)
+
 # link PLUGIN_NAME with Code Listener build located in LIBCL_PATH
 macro(CL_LINK_GCC_PLUGIN PLUGIN_NAME LIBCL_PATH)
     if("${LIBCL_PATH}" STREQUAL "")
@@ -137,7 +140,8 @@ macro(CL_LINK_GCC_PLUGIN PLUGIN_NAME LIBCL_PATH)
     endif()
 
     # link the Code Listener static library
-    target_link_libraries(${PLUGIN_NAME} ${CLGCC_LIB} ${CL_LIB})
+    target_link_libraries(${PLUGIN_NAME} ${CLGCC_LIB} ${CL_LIB}
+        ${CMAKE_THREAD_LIBS_INIT})
 
     # this will recursively pull all needed symbols from the static libraries
     set_target_properties(${PLUGIN_NAME} PROPERTIES LINK_FLAGS -Wl,--entry=plugin_init)
@@ -156,3 +160,20 @@ macro(CL_BUILD_GCC_PLUGIN PLUGIN ANALYZER LIBCL_PATH)
     CL_LINK_GCC_PLUGIN(${PLUGIN} ${LIBCL_PATH})
     target_link_libraries(${PLUGIN} ${ANALYZER})
 endmacro()
+
+# build DRIVER running ANALYZER on storage files (see cl/cl_run.cc), without GCC
+macro(CL_BUILD_STORAGE_DRIVER DRIVER ANALYZER LIBCL_PATH)
+    if("${LIBCL_PATH}" STREQUAL "")
+        set(CL_LIB cl)
+        set(CLRUN_LIB clrun)
+    else()
+        find_library(CL_LIB cl PATHS ${LIBCL_PATH} NO_DEFAULT_PATH)
+        find_library(CLRUN_LIB clrun PATHS ${LIBCL_PATH} NO_DEFAULT_PATH)
+    endif()
+
+    # main() is pulled from libclrun.a, clEasyRun() from the analyzer
+    add_executable(${DRIVER} ${EMPTY_C_FILE})
+    set_target_properties(${DRIVER} PROPERTIES LINKER_LANGUAGE CXX)
+    target_link_libraries(${DRIVER} ${CLRUN_LIB} ${ANALYZER} ${CL_LIB}
+        ${CMAKE_THREAD_LIBS_INIT})
+endmacro()
@@ -31,6 +31,7 @@
 #include "loopscan.hh"
 #include "pointsto.hh"
 #include "stopwatch.hh"
+#include "storage_bin.hh"
 
 #include <string>
 
@@ -42,10 +43,40 @@
 #   define CL_PRINT_TIME(watch) _CL_PRINT_TIME(CL_DEBUG, watch)
 #endif
 
+namespace {
+    /// run the passes the analyzers rely on, return false for empty input
+    bool prepareStorage(CodeStorage::Storage &stor, const std::string &conf) {
+        if (!stor.fncs.size() && !stor.vars.size()) {
+            // avoid confusing the ccache wrapper when called on empty input
+            CL_DEBUG("CodeStorage::Storage appears empty, giving up...");
+            return false;
+        }
+
+        CL_DEBUG("building call-graph...");
+        CodeStorage::CallGraph::buildCallGraph(stor);
+        printMemUsage("buildCallGraph");
+
+        CL_DEBUG("scanning CFG for loop-closing edges...");
+        findLoopClosingEdges(stor);
+        printMemUsage("findLoopClosingEdges");
+
+        CL_DEBUG("perform points-to analysis...");
+        pointsToAnalyse(stor, conf);
+        printMemUsage("pointsToAnalyse");
+
+        CL_DEBUG("killing local variables...");
+        killLocalVariables(stor);
+        printMemUsage("killLocalVariables");
+
+        return true;
+    }
+}
+
 class ClEasy: public ClStorageBuilder {
     public:
-        ClEasy(const char *configString):
-            configString_(configString)
+        ClEasy(const char *configString, const char *storageFile = ""):
+            configString_(configString),
+            storageFile_(storageFile)
         {
             CL_DEBUG("ClEasy initialized: \"" << configString << "\"");
             printMemUsage("ClEasy::ClEasy");
@@ -55,27 +86,13 @@ class ClEasy: public ClStorageBuilder {
         virtual void run(CodeStorage::Storage &stor) {
             printMemUsage("buildStorage");
 
-            if (!stor.fncs.size() && !stor.vars.size()) {
-                // avoid confusing the ccache wrapper when called on empty input
-                CL_DEBUG("CodeStorage::Storage appears empty, giving up...");
+            if (!prepareStorage(stor, configString_))
                 return;
-            }
-
-            CL_DEBUG("building call-graph...");
-            CodeStorage::CallGraph::buildCallGraph(stor);
-            printMemUsage("buildCallGraph");
-
-            CL_DEBUG("scanning CFG for loop-closing edges...");
-            findLoopClosingEdges(stor);
-            printMemUsage("findLoopClosingEdges");
-
-            CL_DEBUG("perform points-to analysis...");
-            pointsToAnalyse(stor, configString_);
-            printMemUsage("pointsToAnalyse");
 
-            CL_DEBUG("killing local variables...");
-            killLocalVariables(stor);
-            printMemUsage("killLocalVariables");
+            if (!storageFile_.empty()) {
+                CL_DEBUG("ClEasy is writing " << storageFile_ << "...");
+                writeStorage(stor, storageFile_.c_str());
+            }
 
             CL_DEBUG("ClEasy is calling the analyzer...");
             StopWatch watch;
@@ -85,6 +102,29 @@ class ClEasy: public ClStorageBuilder {
 
     private:
         std::string configString_;
+        std::string storageFile_;
+};
+
+class ClStorageDump: public ClStorageBuilder {
+    public:
+        ClStorageDump(const char *fileName):
+            fileName_(fileName)
+        {
+            CL_DEBUG("ClStorageDump initialized: \"" << fileName << "\"");
+        }
+
+    protected:
+        virtual void run(CodeStorage::Storage &stor) {
+            // the storage is the same as the one given to clEasyRun()
+            if (!prepareStorage(stor, /* default points-to options */ ""))
+                return;
+
+            CL_DEBUG("ClStorageDump is writing " << fileName_ << "...");
+            writeStorage(stor, fileName_.c_str());
+        }
+
+    private:
+        std::string fileName_;
 };
 
 
@@ -94,3 +134,15 @@ ICodeListener* createClEasy(const char *configString)
 {
     return new ClEasy(configString);
 }
+
+ICodeListener* createClStorageDump(const char *fileName)
+{
+    return new ClStorageDump(fileName);
+}
+
+ICodeListener* createClEasyStorageDump(
+        const char                 *configString,
+        const char                 *fileName)
+{
+    return new ClEasy(configString, fileName);
+}
@@ -22,7 +22,9 @@
 
 /**
  * @file cl_easy.hh
- * constructor createClEasy() of the @b "easy" code listener
+ * constructor createClEasy() of the @b "easy" code listener (optionally
+ * dumping the storage, see createClEasyStorageDump()) and constructor
+ * createClStorageDump() of the @b "storage_dump" code listener
  */
 
 class ICodeListener;
@@ -32,4 +34,23 @@ class ICodeListener;
  */
 ICodeListener* createClEasy(const char *config_string);
 
+/**
+ * create a code listener that runs the same passes as the @b "easy" listener
+ * and writes the resulting CodeStorage::Storage object into a binary file
+ * instead of running the analyzer (see storage_bin.hh)
+ * @param file_name name of the file to be written
+ */
+ICodeListener* createClStorageDump(const char *file_name);
+
+/**
+ * create an @b "easy" code listener that also writes the CodeStorage::Storage
+ * object into a binary file before it runs the analyzer on it, so that the
+ * passes are run only once for both of them (see storage_bin.hh)
+ * @param config_string the config string given to the analyzer
+ * @param file_name name of the file to be written
+ */
+ICodeListener* createClEasyStorageDump(
+        const char                 *config_string,
+        const char                 *file_name);
+
 #endif /* H_GUARD_CL_EASY_H */
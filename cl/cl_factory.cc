@@ -31,6 +31,7 @@
 #include "clf_intchk.hh"
 #include "clf_unilabel.hh"
 #include "clf_unswitch.hh"
+#include "fncpass.hh"
 
 #include "util.hh"
 
@@ -300,6 +301,7 @@ ClFactory::ClFactory():
     d->map["locator"]       = &createClLocator;
     d->map["pp"]            = &createClPrettyPrintDef;
     d->map["pp_with_types"] = &createClPrettyPrintWithTypes;
+    d->map["storage_dump"]  = &createClStorageDump;
     d->map["typedot"]       = &createClTypeDotGenerator;
 }
 
@@ -335,7 +337,36 @@ ICodeListener* ClFactory::create(const char *config_string)
     CL_FACTORY_DEBUG("ClFactory: creating listener '" << name << "' "
              "with args '" << listenerArgs << "'");
 
-    ICodeListener *cl = (i->second)(listenerArgs.c_str());
+    if (hasKey(args, "threads") && !args["threads"].empty()) {
+        if (name != "easy") {
+            CL_ERROR("threads= option given to listener: " << name);
+            return 0;
+        }
+
+        const string &threads = args["threads"];
+        if (string::npos != threads.find_first_not_of("0123456789")) {
+            CL_ERROR("invalid threads= option: " << threads);
+            return 0;
+        }
+
+        // the number of threads of the per-function passes, 0 for all cores
+        CodeStorage::setFncPassThreads(atoi(threads.c_str()));
+    }
+
+    ICodeListener *cl;
+    if (hasKey(args, "storage_file")) {
+        if (name != "easy") {
+            CL_ERROR("storage_file= option given to listener: " << name);
+            return 0;
+        }
+
+        // the listener writes the storage it runs the analyzer on
+        cl = createClEasyStorageDump(listenerArgs.c_str(),
+                                     args["storage_file"].c_str());
+    }
+    else
+        cl = (i->second)(listenerArgs.c_str());
+
     if (!cl)
         return 0;
 
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file cl_run.cc
+ * a driver running an analyzer on a storage file written by the GCC plug-in
+ * (see -fplugin-arg-...-dump-storage), without any need to compile the code
+ * again.  The driver is linked with an analyzer (its clEasyRun() function) by
+ * the CL_BUILD_STORAGE_DRIVER() macro of build-aux/common.cmake.
+ */
+
+#include "config_cl.h"
+
+#include <cl/cl_msg.hh>
+#include <cl/code_listener.h>
+#include <cl/easy.hh>
+
+#include "stopwatch.hh"
+#include "storage_bin.hh"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+    const char *appName;
+    bool preserveEc;
+    int cntErrors;
+
+    void dummyPrinter(const char *msg)
+    {
+        (void) msg;
+    }
+
+    void trivialPrinter(const char *msg)
+    {
+        fprintf(stderr, "%s [%s]\n", msg, appName);
+    }
+
+    void errorPrinter(const char *msg)
+    {
+        trivialPrinter(msg);
+        ++cntErrors;
+    }
+
+    void diePrinter(const char *msg)
+    {
+        trivialPrinter(msg);
+        exit(EXIT_FAILURE);
+    }
+
+    int usage(const char *name)
+    {
+        fprintf(stderr, "Usage: %s [OPTIONS] STORAGE_FILE\n"
+                "\n"
+                "OPTIONS:\n"
+                "    --args=PEER_ARGS                 args given to analyzer\n"
+                "    --preserve-ec                    do not affect exit code\n"
+                "    --verbose[=VERBOSITY_LEVEL]      turn on verbose mode\n",
+                name);
+
+        return EXIT_FAILURE;
+    }
+
+    /// return the value of the given option (if matched), NULL otherwise
+    const char* matchOpt(const char *arg, const char *opt)
+    {
+        const size_t len = strlen(opt);
+        if (strncmp(arg, opt, len))
+            return 0;
+
+        if ('=' == arg[len])
+            return arg + len + 1;
+
+        return (arg[len])
+            ? 0
+            : arg + len;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    appName = argv[0];
+
+    const char *analyzerArgs = "";
+    const char *fileName = 0;
+    int verbose = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value;
+
+        if ((value = matchOpt(arg, "--args")))
+            analyzerArgs = value;
+        else if ((value = matchOpt(arg, "--verbose")))
+            verbose = (*value)
+                ? atoi(value)
+                : 1;
+        else if (!strcmp(arg, "--preserve-ec"))
+            preserveEc = true;
+        else if ('-' != *arg && !fileName)
+            fileName = arg;
+        else
+            return usage(argv[0]);
+    }
+
+    if (!fileName)
+        return usage(argv[0]);
+
+    struct cl_init_data init = {
+        /* .debug       */ dummyPrinter,
+        /* .warn        */ trivialPrinter,
+        /* .error       */ errorPrinter,
+        /* .note        */ trivialPrinter,
+        /* .die         */ diePrinter,
+        /* .debug_level */ verbose
+    };
+
+    if (verbose)
+        init.debug = trivialPrinter;
+
+    cl_global_init(&init);
+
+    int ec = EXIT_FAILURE;
+    {
+        CodeStorage::StorageImage image;
+        if (image.load(fileName)) {
+            CL_DEBUG("cl_run is calling the analyzer...");
+            StopWatch watch;
+            clEasyRun(image.stor(), analyzerArgs);
+            CL_DEBUG("clEasyRun() took " << watch);
+
+            ec = (cntErrors && !preserveEc)
+                ? EXIT_FAILURE
+                : EXIT_SUCCESS;
+        }
+    }
+
+    cl_global_cleanup();
+    return ec;
+}
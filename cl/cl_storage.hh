@@ -32,6 +32,9 @@ namespace CodeStorage {
     struct Insn;
 
     void destroyInsn(Insn *insn);
+
+    /// destroy all functions of the given Storage object (including their CFGs)
+    void releaseStorage(Storage &stor);
 }
 
 /**
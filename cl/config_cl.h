@@ -87,6 +87,15 @@
  */
 #define CL_EASY_TIMER                   1
 
+/**
+ * default number of threads running the per-function passes of the "easy"
+ * listener (loop scan, variable killer), the threads= option of the listener
+ * (-fplugin-arg-...-threads=N) overrides it
+ * - 0 ... as many threads as the hardware supports
+ * - 1 ... run the passes serially
+ */
+#define CL_EASY_THREADS                 0
+
 /**
  * if 1, filter out repeated error/warning messages (sort of 2>&1 | uniq)
  */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config_cl.h"
+#include "fncpass.hh"
+
+#include <cl/cl_msg.hh>
+#include <cl/code_listener.h>
+#include <cl/storage.hh>
+
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <boost/foreach.hpp>
+
+namespace CodeStorage {
+
+namespace {
+    unsigned fncPassThreads = CL_EASY_THREADS;
+
+    unsigned cntThreads(const unsigned cntFncs) {
+        unsigned cnt = fncPassThreads;
+        if (!cnt)
+            // as many as the hardware supports (0 if not known)
+            cnt = std::thread::hardware_concurrency();
+
+        if (cl_debug_level())
+            // keep the debug output of the passes in order
+            cnt = 1;
+
+        return (cntFncs < cnt) ? cntFncs : cnt;
+    }
+
+    void runWorker(
+            const std::vector<Fnc *>   &fncs,
+            std::atomic<unsigned>      &next,
+            void                      (*pass)(Fnc &))
+    {
+        for (;;) {
+            const unsigned idx = next++;
+            if (fncs.size() <= idx)
+                return;
+
+            pass(*fncs[idx]);
+        }
+    }
+}
+
+void setFncPassThreads(unsigned cnt)
+{
+    fncPassThreads = cnt;
+}
+
+void runFncPass(Storage &stor, void (*pass)(Fnc &))
+{
+    std::vector<Fnc *> fncs;
+    BOOST_FOREACH(Fnc *pFnc, stor.fncs)
+        if (isDefined(*pFnc))
+            fncs.push_back(pFnc);
+
+    const unsigned cnt = cntThreads(fncs.size());
+    if (cnt <= 1) {
+        BOOST_FOREACH(Fnc *pFnc, fncs)
+            pass(*pFnc);
+
+        return;
+    }
+
+    // the functions are handed out one by one as their sizes vary a lot
+    std::atomic<unsigned> next(0);
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < cnt; ++i)
+        workers.push_back(std::thread(runWorker,
+                    std::cref(fncs), std::ref(next), pass));
+
+    // the current thread works as well
+    runWorker(fncs, next, pass);
+
+    BOOST_FOREACH(std::thread &worker, workers)
+        worker.join();
+}
+
+} // namespace CodeStorage
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef H_GUARD_FNCPASS_H
+#define H_GUARD_FNCPASS_H
+
+/**
+ * @file fncpass.hh
+ * runFncPass() - run a per-function pass on a pool of threads
+ */
+
+namespace CodeStorage {
+    struct Storage;
+    struct Fnc;
+
+    /**
+     * run the given pass on all @b defined functions of the given Storage
+     * object, on up to CL_EASY_THREADS threads (see config_cl.h)
+     * @param stor the Storage object the functions are taken from
+     * @param pass the pass to be run for each function; it may read the whole
+     * Storage object, but it may change only the given function (including the
+     * instructions of its CFG), such that the result does not depend on the
+     * order in which the functions are processed
+     * @note the functions are processed serially in the verbose mode, in order
+     * to keep the debug output of the passes readable
+     */
+    void runFncPass(Storage &stor, void (*pass)(Fnc &));
+
+    /**
+     * override the number of threads set by CL_EASY_THREADS (see config_cl.h)
+     * for the subsequent calls of runFncPass(), used for the threads= option
+     * of the "easy" listener
+     * @param cnt the number of threads, 0 for as many as the hardware supports
+     * @note not to be called while a pass is running
+     */
+    void setFncPassThreads(unsigned cnt);
+}
+
+#endif /* H_GUARD_FNCPASS_H */
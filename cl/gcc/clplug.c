@@ -159,10 +159,12 @@ static struct plugin_info cl_info = {
 "    -fplugin-arg-%s-args=PEER_ARGS                 args given to analyzer\n"
 "    -fplugin-arg-%s-dry-run                        do not run the analyzer\n"
 "    -fplugin-arg-%s-dump-pp[=OUTPUT_FILE]          dump linearized code\n"
+"    -fplugin-arg-%s-dump-storage=STORAGE_FILE      dump code for offline runs\n"
 "    -fplugin-arg-%s-dump-types                     dump also type info\n"
 "    -fplugin-arg-%s-gen-dot[=GLOBAL_CG_FILE]       generate CFGs\n"
 "    -fplugin-arg-%s-pid-file=FILE                  write PID of self to FILE\n"
 "    -fplugin-arg-%s-preserve-ec                    do not affect exit code\n"
+"    -fplugin-arg-%s-threads=N                      threads of the pre-analysis\n"
 "    -fplugin-arg-%s-type-dot=TYPE_GRAPH_FILE       generate type graphs\n"
 "    -fplugin-arg-%s-verbose[=VERBOSITY_LEVEL]      turn on verbose mode\n"
 };
@@ -211,7 +213,8 @@ static void init_plugin_name(const struct plugin_name_args *info)
     if (-1 == asprintf(&msg, cl_info.help, plugin_base_name,
                        name, name, name, name,
                        name, name, name, name,
-                       name, name, name, name))
+                       name, name, name, name,
+                       name, name))
         // OOM
         abort();
     else
@@ -1960,12 +1963,15 @@ struct cl_plug_options {
     bool                    use_dotgen;
     bool                    use_pp;
     bool                    use_analyzer;
+    bool                    use_storage_dump;
     bool                    use_typedot;
     const char              *gl_dot_file;
     const char              *pp_out_file;
+    const char              *storage_file;
     const char              *analyzer_args;
     const char              *type_dot_file;
     const char              *pid_file;
+    const char              *threads;
 };
 
 static int clplug_init(const struct plugin_name_args *info,
@@ -1975,6 +1981,7 @@ static int clplug_init(const struct plugin_name_args *info,
     memset(opt, 0, sizeof(*opt));
     opt->use_analyzer       = true;
     opt->analyzer_args      = "";
+    opt->threads            = "";
 
     // obtain arg list
     const int argc                      = info->argc;
@@ -2015,6 +2022,16 @@ static int clplug_init(const struct plugin_name_args *info,
             opt->use_pp         = true;
             opt->pp_out_file    = value;
         }
+        else if (STREQ(key, "dump-storage")) {
+            if (value) {
+                opt->use_storage_dump   = true;
+                opt->storage_file       = value;
+            }
+            else {
+                CL_ERROR("mandatory value omitted for dump-storage");
+                return EXIT_FAILURE;
+            }
+        }
         else if (STREQ(key, "dump-types")) {
             opt->dump_types     = true;
             // TODO: warn about ignoring extra value?
@@ -2037,6 +2054,14 @@ static int clplug_init(const struct plugin_name_args *info,
             }
 
         }
+        else if (STREQ(key, "threads")) {
+            if (value && *value && !value[strspn(value, "0123456789")])
+                opt->threads = value;
+            else {
+                CL_ERROR("a number of threads expected for threads");
+                return EXIT_FAILURE;
+            }
+        }
         else if (STREQ(key, "type-dot")) {
             if (value) {
                 opt->use_typedot    = true;
@@ -2131,9 +2156,32 @@ create_cl_chain(const struct cl_plug_options *opt)
                 opt->type_dot_file, opt))
         return NULL;
 
-    if (opt->use_analyzer
-            && !cl_append_def_listener(chain, "easy", opt->analyzer_args, opt))
-        return NULL;
+    if (opt->use_analyzer && opt->use_storage_dump) {
+        // a single listener dumps the storage and runs the analyzer on it so
+        // that the passes of the "easy" listener are not run twice
+        if (!cl_append_listener(chain,
+                    "listener=\"easy\" listener_args=\"%s\" "
+                    "storage_file=\"%s\" threads=\"%s\" "
+                    "clf=\"unfold_switch,unify_labels_gl\"",
+                    opt->analyzer_args, opt->storage_file, opt->threads))
+            return NULL;
+    }
+    else if (opt->use_analyzer) {
+        if (!cl_append_listener(chain,
+                    "listener=\"easy\" listener_args=\"%s\" "
+                    "threads=\"%s\" "
+                    "clf=\"unfold_switch,unify_labels_gl\"",
+                    opt->analyzer_args, opt->threads))
+            return NULL;
+    }
+    else if (opt->use_storage_dump) {
+        // the storage is dumped as the analyzer would see it, even on dry-run
+        if (!cl_append_listener(chain,
+                    "listener=\"storage_dump\" listener_args=\"%s\" "
+                    "clf=\"unfold_switch,unify_labels_gl\"",
+                    opt->storage_file))
+            return NULL;
+    }
 
     return chain;
 }
@@ -25,11 +25,13 @@
 #include <cl/clutil.hh>
 #include <cl/storage.hh>
 
+#include "fncpass.hh"
 #include "pointsto.hh"
 #include "builtins.hh"
 #include "stopwatch.hh"
 #include "util.hh"
 
+#include <atomic>
 #include <map>
 #include <set>
 
@@ -51,7 +53,7 @@ namespace CodeStorage {
 
 namespace VarKiller {
 
-typedef CodeStorage::Storage               &TStorRef;
+typedef const CodeStorage::Storage         &TStorRef;
 typedef const CodeStorage::PointsTo::Graph &TPTGraph;
 typedef const struct cl_loc                *TLoc;
 typedef int                                 TVar;
@@ -96,21 +98,17 @@ struct VarData {
  * with help of PointsTo analysis.
  */
 class PTStats {
-    static PTStats *inst;
-
     public:
-        int count;
-        int fullCount;
+        // updated by functions analyzed in parallel
+        std::atomic<int> count;
+        std::atomic<int> fullCount;
 
     public:
         static PTStats *getInstance() {
-            if (!inst)
-                inst = new PTStats();
-            return inst;
+            static PTStats inst;
+            return &inst;
         }
 
-
-
     private:
         // singleton
         PTStats() :
@@ -119,8 +117,6 @@ class PTStats {
         {
         }
 };
-// initialize
-PTStats *PTStats::inst = 0;
 
 void countPtStat(Data &data, int uid)
 {
@@ -638,15 +634,9 @@ void killLocalVariables(Storage &stor)
 {
     StopWatch watch;
 
-    // analyze all _defined_ functions
-    BOOST_FOREACH(Fnc *pFnc, stor.fncs) {
-        Fnc &fnc = *pFnc;
-        if (!isDefined(fnc))
-            continue;
-
-        // analyze a single function
-        VarKiller::analyzeFnc(fnc);
-    }
+    // analyze all _defined_ functions, each of them commits the kill lists
+    // only into its own instructions (no matter in which order they are done)
+    runFncPass(stor, VarKiller::analyzeFnc);
 
     VarKiller::PTStats *stats = VarKiller::PTStats::getInstance();
     if (stats->count > 0) {
@@ -23,6 +23,7 @@
 #include <cl/cl_msg.hh>
 #include <cl/storage.hh>
 
+#include "fncpass.hh"
 #include "util.hh"
 #include "stopwatch.hh"
 
@@ -147,15 +148,8 @@ void findLoopClosingEdges(Storage &stor)
 {
     StopWatch watch;
 
-    // go through all _defined_ functions
-    BOOST_FOREACH(Fnc *pFnc, stor.fncs) {
-        Fnc &fnc = *pFnc;
-        if (!isDefined(fnc))
-            continue;
-
-        // analyze a single function
-        LoopScan::analyzeFnc(fnc);
-    }
+    // go through all _defined_ functions, each of them changes only its CFG
+    runFncPass(stor, LoopScan::analyzeFnc);
 
     // print time elapsed
     CL_DEBUG("findLoopClosingEdges() took " << watch);
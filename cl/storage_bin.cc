@@ -0,0 +1,893 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config_cl.h"
+#include "storage_bin.hh"
+
+#include <cl/cl_msg.hh>
+#include <cl/storage.hh>
+
+#include "callgraph.hh"
+#include "cl_storage.hh"
+#include "stopwatch.hh"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/foreach.hpp>
+
+// the layout of the file (all integers are stored in the host byte order):
+//
+//  header      magic, version
+//  strings     count, { length, zero-terminated string }
+//  types       count, total count of items, { cl_type, { cl_type_item } }
+//  cl_vars     count, { cl_var }
+//  storage     TypeDb, VarDb, FncDb, var names, fnc names, ptd.dead
+//
+// strings, types and cl_vars are referenced by their index (-1 for NULL),
+// basic blocks by their index in the control flow graph of their function
+
+namespace CodeStorage {
+
+namespace {
+    const char      binMagic[8]     = "CLSTBIN";
+    const int32_t   binVersion      = 1;
+
+    typedef std::map<const Block *, int>                TBlockIdx;
+
+    /// data shared by the writer
+    struct WriteCtx {
+        std::map<std::string, int>                      strIdx;
+        std::vector<const char *>                       strList;
+        std::map<const struct cl_type *, int>           typeIdx;
+        std::vector<const struct cl_type *>             typeList;
+        std::map<const struct cl_var *, int>            varIdx;
+        std::vector<const struct cl_var *>              varList;
+    };
+
+    template <typename T>
+    void put(std::ostream &out, const T val) {
+        out.write(reinterpret_cast<const char *>(&val), sizeof val);
+    }
+
+    void putInt(std::ostream &out, const int val) {
+        put<int32_t>(out, val);
+    }
+
+    void putBool(std::ostream &out, const bool val) {
+        put<uint8_t>(out, val);
+    }
+
+    /// return index of the given object, assign a new index if not seen yet
+    template <class TMap, class TList, typename TPtr>
+    int lookupIdx(TMap &idxMap, TList &list, const TPtr ptr) {
+        if (!ptr)
+            return -1;
+
+        const int idx = list.size();
+        typename TMap::iterator it = idxMap.insert(
+                std::make_pair(ptr, idx)).first;
+        if (idx == it->second)
+            list.push_back(ptr);
+
+        return it->second;
+    }
+
+    void putStr(WriteCtx &ctx, std::ostream &out, const char *str) {
+        int idx = -1;
+        if (str) {
+            idx = ctx.strList.size();
+            idx = ctx.strIdx.insert(std::make_pair(str, idx)).first->second;
+            if (static_cast<int>(ctx.strList.size()) == idx)
+                ctx.strList.push_back(str);
+        }
+
+        putInt(out, idx);
+    }
+
+    void putType(WriteCtx &ctx, std::ostream &out, const struct cl_type *clt) {
+        putInt(out, lookupIdx(ctx.typeIdx, ctx.typeList, clt));
+    }
+
+    void writeLoc(WriteCtx &ctx, std::ostream &out, const struct cl_loc &loc) {
+        putStr(ctx, out, loc.file);
+        putInt(out, loc.line);
+        putInt(out, loc.column);
+        putBool(out, loc.sysp);
+    }
+
+    void writeCst(WriteCtx &ctx, std::ostream &out, const struct cl_cst &cst) {
+        putInt(out, cst.code);
+        switch (cst.code) {
+            case CL_TYPE_FNC:
+                putInt(out, cst.data.cst_fnc.uid);
+                putStr(ctx, out, cst.data.cst_fnc.name);
+                putBool(out, cst.data.cst_fnc.is_extern);
+                writeLoc(ctx, out, cst.data.cst_fnc.loc);
+                break;
+
+            case CL_TYPE_STRING:
+                putStr(ctx, out, cst.data.cst_string.value);
+                break;
+
+            case CL_TYPE_REAL:
+                put<double>(out, cst.data.cst_real.value);
+                break;
+
+            default:
+                // cst_uint shares the representation with cst_int
+                put<int64_t>(out, cst.data.cst_int.value);
+        }
+    }
+
+    void writeOperand(
+            WriteCtx                    &ctx,
+            std::ostream                &out,
+            const struct cl_operand     &op)
+    {
+        putInt(out, op.code);
+        putInt(out, op.scope);
+        putType(ctx, out, op.type);
+
+        int cntAccessors = 0;
+        const struct cl_accessor *ac;
+        for (ac = op.accessor; ac; ac = ac->next)
+            ++cntAccessors;
+
+        putInt(out, cntAccessors);
+        for (ac = op.accessor; ac; ac = ac->next) {
+            putInt(out, ac->code);
+            putType(ctx, out, ac->type);
+            switch (ac->code) {
+                case CL_ACCESSOR_DEREF_ARRAY:
+                    writeOperand(ctx, out, *ac->data.array.index);
+                    break;
+
+                case CL_ACCESSOR_ITEM:
+                    putInt(out, ac->data.item.id);
+                    break;
+
+                case CL_ACCESSOR_OFFSET:
+                    putInt(out, ac->data.offset.off);
+                    break;
+
+                case CL_ACCESSOR_REF:
+                case CL_ACCESSOR_DEREF:
+                    break;
+            }
+        }
+
+        switch (op.code) {
+            case CL_OPERAND_VOID:
+                break;
+
+            case CL_OPERAND_CST:
+                writeCst(ctx, out, op.data.cst);
+                break;
+
+            case CL_OPERAND_VAR:
+                putInt(out, lookupIdx(ctx.varIdx, ctx.varList, op.data.var));
+                break;
+        }
+    }
+
+    void writeKillList(std::ostream &out, const TKillVarList &kList) {
+        putInt(out, kList.size());
+        BOOST_FOREACH(const KillVar &kv, kList) {
+            putInt(out, kv.uid);
+            putBool(out, kv.onlyIfNotPointed);
+        }
+    }
+
+    void writeInsn(
+            WriteCtx                    &ctx,
+            std::ostream                &out,
+            const Insn                  &insn,
+            const TBlockIdx             &bbIdx)
+    {
+        putInt(out, insn.code);
+        putInt(out, insn.subCode);
+        writeLoc(ctx, out, insn.loc);
+
+        putInt(out, insn.operands.size());
+        BOOST_FOREACH(const struct cl_operand &op, insn.operands)
+            writeOperand(ctx, out, op);
+
+        putInt(out, insn.targets.size());
+        BOOST_FOREACH(const Block *bb, insn.targets) {
+            TBlockIdx::const_iterator it = bbIdx.find(bb);
+            CL_BREAK_IF(bbIdx.end() == it);
+            putInt(out, it->second);
+        }
+
+        writeKillList(out, insn.varsToKill);
+        putInt(out, insn.killPerTarget.size());
+        BOOST_FOREACH(const TKillVarList &kList, insn.killPerTarget)
+            writeKillList(out, kList);
+
+        putInt(out, insn.loopClosingTargets.size());
+        BOOST_FOREACH(const unsigned idx, insn.loopClosingTargets)
+            putInt(out, idx);
+    }
+
+    void writeVar(WriteCtx &ctx, std::ostream &out, const Var &var) {
+        putInt(out, var.uid);
+        putInt(out, var.code);
+        writeLoc(ctx, out, var.loc);
+        putType(ctx, out, var.type);
+        putStr(ctx, out, var.name.c_str());
+        putBool(out, var.initialized);
+        putBool(out, var.isExtern);
+        putBool(out, var.mayBePointed);
+
+        // initializers are not associated with any basic block
+        const TBlockIdx noBlocks;
+        putInt(out, var.initials.size());
+        BOOST_FOREACH(const Insn *insn, var.initials)
+            writeInsn(ctx, out, *insn, noBlocks);
+    }
+
+    void writeFnc(WriteCtx &ctx, std::ostream &out, const Fnc &fnc) {
+        putInt(out, uidOf(fnc));
+        writeOperand(ctx, out, fnc.def);
+
+        putInt(out, fnc.vars.size());
+        BOOST_FOREACH(const int uid, fnc.vars)
+            putInt(out, uid);
+
+        putInt(out, fnc.args.size());
+        BOOST_FOREACH(const int uid, fnc.args)
+            putInt(out, uid);
+
+        // basic blocks are created in the original order before filling them
+        TBlockIdx bbIdx;
+        putInt(out, fnc.cfg.size());
+        BOOST_FOREACH(const Block *bb, fnc.cfg) {
+            const int idx = bbIdx.size();
+            bbIdx[bb] = idx;
+            putStr(ctx, out, bb->name().c_str());
+        }
+
+        BOOST_FOREACH(const Block *bb, fnc.cfg) {
+            putInt(out, bb->size());
+            BOOST_FOREACH(const Insn *insn, *bb)
+                writeInsn(ctx, out, *insn, bbIdx);
+
+            putInt(out, bb->inbound().size());
+            BOOST_FOREACH(const Block *pred, bb->inbound())
+                putInt(out, bbIdx[pred]);
+        }
+    }
+
+    void writeNameDb(WriteCtx &ctx, std::ostream &out, const NameDb &db) {
+        putInt(out, db.glNames.size());
+        BOOST_FOREACH(NameDb::TNameMap::const_reference item, db.glNames) {
+            putStr(ctx, out, item.first.c_str());
+            putInt(out, item.second);
+        }
+
+        putInt(out, db.lcNames.size());
+        BOOST_FOREACH(NameDb::TFileMap::const_reference file, db.lcNames) {
+            putStr(ctx, out, file.first.c_str());
+            putInt(out, file.second.size());
+            BOOST_FOREACH(NameDb::TNameMap::const_reference item, file.second) {
+                putStr(ctx, out, item.first.c_str());
+                putInt(out, item.second);
+            }
+        }
+    }
+
+    void writeTypes(WriteCtx &ctx, std::ostream &out) {
+        // close the list of types under the types of their items
+        int cntItems = 0;
+        for (unsigned i = 0; i < ctx.typeList.size(); ++i) {
+            const struct cl_type *clt = ctx.typeList[i];
+            cntItems += clt->item_cnt;
+            for (int j = 0; j < clt->item_cnt; ++j)
+                lookupIdx(ctx.typeIdx, ctx.typeList, clt->items[j].type);
+        }
+
+        putInt(out, ctx.typeList.size());
+        putInt(out, cntItems);
+        BOOST_FOREACH(const struct cl_type *clt, ctx.typeList) {
+            putInt(out, clt->uid);
+            putInt(out, clt->code);
+            writeLoc(ctx, out, clt->loc);
+            putInt(out, clt->scope);
+            putStr(ctx, out, clt->name);
+            putInt(out, clt->size);
+            putInt(out, clt->array_size);
+            putBool(out, clt->is_unsigned);
+
+            putInt(out, clt->item_cnt);
+            for (int j = 0; j < clt->item_cnt; ++j) {
+                const struct cl_type_item &item = clt->items[j];
+                putType(ctx, out, item.type);
+                putStr(ctx, out, item.name);
+                putInt(out, item.offset);
+            }
+        }
+    }
+
+    void writeClVars(WriteCtx &ctx, std::ostream &out) {
+        putInt(out, ctx.varList.size());
+        BOOST_FOREACH(const struct cl_var *clv, ctx.varList) {
+            // the initializers are already stored as Var::initials
+            putInt(out, clv->uid);
+            putStr(ctx, out, clv->name);
+            putBool(out, clv->artificial);
+            writeLoc(ctx, out, clv->loc);
+            putBool(out, clv->initialized);
+            putBool(out, clv->is_extern);
+        }
+    }
+
+    void writeStrings(WriteCtx &ctx, std::ostream &out) {
+        putInt(out, ctx.strList.size());
+        BOOST_FOREACH(const char *str, ctx.strList) {
+            const int len = strlen(str);
+            putInt(out, len);
+            out.write(str, len + /* trailing zero */ 1);
+        }
+    }
+} // namespace
+
+bool writeStorage(const Storage &stor, const char *fileName)
+{
+    StopWatch watch;
+    WriteCtx ctx;
+
+    // the sections referenced by index are complete once the storage is done
+    std::ostringstream body;
+    putInt(body, stor.types.size());
+    BOOST_FOREACH(const struct cl_type *clt, stor.types)
+        putType(ctx, body, clt);
+
+    putInt(body, stor.vars.size());
+    BOOST_FOREACH(const Var &var, stor.vars)
+        writeVar(ctx, body, var);
+
+    putInt(body, stor.fncs.size());
+    BOOST_FOREACH(const Fnc *fnc, stor.fncs)
+        writeFnc(ctx, body, *fnc);
+
+    writeNameDb(ctx, body, stor.varNames);
+    writeNameDb(ctx, body, stor.fncNames);
+    putBool(body, stor.ptd.dead);
+
+    std::ostringstream refs;
+    writeTypes(ctx, refs);
+    writeClVars(ctx, refs);
+
+    std::ofstream out(fileName, std::ios::out | std::ios::binary);
+    if (!out) {
+        CL_ERROR("unable to create file '" << fileName << "'");
+        return false;
+    }
+
+    out.write(binMagic, sizeof binMagic);
+    putInt(out, binVersion);
+    writeStrings(ctx, out);
+    out << refs.str() << body.str();
+    out.close();
+    if (!out) {
+        CL_ERROR("error while writing file '" << fileName << "'");
+        return false;
+    }
+
+    CL_DEBUG("writeStorage() took " << watch);
+    return true;
+}
+
+
+// /////////////////////////////////////////////////////////////////////////////
+// StorageImage implementation
+struct StorageImage::Reader {
+    StorageImage                        &img;
+    Storage                             &stor;
+    const char                          *cursor;
+    const char                          *end;
+    bool                                ok;
+    std::vector<const char *>           strList;
+
+    Reader(StorageImage &img_, const void *data, size_t size):
+        img(img_),
+        stor(img_.stor_),
+        cursor(static_cast<const char *>(data)),
+        end(cursor + size),
+        ok(true)
+    {
+    }
+
+    template <typename T>
+    T get() {
+        T val = T();
+        if (end - cursor < static_cast<ptrdiff_t>(sizeof val)) {
+            ok = false;
+            cursor = end;
+            return val;
+        }
+
+        memcpy(&val, cursor, sizeof val);
+        cursor += sizeof val;
+        return val;
+    }
+
+    int getInt() {
+        return get<int32_t>();
+    }
+
+    bool getBool() {
+        return get<uint8_t>();
+    }
+
+    /// every element takes at least one byte, which bounds the count
+    unsigned getCount() {
+        const int cnt = getInt();
+        if (cnt < 0 || end - cursor < cnt) {
+            ok = false;
+            return 0;
+        }
+
+        return cnt;
+    }
+
+    /// return the element of the given table by index, -1 stands for NULL
+    template <typename T>
+    T* getRef(std::vector<T> &table) {
+        const int idx = getInt();
+        if (-1 == idx)
+            return 0;
+
+        if (idx < 0 || static_cast<int>(table.size()) <= idx) {
+            ok = false;
+            return 0;
+        }
+
+        return &table[idx];
+    }
+
+    const char* getStr() {
+        const char **pStr = getRef(strList);
+        return (pStr) ? *pStr : 0;
+    }
+
+    /// strings freed by releaseOperand() need to be duplicated
+    const char* getDupStr() {
+        const char *str = getStr();
+        return (str) ? strdup(str) : 0;
+    }
+
+    void readLoc(struct cl_loc &loc);
+    void readCst(struct cl_cst &cst);
+    void readOperand(struct cl_operand &op);
+    void readKillList(TKillVarList &kList);
+    Insn* readInsn(std::vector<Block *> &bbs);
+    void readFnc();
+    void readNameDb(NameDb &db);
+
+    bool readHeader();
+    void readStrings();
+    void readTypes();
+    void readClVars();
+    void readStorage();
+};
+
+bool StorageImage::Reader::readHeader()
+{
+    char magic[sizeof binMagic];
+    for (unsigned i = 0; i < sizeof magic; ++i)
+        magic[i] = get<char>();
+
+    return ok
+        && !memcmp(magic, binMagic, sizeof magic)
+        && binVersion == getInt();
+}
+
+void StorageImage::Reader::readStrings()
+{
+    const unsigned cnt = this->getCount();
+    strList.reserve(cnt);
+    for (unsigned i = 0; ok && i < cnt; ++i) {
+        const int len = this->getInt();
+        if (len < 0 || end - cursor <= len || cursor[len]) {
+            ok = false;
+            return;
+        }
+
+        // the string is used directly from the mapped file
+        strList.push_back(cursor);
+        cursor += len + /* trailing zero */ 1;
+    }
+}
+
+void StorageImage::Reader::readLoc(struct cl_loc &loc)
+{
+    loc.file    = this->getStr();
+    loc.line    = this->getInt();
+    loc.column  = this->getInt();
+    loc.sysp    = this->getBool();
+}
+
+void StorageImage::Reader::readTypes()
+{
+    const unsigned cnt = this->getCount();
+    const unsigned cntItems = this->getCount();
+    img.types_.resize(cnt);
+    img.items_.resize(cntItems);
+
+    unsigned nextItem = 0;
+    for (unsigned i = 0; ok && i < cnt; ++i) {
+        struct cl_type &clt = img.types_[i];
+        clt.uid         = this->getInt();
+        clt.code        = static_cast<enum cl_type_e>(this->getInt());
+        this->readLoc(clt.loc);
+        clt.scope       = static_cast<enum cl_scope_e>(this->getInt());
+        clt.name        = this->getStr();
+        clt.size        = this->getInt();
+        clt.array_size  = this->getInt();
+        clt.is_unsigned = this->getBool();
+
+        const int itemCnt = this->getInt();
+        if (itemCnt < 0 || cntItems - nextItem < static_cast<unsigned>(itemCnt)) {
+            ok = false;
+            return;
+        }
+
+        clt.item_cnt    = itemCnt;
+        clt.items       = (itemCnt) ? &img.items_[nextItem] : 0;
+        nextItem += itemCnt;
+
+        for (int j = 0; j < itemCnt; ++j) {
+            struct cl_type_item &item = clt.items[j];
+            item.type   = this->getRef(img.types_);
+            item.name   = this->getStr();
+            item.offset = this->getInt();
+        }
+    }
+}
+
+void StorageImage::Reader::readClVars()
+{
+    const unsigned cnt = this->getCount();
+    img.vars_.resize(cnt);
+    for (unsigned i = 0; ok && i < cnt; ++i) {
+        struct cl_var &clv = img.vars_[i];
+        clv.uid         = this->getInt();
+        clv.name        = this->getStr();
+        clv.artificial  = this->getBool();
+        this->readLoc(clv.loc);
+        clv.initial     = 0;
+        clv.initialized = this->getBool();
+        clv.is_extern   = this->getBool();
+    }
+}
+
+void StorageImage::Reader::readCst(struct cl_cst &cst)
+{
+    cst.code = static_cast<enum cl_type_e>(this->getInt());
+    switch (cst.code) {
+        case CL_TYPE_FNC:
+            cst.data.cst_fnc.uid        = this->getInt();
+            cst.data.cst_fnc.name       = this->getDupStr();
+            cst.data.cst_fnc.is_extern  = this->getBool();
+            this->readLoc(cst.data.cst_fnc.loc);
+            break;
+
+        case CL_TYPE_STRING:
+            cst.data.cst_string.value   = this->getDupStr();
+            break;
+
+        case CL_TYPE_REAL:
+            cst.data.cst_real.value     = this->get<double>();
+            break;
+
+        default:
+            cst.data.cst_int.value      = this->get<int64_t>();
+    }
+}
+
+// the operand is allocated the same way as by storeOperand() such that it can
+// be released by releaseOperand(), even if the file turns out to be invalid
+void StorageImage::Reader::readOperand(struct cl_operand &op)
+{
+    op.code     = static_cast<enum cl_operand_e>(this->getInt());
+    op.scope    = static_cast<enum cl_scope_e>(this->getInt());
+    op.type     = this->getRef(img.types_);
+    op.accessor = 0;
+
+    struct cl_accessor **pAc = &op.accessor;
+    const unsigned cntAccessors = this->getCount();
+    for (unsigned i = 0; ok && i < cntAccessors; ++i) {
+        struct cl_accessor *ac = new struct cl_accessor;
+        ac->code    = static_cast<enum cl_accessor_e>(this->getInt());
+        ac->type    = this->getRef(img.types_);
+        ac->next    = 0;
+        *pAc = ac;
+        pAc = &ac->next;
+
+        switch (ac->code) {
+            case CL_ACCESSOR_DEREF_ARRAY:
+                ac->data.array.index = new struct cl_operand;
+                this->readOperand(*ac->data.array.index);
+                break;
+
+            case CL_ACCESSOR_ITEM:
+                ac->data.item.id = this->getInt();
+                break;
+
+            case CL_ACCESSOR_OFFSET:
+                ac->data.offset.off = this->getInt();
+                break;
+
+            case CL_ACCESSOR_REF:
+            case CL_ACCESSOR_DEREF:
+                break;
+
+            default:
+                // not to be touched by releaseOperand()
+                ac->code = CL_ACCESSOR_REF;
+                ok = false;
+        }
+    }
+
+    switch (op.code) {
+        case CL_OPERAND_VOID:
+            break;
+
+        case CL_OPERAND_CST:
+            this->readCst(op.data.cst);
+            break;
+
+        case CL_OPERAND_VAR:
+            op.data.var = this->getRef(img.vars_);
+            break;
+
+        default:
+            op.code = CL_OPERAND_VOID;
+            ok = false;
+    }
+}
+
+void StorageImage::Reader::readKillList(TKillVarList &kList)
+{
+    const unsigned cnt = this->getCount();
+    for (unsigned i = 0; ok && i < cnt; ++i) {
+        const int uid = this->getInt();
+        const bool onlyIfNotPointed = this->getBool();
+        kList.insert(KillVar(uid, onlyIfNotPointed));
+    }
+}
+
+Insn* StorageImage::Reader::readInsn(std::vector<Block *> &bbs)
+{
+    Insn *insn = new Insn;
+    insn->stor      = &stor;
+    insn->bb        = 0;
+    insn->code      = static_cast<enum cl_insn_e>(this->getInt());
+    insn->subCode   = this->getInt();
+    this->readLoc(insn->loc);
+
+    TOperandList &operands = insn->operands;
+    operands.resize(this->getCount());
+    BOOST_FOREACH(struct cl_operand &op, operands) {
+        op.code = CL_OPERAND_VOID;
+        if (ok)
+            this->readOperand(op);
+    }
+
+    const unsigned cntTargets = this->getCount();
+    for (unsigned i = 0; ok && i < cntTargets; ++i) {
+        Block **pBlock = this->getRef(bbs);
+        if (pBlock)
+            insn->targets.push_back(*pBlock);
+        else
+            ok = false;
+    }
+
+    this->readKillList(insn->varsToKill);
+    insn->killPerTarget.resize(this->getCount());
+    BOOST_FOREACH(TKillVarList &kList, insn->killPerTarget)
+        this->readKillList(kList);
+
+    const unsigned cntClosing = this->getCount();
+    for (unsigned i = 0; ok && i < cntClosing; ++i)
+        insn->loopClosingTargets.push_back(this->getInt());
+
+    return insn;
+}
+
+void StorageImage::Reader::readFnc()
+{
+    const int uid = this->getInt();
+    Fnc *fnc = stor.fncs[uid];
+    fnc->stor = &stor;
+    this->readOperand(fnc->def);
+
+    const unsigned cntVars = this->getCount();
+    for (unsigned i = 0; ok && i < cntVars; ++i)
+        fnc->vars.insert(this->getInt());
+
+    const unsigned cntArgs = this->getCount();
+    for (unsigned i = 0; ok && i < cntArgs; ++i)
+        fnc->args.push_back(this->getInt());
+
+    std::vector<Block *> bbs(this->getCount(), 0);
+    BOOST_FOREACH(Block *&bb, bbs) {
+        const char *name = this->getStr();
+        if (!name) {
+            ok = false;
+            return;
+        }
+
+        bb = fnc->cfg[name];
+    }
+
+    BOOST_FOREACH(Block *bb, bbs) {
+        const unsigned cntInsns = this->getCount();
+        for (unsigned i = 0; ok && i < cntInsns; ++i)
+            bb->append(this->readInsn(bbs));
+
+        const unsigned cntInbound = this->getCount();
+        for (unsigned i = 0; ok && i < cntInbound; ++i) {
+            Block **pPred = this->getRef(bbs);
+            if (pPred)
+                bb->appendPredecessor(*pPred);
+            else
+                ok = false;
+        }
+    }
+}
+
+void StorageImage::Reader::readNameDb(NameDb &db)
+{
+    const unsigned cntGl = this->getCount();
+    for (unsigned i = 0; ok && i < cntGl; ++i) {
+        const char *name = this->getStr();
+        const int uid = this->getInt();
+        if (name)
+            db.glNames[name] = uid;
+    }
+
+    const unsigned cntFiles = this->getCount();
+    for (unsigned i = 0; ok && i < cntFiles; ++i) {
+        const char *file = this->getStr();
+        NameDb::TNameMap &lcNames = db.lcNames[(file) ? file : ""];
+
+        const unsigned cntLc = this->getCount();
+        for (unsigned j = 0; ok && j < cntLc; ++j) {
+            const char *name = this->getStr();
+            const int uid = this->getInt();
+            if (name)
+                lcNames[name] = uid;
+        }
+    }
+}
+
+void StorageImage::Reader::readStorage()
+{
+    const unsigned cntTypes = this->getCount();
+    for (unsigned i = 0; ok && i < cntTypes; ++i)
+        stor.types.insert(this->getRef(img.types_));
+
+    const unsigned cntVars = this->getCount();
+    for (unsigned i = 0; ok && i < cntVars; ++i) {
+        const int uid = this->getInt();
+        Var &var = stor.vars[uid];
+        var.uid             = uid;
+        var.code            = static_cast<EVar>(this->getInt());
+        this->readLoc(var.loc);
+        var.type            = this->getRef(img.types_);
+        const char *name    = this->getStr();
+        var.name            = (name) ? name : "";
+        var.initialized     = this->getBool();
+        var.isExtern        = this->getBool();
+        var.mayBePointed    = this->getBool();
+
+        std::vector<Block *> noBlocks;
+        const unsigned cntInitials = this->getCount();
+        for (unsigned j = 0; ok && j < cntInitials; ++j)
+            var.initials.push_back(this->readInsn(noBlocks));
+    }
+
+    const unsigned cntFncs = this->getCount();
+    for (unsigned i = 0; ok && i < cntFncs; ++i)
+        this->readFnc();
+
+    this->readNameDb(stor.varNames);
+    this->readNameDb(stor.fncNames);
+    stor.ptd.dead = this->getBool();
+}
+
+StorageImage::Mapping::~Mapping()
+{
+    if (addr)
+        munmap(addr, size);
+}
+
+StorageImage::StorageImage()
+{
+}
+
+StorageImage::~StorageImage()
+{
+    // the rest of stor_ is released by its destructor
+    releaseStorage(stor_);
+}
+
+bool StorageImage::load(const char *fileName)
+{
+    CL_BREAK_IF(map_.addr);
+    StopWatch watch;
+
+    const int fd = open(fileName, O_RDONLY);
+    if (fd < 0) {
+        CL_ERROR("unable to open file '" << fileName << "'");
+        return false;
+    }
+
+    struct stat st;
+    if (!fstat(fd, &st) && 0 < st.st_size) {
+        void *addr = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED != addr) {
+            map_.addr = addr;
+            map_.size = st.st_size;
+        }
+    }
+
+    close(fd);
+    if (!map_.addr) {
+        CL_ERROR("unable to map file '" << fileName << "'");
+        return false;
+    }
+
+    Reader rd(*this, map_.addr, map_.size);
+    if (!rd.readHeader()) {
+        CL_ERROR("'" << fileName << "' is not a storage file of this version");
+        return false;
+    }
+
+    rd.readStrings();
+    rd.readTypes();
+    rd.readClVars();
+    if (rd.ok)
+        rd.readStorage();
+
+    if (!rd.ok || rd.cursor != rd.end) {
+        CL_ERROR("'" << fileName << "' is truncated or corrupted");
+        return false;
+    }
+
+    CL_DEBUG("building call-graph...");
+    CallGraph::buildCallGraph(stor_);
+
+    CL_DEBUG("StorageImage::load() took " << watch);
+    return true;
+}
+
+} // namespace CodeStorage
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef H_GUARD_STORAGE_BIN_H
+#define H_GUARD_STORAGE_BIN_H
+
+/**
+ * @file storage_bin.hh
+ * binary serialization of a finished CodeStorage::Storage object
+ *
+ * The file captures the Storage object as the analyzers see it after the
+ * passes of the @b "easy" code listener: types, variables (including their
+ * initializers), functions with their control flow graphs, loop-closing edges,
+ * lists of variables to kill and the name databases.  The points-to graphs are
+ * not stored, their results are already reflected by the lists of variables to
+ * kill (and Var::mayBePointed), which is all the analyzers consume.  The call
+ * graph is rebuilt once the file is loaded.
+ */
+
+#include <cl/storage.hh>
+
+#include <string>
+#include <vector>
+
+namespace CodeStorage {
+
+/**
+ * write the given Storage object into a binary file
+ * @param stor the Storage object, finished by the passes of ClEasy
+ * @param fileName name of the file to be (over)written
+ * @return true on success, false if the file could not be written
+ */
+bool writeStorage(const Storage &stor, const char *fileName);
+
+/**
+ * Storage object loaded from a memory-mapped binary file (see writeStorage())
+ *
+ * The strings of the loaded types and variables point into the mapped file,
+ * which is therefore kept mapped as long as the Storage object lives.
+ */
+class StorageImage {
+    public:
+        StorageImage();
+        ~StorageImage();
+
+        /**
+         * map the given file and load the Storage object from it
+         * @return true on success, false if the file could not be loaded
+         * @note the method can be called only once per object
+         */
+        bool load(const char *fileName);
+
+        /// the loaded Storage object (valid only if load() has succeeded)
+        Storage& stor() { return stor_; }
+
+    private:
+        StorageImage(const StorageImage &);
+        StorageImage& operator=(const StorageImage &);
+
+        struct Reader;
+
+        /// the mapped file, unmapped by the destructor
+        struct Mapping {
+            void                           *addr;
+            size_t                          size;
+
+            Mapping(): addr(0), size(0) { }
+            ~Mapping();
+        };
+
+    private:
+        Mapping                             map_;
+        std::vector<struct cl_type>         types_;
+        std::vector<struct cl_type_item>    items_;
+        std::vector<struct cl_var>          vars_;
+
+        // needs to be destroyed before the data it refers to
+        Storage                             stor_;
+};
+
+} // namespace CodeStorage
+
+#endif /* H_GUARD_STORAGE_BIN_H */
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../config_cl.h"
+#include "../fncpass.hh"
+#include "../killer.hh"
+#include "../loopscan.hh"
+
+#include <cl/cl_msg.hh>
+#include <cl/easy.hh>
+#include <cl/storage.hh>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/foreach.hpp>
+
+// required by the gcc plug-in API
+extern "C" {
+    __attribute__ ((__visibility__ ("default"))) int plugin_is_GPL_compatible;
+}
+
+typedef const CodeStorage::Fnc             *TFnc;
+typedef const CodeStorage::Block           *TBlock;
+typedef const CodeStorage::Insn            *TInsn;
+typedef CodeStorage::TKillVarList           TKillList;
+typedef std::vector<std::string>            TResults;
+
+/// the number of threads the passes are compared with the serial run on
+static const unsigned cntThreads = 4;
+
+void printKillList(std::ostream &str, const TKillList &kList) {
+    str << " {";
+    BOOST_FOREACH(const CodeStorage::KillVar &kv, kList)
+        str << " " << kv.uid << ((kv.onlyIfNotPointed) ? "?" : "");
+    str << " }";
+}
+
+/// drop the results of the passes, so that they can be computed again
+void clearResults(const CodeStorage::Storage &stor) {
+    BOOST_FOREACH(const TFnc fnc, stor.fncs) {
+        if (!isDefined(*fnc))
+            continue;
+
+        BOOST_FOREACH(const TBlock bb, fnc->cfg) {
+            BOOST_FOREACH(const TInsn insn, *bb) {
+                CodeStorage::Insn &dst = const_cast<CodeStorage::Insn &>(*insn);
+                dst.varsToKill.clear();
+                BOOST_FOREACH(TKillList &kList, dst.killPerTarget)
+                    kList.clear();
+
+                dst.loopClosingTargets.clear();
+            }
+        }
+    }
+}
+
+/// run the passes on the given number of threads, collect their results
+void runPasses(
+        TResults                       &dst,
+        const CodeStorage::Storage     &stor,
+        const unsigned                  cnt)
+{
+    clearResults(stor);
+
+    CodeStorage::Storage &data = const_cast<CodeStorage::Storage &>(stor);
+    CodeStorage::setFncPassThreads(cnt);
+    CodeStorage::findLoopClosingEdges(data);
+    CodeStorage::killLocalVariables(data);
+    CodeStorage::setFncPassThreads(CL_EASY_THREADS);
+
+    BOOST_FOREACH(const TFnc fnc, stor.fncs) {
+        if (!isDefined(*fnc))
+            continue;
+
+        BOOST_FOREACH(const TBlock bb, fnc->cfg) {
+            BOOST_FOREACH(const TInsn insn, *bb) {
+                std::ostringstream str;
+                str << nameOf(*fnc) << "()/" << bb->name() << ":";
+
+                printKillList(str, insn->varsToKill);
+                BOOST_FOREACH(const TKillList &kList, insn->killPerTarget)
+                    printKillList(str, kList);
+
+                str << " loop-closing:";
+                BOOST_FOREACH(const unsigned target, insn->loopClosingTargets)
+                    str << " " << target;
+
+                dst.push_back(str.str());
+            }
+        }
+    }
+}
+
+void clEasyRun(const CodeStorage::Storage &stor, const char *) {
+    CL_DEBUG("chk_fncpass started...");
+
+    TResults serial, threaded;
+    runPasses(serial, stor, /* serially */ 1);
+    runPasses(threaded, stor, cntThreads);
+
+    if (serial.size() != threaded.size()) {
+        CL_ERROR("the passes have yielded different numbers of insns");
+        return;
+    }
+
+    for (unsigned i = 0; i < serial.size(); ++i) {
+        if (serial[i] != threaded[i])
+            CL_ERROR("serial \"" << serial[i] << "\" != threaded \""
+                    << threaded[i] << "\"");
+    }
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../config_cl.h"
+#include "../storage_bin.hh"
+
+#include <cl/cl_msg.hh>
+#include <cl/cldebug.hh>
+#include <cl/easy.hh>
+#include <cl/storage.hh>
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+#include <boost/foreach.hpp>
+
+// required by the gcc plug-in API
+extern "C" {
+    __attribute__ ((__visibility__ ("default"))) int plugin_is_GPL_compatible;
+}
+
+typedef const CodeStorage::Fnc             *TFnc;
+typedef const CodeStorage::Block           *TBlock;
+typedef const CodeStorage::Insn            *TInsn;
+typedef CodeStorage::TKillVarList           TKillList;
+
+void printKillList(std::ostream &str, const TKillList &kList) {
+    str << " {";
+    BOOST_FOREACH(const CodeStorage::KillVar &kv, kList)
+        str << " " << kv.uid << ((kv.onlyIfNotPointed) ? "?" : "");
+    str << " }";
+}
+
+void printInsn(std::ostream &str, const TInsn insn) {
+    str << "    " << insn->loc.line << ": " << *insn;
+
+    str << "\n      kill:";
+    printKillList(str, insn->varsToKill);
+    BOOST_FOREACH(const TKillList &kList, insn->killPerTarget)
+        printKillList(str, kList);
+
+    str << "\n      targets:";
+    BOOST_FOREACH(const TBlock bb, insn->targets)
+        str << " " << bb->name();
+
+    str << "\n      loop-closing:";
+    BOOST_FOREACH(const unsigned target, insn->loopClosingTargets)
+        str << " " << target;
+
+    str << "\n";
+}
+
+void printNames(std::ostream &str, const CodeStorage::NameDb &names) {
+    typedef CodeStorage::NameDb::TNameMap TNameMap;
+    typedef CodeStorage::NameDb::TFileMap TFileMap;
+
+    BOOST_FOREACH(const TNameMap::value_type &item, names.glNames)
+        str << "  " << item.first << ": " << item.second << "\n";
+
+    BOOST_FOREACH(const TFileMap::value_type &file, names.lcNames)
+        BOOST_FOREACH(const TNameMap::value_type &item, file.second)
+            str << "  " << file.first << ":" << item.first << ": "
+                << item.second << "\n";
+}
+
+/// print everything of the storage that its binary file is supposed to keep
+std::string printStorage(const CodeStorage::Storage &stor) {
+    std::ostringstream str;
+
+    str << "types:\n";
+    BOOST_FOREACH(const struct cl_type *clt, stor.types)
+        str << "  " << clt->uid << ": code " << clt->code
+            << ", size " << clt->size << ", items " << clt->item_cnt << "\n";
+
+    str << "vars:\n";
+    BOOST_FOREACH(const CodeStorage::Var &var, stor.vars) {
+        str << "  " << var.uid << " " << var.name << ": code " << var.code
+            << ", type " << var.type->uid
+            << ", initialized " << var.initialized
+            << ", extern " << var.isExtern
+            << ", pointed " << var.mayBePointed << "\n";
+
+        BOOST_FOREACH(const TInsn insn, var.initials)
+            printInsn(str, insn);
+    }
+
+    str << "var names:\n";
+    printNames(str, stor.varNames);
+
+    str << "fnc names:\n";
+    printNames(str, stor.fncNames);
+
+    str << "fncs:\n";
+    BOOST_FOREACH(const TFnc fnc, stor.fncs) {
+        str << "  " << nameOf(*fnc) << "(), uid " << uidOf(*fnc) << ", args";
+        BOOST_FOREACH(const int uid, fnc->args)
+            str << " " << uid;
+
+        str << ", vars";
+        BOOST_FOREACH(const int uid, fnc->vars)
+            str << " " << uid;
+
+        str << "\n";
+        if (!isDefined(*fnc))
+            continue;
+
+        BOOST_FOREACH(const TBlock bb, fnc->cfg) {
+            str << "   " << bb->name() << ":\n";
+            BOOST_FOREACH(const TInsn insn, *bb)
+                printInsn(str, insn);
+        }
+    }
+
+    return str.str();
+}
+
+void clEasyRun(const CodeStorage::Storage &stor, const char *) {
+    CL_DEBUG("chk_storage_bin started...");
+
+    std::ostringstream fileName;
+    fileName << "chk_storage_bin." << getpid() << ".bin";
+    if (!CodeStorage::writeStorage(stor, fileName.str().c_str()))
+        // error message already emitted
+        return;
+
+    const std::string orig = printStorage(stor);
+    std::string loaded;
+    {
+        CodeStorage::StorageImage image;
+        if (image.load(fileName.str().c_str()))
+            loaded = printStorage(image.stor());
+    }
+
+    remove(fileName.str().c_str());
+    if (loaded == orig)
+        return;
+
+    // report the first line that differs
+    std::istringstream origStr(orig), loadedStr(loaded);
+    std::string origLine, loadedLine;
+    while (std::getline(origStr, origLine)) {
+        if (!std::getline(loadedStr, loadedLine) || origLine != loadedLine)
+            break;
+    }
+
+    CL_ERROR("storage loaded back differs: \"" << origLine
+            << "\" != \"" << loadedLine << "\"");
+}
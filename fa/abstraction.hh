@@ -20,6 +20,14 @@
 #ifndef ABSTRACTION_H
 #define ABSTRACTION_H
 
+// Standard library headers
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Boost headers
+#include <boost/functional/hash.hpp>
+
 // Forester headers
 #include "forestautext.hh"
 #include "streams.hh"
@@ -45,7 +53,8 @@ public:   // methods
 	 *
 	 * @param[in]  root    The root on which the abstraction is to be applied
 	 * @param[in]  height  The height of the abstraction
-	 * @param[in]  f       Functor for matching transitions
+	 * @param[in]  f       Functor giving the key of a transition (transitions
+	 *                     with the same key match)
 	 */
 	template <class F>
 	void heightAbstraction(
@@ -59,30 +68,32 @@ public:   // methods
 
 		Index<size_t> stateIndex;
 		fae_.getRoot(root)->buildStateIndex(stateIndex);
-		std::vector<std::vector<bool>> rel(stateIndex.size(),
-			std::vector<bool>(stateIndex.size(), true));
+		std::vector<size_t> classes(stateIndex.size(), 0);
 
 		// compute the abstraction (i.e. which states are to be merged)
-		fae_.getRoot(root)->heightAbstraction(rel, height, f, stateIndex);
+		fae_.getRoot(root)->heightAbstraction(classes, height, f, stateIndex);
 
+		std::vector<size_t> invStateIndex(stateIndex.size());
+		for (Index<size_t>::iterator i = stateIndex.begin(); i != stateIndex.end(); ++i)
+			invStateIndex[i->second] = i->first;
+
+		// only states with the same cutpoint signature may be merged; the head of
+		// a class is the state with the lowest index
 		ConnectionGraph::StateToCutpointSignatureMap stateMap;
 		ConnectionGraph::computeSignatures(stateMap, *fae_.getRoot(root));
-		for (Index<size_t>::iterator j = stateIndex.begin(); j != stateIndex.end(); ++j)
-		{	// go through the matrix
-			for (Index<size_t>::iterator k = stateIndex.begin(); k != stateIndex.end(); ++k)
-			{
-				if (k == j)
-					continue;
-
-				if (stateMap[j->first] % stateMap[k->first])
-					continue;
-
-				rel[j->second][k->second] = false;
-			}
+		std::unordered_map<std::vector<size_t>, size_t,
+			boost::hash<std::vector<size_t>>> heads;
+		std::vector<size_t> headIndex(stateIndex.size());
+		std::vector<size_t> key;
+		for (size_t i = 0; i < invStateIndex.size(); ++i)
+		{
+			key.assign(1, classes[i]);
+			ConnectionGraph::signatureKey(key, stateMap[invStateIndex[i]]);
+			headIndex[i] = heads.insert(std::make_pair(key, i)).first->second;
 		}
 
 		TreeAut ta(*fae_.backend);
-		fae_.getRoot(root)->collapsed(ta, rel, stateIndex);
+		fae_.getRoot(root)->collapsed(ta, std::move(headIndex), stateIndex);
 		fae_.setRoot(root, std::shared_ptr<TreeAut>(fae_.allocTA()));
 		ta.uselessAndUnreachableFree(*fae_.getRoot(root));
 	}
@@ -114,7 +125,7 @@ public:   // methods
 
 		// create the initial relation
 		// TODO: use boost::dynamic_bitset
-		std::vector<std::vector<bool>> rel;
+		BitMatrix rel;
 
 		if (!predicates.empty())
 		{
@@ -140,7 +151,7 @@ public:   // methods
 			FA_NOTE("matchWith: " << oss.str());
 
 			// create the relation
-			rel.assign(numStates, std::vector<bool>(numStates, false));
+			rel.assign(numStates, false);
 			for (size_t i = 0; i < numStates; ++i)
 			{
 				rel[i][i] = true;
@@ -158,7 +169,7 @@ public:   // methods
 		else
 		{
 			// create universal relation
-			rel.assign(numStates, std::vector<bool>(numStates, true));
+			rel.assign(numStates, true);
 		}
 
 		for (size_t i = 0; i < fae_.getRootCount(); ++i)
@@ -182,13 +193,9 @@ public:   // methods
 						continue;
 					}
 
-					// load data if present
-					const Data* jData;
-					bool jIsData = fae_.isData(j->first, jData);
-					assert((!jIsData || (nullptr != jData)) && (!(nullptr == jData) || !jIsData));
-					const Data* kData;
-					bool kIsData = fae_.isData(k->first, kData);
-					assert((!kIsData || (nullptr != kData)) && (!(nullptr == kData) || !kIsData));
+					// data states are never merged
+					bool jIsData = FA::isData(j->first);
+					bool kIsData = FA::isData(k->first);
 
 					if (jIsData || kIsData)
 					{
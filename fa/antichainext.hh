@@ -35,6 +35,9 @@ private:
 
 	std::vector<std::vector<trans_list_type>> aTransIndex;
 
+	/// for every state, the states it simulates downwards (including itself)
+	std::vector<std::vector<size_t>> dwnInvIndex;
+
 	void simInsert(
 		std::pair<size_t, std::set<size_t>>&   el,
 		bool&                                  isAccepting,
@@ -86,10 +89,21 @@ public:
 
 public:
 
-	AntichainExt(const std::vector<std::vector<bool> >& rel) :
+	/**
+	 * @param[in]  rel  The upward simulation induced by the identity, it
+	 *                  minimises the macrostates and subsumes the elements
+	 * @param[in]  dwn  The downward simulation, it matches the left-hand sides
+	 *                  of transitions against the macrostates
+	 */
+	AntichainExt(const BitMatrix& rel, const BitMatrix& dwn) :
 		Antichain(rel),
-		aTransIndex{}
-	{ }
+		aTransIndex{},
+		dwnInvIndex{}
+	{
+		BitMatrix dwnInv;
+		utils::relInv(dwnInv, dwn);
+		utils::relIndex(this->dwnInvIndex, dwnInv);
+	}
 
 	void initIndex(size_t aSize, size_t /* bSize */)
 	{
@@ -170,40 +184,64 @@ public:
 			return false;
 		}
 
+		/**
+		 * @brief  Checks whether a transition of B leaves the current macrostates
+		 *
+		 * A state of the left-hand side matches a macrostate if it simulates
+		 * some of its states downwards, i.e. if it accepts every tree a state
+		 * of the macrostate accepts.  The states minimised out of the
+		 * macrostates are still taken into account this way.
+		 */
 		bool match(const typename TA<T>::TransIDPair* t)
 		{
 			for (size_t i = 0; i < t->first.lhs().size(); ++i)
 			{
-				if ((*this->state[i].current)->first.count(t->first.lhs()[i]) == 0)
+				if (!utils::checkIntersection((*this->state[i].current)->first,
+					ac.dwnInvIndex[t->first.lhs()[i]]))
+				{
 					return false;
+				}
 			}
 			return true;
 		}
 	};
 
-	static bool subseteq(const TA<T>& a, const TA<T>& b)
+	/**
+	 * @brief  Checks language inclusion of automata in their renamed union
+	 *
+	 * The antichain is pruned by the simulations of the union as follows:
+	 * - the macrostates of B keep the states maximal w.r.t. @p up only,
+	 * - an element is subsumed by another one with an @p up-larger state of A
+	 *   and a macrostate whose states are all @p up-smaller than some state of
+	 *   its own macrostate,
+	 * - an element whose state of A is @p upDwn-smaller than some state of its
+	 *   macrostate cannot lead to a counterexample and is dropped.
+	 * The siblings in the transitions matched by @p up are the same states, so
+	 * that the post of a pruned element is matched by the post of the element
+	 * that pruned it; this does not hold for @p upDwn.
+	 *
+	 * @param[in]  c       The union, the states of B (the right-hand side) are
+	 *                     @p 0 ... @p countB - 1, the ones of A follow up to
+	 *                     @p cSize - 1
+	 * @param[in]  countB  The number of states of B
+	 * @param[in]  cSize   The number of states of @p c
+	 * @param[in]  dwn     The downward simulation of @p c
+	 * @param[in]  up      The upward simulation of @p c induced by the identity
+	 * @param[in]  upDwn   The upward simulation of @p c induced by @p dwn
+	 *
+	 * @returns  @p true if the language of A is included in the one of B
+	 */
+	static bool subseteq(
+		const TA<T>&                 c,
+		size_t                       countB,
+		size_t                       cSize,
+		const BitMatrix&             dwn,
+		const BitMatrix&             up,
+		const BitMatrix&             upDwn)
 	{
-		typename TA<T>::Backend backend;
-		TA<T> c(backend);
-		size_t countB;
-		TA<T>::renamedUnion(c, b, a, countB);
-		Index<size_t> stateIndex;
-		c.buildStateIndex(stateIndex);
-		size_t cSize = stateIndex.size();
-		stateIndex.clear();
-		for (size_t i = 0; i < cSize; ++i)
-			stateIndex.add(i);
-		// compute simulation
-		std::vector<std::vector<bool>> upsim, dwnsim, ident(cSize, std::vector<bool>(cSize, false));
-		for (size_t i = 0; i < cSize; ++i)
-		{
-			ident[i][i] = true;
-		}
-
-		upsim = ident;
-		std::vector<std::vector<size_t> > upsimIndex;
-		utils::relIndex(upsimIndex, upsim);
-		AntichainExt<T> antichain(upsim);
+		std::vector<std::vector<size_t> > upDwnIndex;
+		utils::relIndex(upDwnIndex, upDwn);
+		AntichainExt<T> antichain(up, dwn);
 		typename AntichainExt<T>::ResponseExt response(antichain);
 		antichain.initIndex(cSize - countB, countB);
 		trans_list_type aLeaves;
@@ -248,7 +286,7 @@ public:
 			if (isAccepting)
 				return false;
 			// cross-automata check
-			if (!utils::checkIntersection(newEl.second, upsimIndex[newEl.first]))
+			if (!utils::checkIntersection(newEl.second, upDwnIndex[newEl.first]))
 				post.push_back(newEl);
 		}
 		antichain.initialize(post);
@@ -289,7 +327,7 @@ public:
 							return false;
 						}
 						// cross-automata check
-						if (!utils::checkIntersection(newEl.second, upsimIndex[newEl.first]))
+						if (!utils::checkIntersection(newEl.second, upDwnIndex[newEl.first]))
 							post.push_back(newEl);
 					} while (response.next());
 				}
@@ -0,0 +1,498 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BIT_MATRIX_H
+#define BIT_MATRIX_H
+
+// Standard library headers
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief  A dense binary relation stored as a matrix of bits
+ *
+ * Every row of the matrix is stored in a contiguous sequence of 64-bit words.
+ * The rows are padded to a multiple of @p ROW_ALIGN words, so that the row
+ * kernels (intersection, inclusion, and the like) always work on whole blocks
+ * of words and can be vectorised by the compiler.  The padding bits are kept
+ * zero, which allows the kernels not to care about the number of columns.
+ *
+ * The matrix is usually square (a relation over a set of states), but the
+ * number of rows and columns can differ if created by the 3-argument @p
+ * assign().
+ */
+class BitMatrix
+{
+public:   // data types
+
+	typedef uint64_t Word;
+
+	/**
+	 * @brief  Proxy for a single element of the matrix
+	 */
+	class Reference
+	{
+	private:  // data members
+
+		Word& word_;
+		Word mask_;
+
+	public:   // methods
+
+		Reference(Word& word, Word mask) :
+			word_(word),
+			mask_(mask)
+		{ }
+
+		operator bool() const
+		{
+			return (word_ & mask_) != 0;
+		}
+
+		Reference& operator=(bool value)
+		{
+			if (value)
+				word_ |= mask_;
+			else
+				word_ &= ~mask_;
+
+			return *this;
+		}
+
+		Reference& operator=(const Reference& ref)
+		{
+			return *this = static_cast<bool>(ref);
+		}
+	};
+
+	/**
+	 * @brief  Proxy for a row of the matrix, allows to write @p rel[i][j]
+	 */
+	class RowRef
+	{
+	private:  // data members
+
+		Word* row_;
+
+	public:   // methods
+
+		explicit RowRef(Word* row) :
+			row_(row)
+		{ }
+
+		Reference operator[](size_t col) const
+		{
+			return Reference(row_[col / WORD_BITS], BitMatrix::maskOf(col));
+		}
+	};
+
+	/**
+	 * @brief  Read-only proxy for a row of the matrix
+	 */
+	class ConstRowRef
+	{
+	private:  // data members
+
+		const Word* row_;
+
+	public:   // methods
+
+		explicit ConstRowRef(const Word* row) :
+			row_(row)
+		{ }
+
+		bool operator[](size_t col) const
+		{
+			return (row_[col / WORD_BITS] & BitMatrix::maskOf(col)) != 0;
+		}
+	};
+
+private:  // constants
+
+	static const size_t WORD_BITS = 64;
+
+	/// the number of words each row is padded to a multiple of
+	static const size_t ROW_ALIGN = 4;
+
+private:  // data members
+
+	size_t rows_;
+	size_t cols_;
+
+	/// the number of words per row (including the padding)
+	size_t stride_;
+
+	std::vector<Word> data_;
+
+private:  // methods
+
+	static Word maskOf(size_t col)
+	{
+		return static_cast<Word>(1) << (col % WORD_BITS);
+	}
+
+	static size_t strideOf(size_t cols)
+	{
+		const size_t words = (cols + WORD_BITS - 1) / WORD_BITS;
+		return (words + ROW_ALIGN - 1) / ROW_ALIGN * ROW_ALIGN;
+	}
+
+	/**
+	 * @brief  Sets the bits of a row from @p from up to the number of columns
+	 *
+	 * The bits below @p from are left untouched, the padding bits stay zero.
+	 */
+	void fillRow(Word* row, size_t from, bool value) const
+	{
+		if (from >= cols_)
+			return;
+
+		size_t i = from / WORD_BITS;
+		const size_t last = (cols_ - 1) / WORD_BITS;
+
+		// the first (partial) word
+		const Word head = ~static_cast<Word>(0) << (from % WORD_BITS);
+		if (value)
+			row[i] |= head;
+		else
+			row[i] &= ~head;
+
+		// the remaining words
+		for (++i; i <= last; ++i)
+			row[i] = (value) ? ~static_cast<Word>(0) : 0;
+
+		// clear the padding in the last word
+		if (cols_ % WORD_BITS)
+			row[last] &= ~(~static_cast<Word>(0) << (cols_ % WORD_BITS));
+	}
+
+public:   // methods
+
+	BitMatrix() :
+		rows_(0),
+		cols_(0),
+		stride_(0),
+		data_()
+	{ }
+
+	/**
+	 * @brief  Creates a square matrix with all elements set to @p value
+	 */
+	explicit BitMatrix(size_t size, bool value = false) :
+		rows_(0),
+		cols_(0),
+		stride_(0),
+		data_()
+	{
+		this->assign(size, size, value);
+	}
+
+	/**
+	 * @brief  Reinitialises the matrix to be square with all elements @p value
+	 */
+	void assign(size_t size, bool value)
+	{
+		this->assign(size, size, value);
+	}
+
+	/**
+	 * @brief  Reinitialises the matrix with all elements set to @p value
+	 */
+	void assign(size_t rows, size_t cols, bool value)
+	{
+		rows_ = rows;
+		cols_ = cols;
+		stride_ = strideOf(cols);
+		data_.assign(rows_ * stride_, 0);
+
+		if (!value)
+			return;
+
+		for (size_t i = 0; i < rows_; ++i)
+			this->fillRow(this->row(i), 0, true);
+	}
+
+	/**
+	 * @brief  Grows a square matrix while preserving its contents
+	 *
+	 * The newly added rows and columns are set to @p value.
+	 */
+	void resize(size_t size, bool value)
+	{
+		assert(rows_ == cols_);
+		assert(size >= rows_);
+
+		BitMatrix tmp;
+		tmp.rows_ = size;
+		tmp.cols_ = size;
+		tmp.stride_ = strideOf(size);
+		tmp.data_.assign(size * tmp.stride_, 0);
+
+		for (size_t i = 0; i < rows_; ++i)
+		{
+			std::copy(this->row(i), this->row(i) + stride_, tmp.row(i));
+			tmp.fillRow(tmp.row(i), cols_, value);
+		}
+
+		for (size_t i = rows_; i < size; ++i)
+			tmp.fillRow(tmp.row(i), 0, value);
+
+		this->swap(tmp);
+	}
+
+	void swap(BitMatrix& other)
+	{
+		std::swap(rows_, other.rows_);
+		std::swap(cols_, other.cols_);
+		std::swap(stride_, other.stride_);
+		data_.swap(other.data_);
+	}
+
+	/**
+	 * @brief  The number of elements of the relation (i.e. of rows)
+	 */
+	size_t size() const
+	{
+		return rows_;
+	}
+
+	size_t rows() const
+	{
+		return rows_;
+	}
+
+	size_t cols() const
+	{
+		return cols_;
+	}
+
+	/**
+	 * @brief  The number of words per row (including the padding)
+	 */
+	size_t stride() const
+	{
+		return stride_;
+	}
+
+	/**
+	 * @brief  The number of bytes the matrix takes on the heap
+	 */
+	size_t bytes() const
+	{
+		return data_.capacity() * sizeof(Word);
+	}
+
+	Word* row(size_t i)
+	{
+		assert(i < rows_);
+		return data_.data() + i * stride_;
+	}
+
+	const Word* row(size_t i) const
+	{
+		assert(i < rows_);
+		return data_.data() + i * stride_;
+	}
+
+	RowRef operator[](size_t i)
+	{
+		return RowRef(this->row(i));
+	}
+
+	ConstRowRef operator[](size_t i) const
+	{
+		return ConstRowRef(this->row(i));
+	}
+
+	bool get(size_t i, size_t j) const
+	{
+		assert(j < cols_);
+		return (this->row(i)[j / WORD_BITS] & maskOf(j)) != 0;
+	}
+
+	void set(size_t i, size_t j, bool value = true)
+	{
+		assert(j < cols_);
+		Word& word = this->row(i)[j / WORD_BITS];
+		if (value)
+			word |= maskOf(j);
+		else
+			word &= ~maskOf(j);
+	}
+
+	/**
+	 * @brief  Checks whether row @p i of this and row @p j of @p other intersect
+	 */
+	bool rowsIntersect(size_t i, const BitMatrix& other, size_t j) const
+	{
+		const Word* a = this->row(i);
+		const Word* b = other.row(j);
+		const size_t n = std::min(stride_, other.stride_);
+
+		Word acc = 0;
+		for (size_t k = 0; k < n; k += ROW_ALIGN)
+		{
+			for (size_t l = k; l < k + ROW_ALIGN; ++l)
+				acc |= a[l] & b[l];
+
+			if (acc)
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief  Checks whether row @p i of this is included in row @p j of @p other
+	 */
+	bool rowSubsetOf(size_t i, const BitMatrix& other, size_t j) const
+	{
+		const Word* a = this->row(i);
+		const Word* b = other.row(j);
+		const size_t n = std::min(stride_, other.stride_);
+
+		Word acc = 0;
+		for (size_t k = 0; k < n; k += ROW_ALIGN)
+		{
+			for (size_t l = k; l < k + ROW_ALIGN; ++l)
+				acc |= a[l] & ~b[l];
+
+			if (acc)
+				return false;
+		}
+
+		// the bits of this beyond the width of other are not included in other
+		for (size_t k = n; k < stride_; ++k)
+		{
+			if (a[k])
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief  Clears the bits of row @p i that are set in row @p j of @p other
+	 */
+	void rowAndNot(size_t i, const BitMatrix& other, size_t j)
+	{
+		Word* a = this->row(i);
+		const Word* b = other.row(j);
+		const size_t n = std::min(stride_, other.stride_);
+
+		for (size_t k = 0; k < n; ++k)
+			a[k] &= ~b[k];
+	}
+
+	/**
+	 * @brief  Element-wise conjunction with a matrix of the same dimensions
+	 */
+	BitMatrix& operator&=(const BitMatrix& other)
+	{
+		assert((rows_ == other.rows_) && (cols_ == other.cols_));
+
+		const size_t n = data_.size();
+		for (size_t k = 0; k < n; ++k)
+			data_[k] &= other.data_[k];
+
+		return *this;
+	}
+
+	/**
+	 * @brief  Stores the transposition of the matrix into @p dst
+	 */
+	void transpose(BitMatrix& dst) const
+	{
+		assert(&dst != this);
+
+		dst.assign(cols_, rows_, false);
+		for (size_t i = 0; i < rows_; ++i)
+		{
+			this->forEachInRow(i, [&dst, i](size_t j) {
+				dst.set(j, i);
+			});
+		}
+	}
+
+	/**
+	 * @brief  Calls @p f for the index of each set element of row @p i
+	 *
+	 * The indices are visited in the increasing order.
+	 */
+	template <class F>
+	void forEachInRow(size_t i, F f) const
+	{
+		const Word* r = this->row(i);
+		for (size_t k = 0; k < stride_; ++k)
+		{
+			for (Word w = r[k]; w; w &= w - 1)
+				f(k * WORD_BITS + __builtin_ctzll(w));
+		}
+	}
+
+	/**
+	 * @brief  Builds an index of the relation
+	 *
+	 * For each row @p i, @p dst[i] is the sorted list of the columns @p j such
+	 * that the element [i][j] is set.  The previous contents of @p dst is
+	 * replaced.
+	 */
+	void buildIndex(std::vector<std::vector<size_t>>& dst) const
+	{
+		dst.resize(rows_);
+		for (size_t i = 0; i < rows_; ++i)
+		{
+			std::vector<size_t>& dstRow = dst[i];
+			dstRow.clear();
+			this->forEachInRow(i, [&dstRow](size_t j) {
+				dstRow.push_back(j);
+			});
+		}
+	}
+
+	bool operator==(const BitMatrix& other) const
+	{
+		return (rows_ == other.rows_)
+			&& (cols_ == other.cols_)
+			&& (data_ == other.data_);
+	}
+
+	bool operator!=(const BitMatrix& other) const
+	{
+		return !(*this == other);
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const BitMatrix& mat)
+	{
+		for (size_t i = 0; i < mat.rows_; ++i)
+		{
+			for (size_t j = 0; j < mat.cols_; ++j)
+				os << mat.get(i, j);
+
+			os << std::endl;
+		}
+
+		return os;
+	}
+};
+
+#endif
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BOUNDED_CACHE_H
+#define BOUNDED_CACHE_H
+
+// Standard library headers
+#include <cassert>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @brief  The weight of an entry of BoundedCache that bounds the number of
+ *         entries
+ */
+struct EntryCount
+{
+	template <class Key, class Value>
+	size_t operator()(const Key&, const Value&) const
+	{
+		return 1;
+	}
+};
+
+/**
+ * @brief  A map of memoised results with a bounded total weight of entries
+ *
+ * The weight of an entry is given by @p Weight, e.g. the number of bytes it
+ * takes, by default every entry weighs 1 and the capacity is the number of
+ * entries.  Once the cache is full, inserting a new entry drops the entries
+ * that have not been looked up for the longest time.  An entry heavier than
+ * the capacity is kept alone.  References to the values stay valid until the
+ * entry is dropped, i.e. until the next insertion of another key.
+ *
+ * The cache is not synchronised, each worker thread is supposed to use its
+ * own instance.
+ */
+template <class Key, class Value, class Hash = std::hash<Key>,
+	class Weight = EntryCount>
+class BoundedCache
+{
+private:  // data types
+
+	typedef std::list<const Key*> use_list_type;
+
+	struct Slot
+	{
+		Value value;
+		size_t weight;
+		typename use_list_type::iterator use;
+	};
+
+	typedef std::unordered_map<Key, Slot, Hash> map_type;
+
+private:  // data members
+
+	/// the maximal total weight of the entries, zero means nothing is ever kept
+	size_t capacity_;
+
+	/// the total weight of the entries
+	size_t weight_;
+
+	map_type map_;
+
+	/// the keys of the entries, the most recently used ones first
+	use_list_type uses_;
+
+private:  // methods
+
+	BoundedCache(const BoundedCache&);
+	BoundedCache& operator=(const BoundedCache&);
+
+	void touch(Slot& slot)
+	{
+		uses_.splice(uses_.begin(), uses_, slot.use);
+	}
+
+	/**
+	 * @brief  Drops the least recently used entries until @p weight more fits
+	 *
+	 * The most recently used entry is kept if @p keepFirst is @p true.
+	 */
+	void evict(size_t weight, bool keepFirst)
+	{
+		while ((uses_.size() > (keepFirst ? 1 : 0)) && (weight_ + weight > capacity_))
+		{
+			typename map_type::iterator i = map_.find(*uses_.back());
+			weight_ -= i->second.weight;
+			map_.erase(i);
+			uses_.pop_back();
+		}
+	}
+
+	/**
+	 * @brief  Updates the weight of the (most recently used) entry @p i
+	 */
+	void updateWeight(typename map_type::iterator i)
+	{
+		weight_ -= i->second.weight;
+		i->second.weight = Weight()(i->first, i->second.value);
+		this->evict(i->second.weight, true);
+		weight_ += i->second.weight;
+	}
+
+public:   // methods
+
+	explicit BoundedCache(size_t capacity) :
+		capacity_(capacity),
+		weight_(0),
+		map_(),
+		uses_()
+	{ }
+
+	size_t capacity() const
+	{
+		return capacity_;
+	}
+
+	size_t size() const
+	{
+		return map_.size();
+	}
+
+	/**
+	 * @brief  The total weight of the entries
+	 */
+	size_t weight() const
+	{
+		return weight_;
+	}
+
+	/**
+	 * @brief  Looks up the value memoised for @p key
+	 *
+	 * @returns  The value, or @p nullptr if there is none
+	 */
+	Value* find(const Key& key)
+	{
+		typename map_type::iterator i = map_.find(key);
+		if (map_.end() == i)
+			return nullptr;
+
+		this->touch(i->second);
+		return &i->second.value;
+	}
+
+	/**
+	 * @brief  Memoises @p value for @p key, replaces the previous value if any
+	 *
+	 * Must not be called on a cache of zero capacity.
+	 */
+	Value& insert(const Key& key, Value value)
+	{
+		assert(capacity_);
+
+		typename map_type::iterator i = map_.find(key);
+		if (map_.end() != i)
+		{
+			this->touch(i->second);
+			i->second.value = std::move(value);
+			this->updateWeight(i);
+			return i->second.value;
+		}
+
+		const size_t weight = Weight()(key, value);
+		this->evict(weight, false);
+
+		i = map_.insert(
+			std::make_pair(key, Slot{std::move(value), weight, uses_.end()})
+		).first;
+
+		weight_ += weight;
+		uses_.push_front(&i->first);
+		i->second.use = uses_.begin();
+		return i->second.value;
+	}
+
+	/**
+	 * @brief  Takes the weight of the value memoised for @p key again
+	 *
+	 * To be called whenever the value is changed in place.  The entry becomes
+	 * the most recently used one, the other entries are dropped as long as the
+	 * cache overflows.
+	 */
+	void reweigh(const Key& key)
+	{
+		typename map_type::iterator i = map_.find(key);
+		assert(map_.end() != i);
+
+		this->touch(i->second);
+		this->updateWeight(i);
+	}
+
+	/**
+	 * @brief  Returns the value memoised for @p key, a default one is inserted
+	 *         if there is none
+	 *
+	 * The weight of the default value is taken, see @p reweigh() when the
+	 * value is changed afterwards.
+	 */
+	Value& lookup(const Key& key)
+	{
+		Value* value = this->find(key);
+		return (value) ? (*value) : (this->insert(key, Value()));
+	}
+
+	void clear()
+	{
+		weight_ = 0;
+		map_.clear();
+		uses_.clear();
+	}
+};
+
+#endif
@@ -353,6 +353,21 @@ public:
 		return inputIndex_;
 	}
 
+	const ConnectionGraph::CutpointSignature& getInputSignature() const
+	{
+		return inputSignature_;
+	}
+
+	const std::vector<size_t>& getInputMap() const
+	{
+		return inputMap_;
+	}
+
+	const std::vector<std::pair<size_t,size_t>>& getSelectors() const
+	{
+		return selectors_;
+	}
+
 	static bool equal(const TreeAut& a, const TreeAut& b)
 	{
 		return TreeAut::subseteq(a, b) && TreeAut::subseteq(b, a);
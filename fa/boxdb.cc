@@ -0,0 +1,833 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+
+// POSIX headers
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Forester headers
+#include "boxdb.hh"
+#include "boxman.hh"
+#include "streams.hh"
+
+namespace
+{
+/// the magic number at the beginning of a database file
+const char BOX_DB_MAGIC[8] = { 'F', 'A', 'B', 'O', 'X', 'D', 'B', '\n' };
+
+/// the version of the format of a database file
+const uint32_t BOX_DB_VERSION = 1;
+
+/**
+ * @brief  Kinds of records in a database file
+ */
+enum class record_e : uint8_t
+{
+	r_sel,            ///< a selector box
+	r_type,           ///< a type box (refers to a type of the program)
+	r_label,          ///< a label of transitions
+	r_box             ///< a box with nested tree automata
+};
+
+/**
+ * @brief  Kinds of labels in a database file
+ */
+enum class label_e : uint8_t
+{
+	l_data,           ///< a data label
+	l_node            ///< a node label (a vector of boxes)
+};
+
+
+/**
+ * @brief  Writes boxes into a database file
+ *
+ * Each record is written at most once and before the first record that refers
+ * to it; records are referred to by their index within their kind.
+ */
+class BoxDbWriter
+{
+private:  // data members
+
+	std::ostream& os_;
+
+	std::unordered_map<const AbstractBox*, uint32_t> boxes_;
+	std::unordered_map<const NodeLabel*, uint32_t> labels_;
+
+private:  // methods
+
+	BoxDbWriter(const BoxDbWriter&);
+	BoxDbWriter& operator=(const BoxDbWriter&);
+
+	template <class V>
+	void put(V value)
+	{
+		os_.write(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+	void putSize(size_t value)
+	{
+		this->put(static_cast<uint64_t>(value));
+	}
+
+	void putString(const std::string& str)
+	{
+		this->putSize(str.size());
+		os_.write(str.data(), str.size());
+	}
+
+	void putSelData(const SelData& sel)
+	{
+		this->putSize(sel.offset);
+		this->put(static_cast<int32_t>(sel.size));
+		this->put(static_cast<int32_t>(sel.displ));
+		this->putString(sel.name);
+	}
+
+	void putData(const Data& data)
+	{
+		this->put(static_cast<uint8_t>(data.type));
+		this->put(static_cast<int32_t>(data.size));
+
+		switch (data.type)
+		{
+			case data_type_e::t_void_ptr:
+				this->putSize(data.d_void_ptr_size); break;
+			case data_type_e::t_ref:
+				this->putSize(data.d_ref.root);
+				this->put(static_cast<int32_t>(data.d_ref.displ)); break;
+			case data_type_e::t_int:
+				this->put(static_cast<int32_t>(data.d_int)); break;
+			case data_type_e::t_bool:
+				this->put(static_cast<uint8_t>(data.d_bool)); break;
+			case data_type_e::t_struct:
+				this->putSize(data.GetStruct().size());
+				for (const Data::item_info& item : data.GetStruct())
+				{
+					this->putSize(item.first);
+					this->putData(item.second);
+				}
+				break;
+			case data_type_e::t_native_ptr:
+				throw std::runtime_error("BoxDb::save(): native pointers cannot be stored");
+			default:
+				break;
+		}
+	}
+
+	void putSet(const ConnectionGraph::SelectorSet& s)
+	{
+		this->putSize(s.size());
+		for (size_t x : s)
+			this->putSize(x);
+	}
+
+	void putSignature(const ConnectionGraph::CutpointSignature& signature)
+	{
+		this->putSize(signature.size());
+		for (const ConnectionGraph::CutpointInfo& cutpoint : signature)
+		{
+			this->putSize(cutpoint.root);
+			this->putSize(cutpoint.refCount);
+			this->putSize(cutpoint.selCount);
+			this->put(static_cast<uint8_t>(cutpoint.refInherited));
+			this->putSet(cutpoint.fwdSelectors);
+			this->putSize(cutpoint.bwdSelector);
+			this->putSet(cutpoint.defines);
+		}
+	}
+
+	void putTA(const TreeAut& ta)
+	{
+		this->putSize(ta.getFinalStates().size());
+		for (size_t state : ta.getFinalStates())
+			this->putSize(state);
+
+		this->putSize(ta.getTransitions().size());
+		for (const TreeAut::Transition& trans : ta)
+		{
+			this->put(labels_.at(&*trans.label()));
+			this->putSize(trans.rhs());
+			this->putSize(trans.lhs().size());
+			for (size_t state : trans.lhs())
+				this->putSize(state);
+		}
+	}
+
+	uint32_t writeAbstractBox(const AbstractBox* aBox)
+	{
+		auto iter = boxes_.find(aBox);
+		if (boxes_.end() != iter)
+			return iter->second;
+
+		switch (aBox->getType())
+		{
+			case box_type_e::bSel:
+				this->put(record_e::r_sel);
+				this->putSelData(static_cast<const SelBox*>(aBox)->getData());
+				break;
+
+			case box_type_e::bTypeInfo:
+			{
+				const TypeBox* typeBox = static_cast<const TypeBox*>(aBox);
+				this->put(record_e::r_type);
+				this->putString(typeBox->getName());
+				this->putSize(typeBox->getSelectors().size());
+				for (size_t sel : typeBox->getSelectors())
+					this->putSize(sel);
+				break;
+			}
+
+			case box_type_e::bBox:
+				return this->writeBox(static_cast<const Box*>(aBox));
+
+			default:
+				assert(false);     // fail gracefully
+				throw std::runtime_error("BoxDb::save(): unknown box type");
+		}
+
+		uint32_t index = boxes_.size();
+		boxes_.insert(std::make_pair(aBox, index));
+		return index;
+	}
+
+	void writeLabel(label_type label)
+	{
+		if (labels_.count(&*label))
+			return;
+
+		if (label->isData())
+		{
+			this->put(record_e::r_label);
+			this->put(label_e::l_data);
+			this->putData(label->getData());
+		} else if (label->isNode())
+		{
+			std::vector<uint32_t> boxIndices;
+			for (const AbstractBox* aBox : label->getNode())
+				boxIndices.push_back(this->writeAbstractBox(aBox));
+
+			this->put(record_e::r_label);
+			this->put(label_e::l_node);
+			this->putSize(boxIndices.size());
+			for (uint32_t index : boxIndices)
+				this->put(index);
+
+			const std::vector<SelData>* sels = label->node.sels;
+			this->put(static_cast<uint8_t>(nullptr != sels));
+			if (nullptr != sels)
+			{
+				this->putSize(sels->size());
+				for (const SelData& sel : *sels)
+					this->putSelData(sel);
+			}
+		} else
+		{
+			throw std::runtime_error("BoxDb::save(): unsupported label in a box");
+		}
+
+		uint32_t index = labels_.size();
+		labels_.insert(std::make_pair(&*label, index));
+	}
+
+	void writeLabels(const TreeAut& ta)
+	{
+		for (const TreeAut::Transition& trans : ta)
+			this->writeLabel(trans.label());
+	}
+
+public:   // methods
+
+	explicit BoxDbWriter(std::ostream& os) :
+		os_(os),
+		boxes_{},
+		labels_{}
+	{
+		os_.write(BOX_DB_MAGIC, sizeof(BOX_DB_MAGIC));
+		this->put(BOX_DB_VERSION);
+	}
+
+	uint32_t writeBox(const Box* box)
+	{
+		auto iter = boxes_.find(box);
+		if (boxes_.end() != iter)
+			return iter->second;
+
+		// first write everything the box refers to
+		this->writeLabels(*box->getOutput());
+		if (nullptr != box->getInput())
+			this->writeLabels(*box->getInput());
+
+		this->put(record_e::r_box);
+		this->putTA(*box->getOutput());
+		this->put(static_cast<uint8_t>(nullptr != box->getInput()));
+		if (nullptr != box->getInput())
+			this->putTA(*box->getInput());
+
+		this->putSignature(box->getOutputSignature());
+		this->putSize(box->getInputMap().size());
+		for (size_t sel : box->getInputMap())
+			this->putSize(sel);
+		this->putSize(box->getInputIndex());
+		this->putSignature(box->getInputSignature());
+		this->putSize(box->getSelectors().size());
+		for (const std::pair<size_t, size_t>& sel : box->getSelectors())
+		{
+			this->putSize(sel.first);
+			this->putSize(sel.second);
+		}
+
+		uint32_t index = boxes_.size();
+		boxes_.insert(std::make_pair(box, index));
+		return index;
+	}
+};
+
+
+/**
+ * @brief  Reads boxes from a (mapped) database file
+ *
+ * Records that refer to something not present in the analysed program are
+ * kept as @p nullptr so that the records after them can still be read.
+ */
+class BoxDbReader
+{
+private:  // data members
+
+	const char* pos_;
+	const char* end_;
+
+	BoxMan& boxMan_;
+	TreeAut::Backend& backend_;
+
+	std::vector<const AbstractBox*> boxes_;
+	std::vector<const NodeLabel*> labels_;
+
+	size_t loaded_;
+
+private:  // methods
+
+	BoxDbReader(const BoxDbReader&);
+	BoxDbReader& operator=(const BoxDbReader&);
+
+	void need(size_t size) const
+	{
+		if (static_cast<size_t>(end_ - pos_) < size)
+			throw std::runtime_error("BoxDb::load(): truncated database");
+	}
+
+	template <class V>
+	V get()
+	{
+		this->need(sizeof(V));
+		V value;
+		std::memcpy(&value, pos_, sizeof(V));
+		pos_ += sizeof(V);
+		return value;
+	}
+
+	size_t getSize()
+	{
+		return static_cast<size_t>(this->get<uint64_t>());
+	}
+
+	/**
+	 * @brief  Reads the number of the items that follow
+	 *
+	 * The count is checked against the bytes left before anything is
+	 * allocated for it, so that a corrupted count does not exhaust memory.
+	 *
+	 * @param[in]  itemSize  The least number of bytes an item takes
+	 */
+	size_t getCount(size_t itemSize)
+	{
+		uint64_t count = this->get<uint64_t>();
+		if (static_cast<uint64_t>(end_ - pos_) / itemSize < count)
+			throw std::runtime_error("BoxDb::load(): truncated database");
+
+		return static_cast<size_t>(count);
+	}
+
+	std::string getString()
+	{
+		size_t size = this->getSize();
+		this->need(size);
+		std::string str(pos_, size);
+		pos_ += size;
+		return str;
+	}
+
+	SelData getSelData()
+	{
+		size_t offset = this->getSize();
+		int size = this->get<int32_t>();
+		int displ = this->get<int32_t>();
+		return SelData(offset, size, displ, this->getString());
+	}
+
+	Data getData()
+	{
+		data_type_e type = static_cast<data_type_e>(this->get<uint8_t>());
+		int size = this->get<int32_t>();
+
+		Data data;
+		switch (type)
+		{
+			case data_type_e::t_undef:
+			case data_type_e::t_unknw:
+			case data_type_e::t_other:
+				data = Data(type); break;
+			case data_type_e::t_void_ptr:
+				data = Data::createVoidPtr(this->getSize()); break;
+			case data_type_e::t_ref:
+			{
+				size_t root = this->getSize();
+				data = Data::createRef(root, this->get<int32_t>());
+				break;
+			}
+			case data_type_e::t_int:
+				data = Data::createInt(this->get<int32_t>()); break;
+			case data_type_e::t_bool:
+				data = Data::createBool(this->get<uint8_t>()); break;
+			case data_type_e::t_struct:
+			{
+				std::vector<Data::item_info> items;
+				for (size_t n = this->getSize(); n; --n)
+				{
+					size_t offset = this->getSize();
+					items.push_back(Data::item_info(offset, this->getData()));
+				}
+				data = Data::createStruct(items);
+				break;
+			}
+			default:
+				throw std::runtime_error("BoxDb::load(): corrupted data");
+		}
+
+		data.size = size;
+		return data;
+	}
+
+	ConnectionGraph::SelectorSet getSet()
+	{
+		ConnectionGraph::SelectorSet s;
+		for (size_t n = this->getSize(); n; --n)
+			s.insert(this->getSize());
+
+		return s;
+	}
+
+	ConnectionGraph::CutpointSignature getSignature()
+	{
+		ConnectionGraph::CutpointSignature signature(
+			this->getCount(6 * sizeof(uint64_t) + sizeof(uint8_t)));
+		for (ConnectionGraph::CutpointInfo& cutpoint : signature)
+		{
+			cutpoint.root = this->getSize();
+			cutpoint.refCount = this->getSize();
+			cutpoint.selCount = this->getSize();
+			cutpoint.refInherited = this->get<uint8_t>();
+			cutpoint.fwdSelectors = this->getSet();
+			cutpoint.bwdSelector = this->getSize();
+			cutpoint.defines = this->getSet();
+		}
+
+		return signature;
+	}
+
+	const AbstractBox* getAbstractBox()
+	{
+		uint32_t index = this->get<uint32_t>();
+		if (index >= boxes_.size())
+			throw std::runtime_error("BoxDb::load(): dangling box reference");
+
+		return boxes_[index];
+	}
+
+	/**
+	 * @brief  Reads a tree automaton
+	 *
+	 * @returns  The tree automaton or @p nullptr if it uses unavailable labels
+	 */
+	std::shared_ptr<TreeAut> getTA()
+	{
+		std::shared_ptr<TreeAut> ta(new TreeAut(backend_));
+		bool valid = true;
+
+		for (size_t n = this->getSize(); n; --n)
+			ta->addFinalState(this->getSize());
+
+		std::vector<size_t> lhs;
+		for (size_t n = this->getSize(); n; --n)
+		{
+			uint32_t index = this->get<uint32_t>();
+			if (index >= labels_.size())
+				throw std::runtime_error("BoxDb::load(): dangling label reference");
+
+			size_t rhs = this->getSize();
+			lhs.resize(this->getCount(sizeof(uint64_t)));
+			for (size_t& state : lhs)
+				state = this->getSize();
+
+			if (nullptr == labels_[index])
+				valid = false;
+			else if (valid)
+				ta->addTransition(lhs, labels_[index], rhs);
+		}
+
+		if (!valid)
+			return std::shared_ptr<TreeAut>(nullptr);
+
+		return ta;
+	}
+
+	void readSel()
+	{
+		boxes_.push_back(boxMan_.getSelector(this->getSelData()));
+	}
+
+	void readType()
+	{
+		std::string name = this->getString();
+		std::vector<size_t> selectors(this->getCount(sizeof(uint64_t)));
+		for (size_t& sel : selectors)
+			sel = this->getSize();
+
+		const TypeBox* typeBox = nullptr;
+		try
+		{
+			typeBox = boxMan_.getTypeInfo(name);
+		}
+		catch (const std::runtime_error&)
+		{ }
+
+		if ((nullptr != typeBox) && (typeBox->getSelectors() != selectors))
+		{	// a type of the same name, but a different layout
+			FA_DEBUG_AT(1, "box database: type " << name << " has changed");
+			typeBox = nullptr;
+		}
+
+		boxes_.push_back(typeBox);
+	}
+
+	void readLabel()
+	{
+		label_e kind = this->get<label_e>();
+		if (label_e::l_data == kind)
+		{
+			labels_.push_back(&*boxMan_.lookupLabel(this->getData()));
+			return;
+		}
+
+		if (label_e::l_node != kind)
+			throw std::runtime_error("BoxDb::load(): corrupted label");
+
+		std::vector<const AbstractBox*> node(this->getCount(sizeof(uint32_t)));
+		bool valid = true;
+		for (const AbstractBox*& aBox : node)
+		{
+			aBox = this->getAbstractBox();
+			valid = valid && (nullptr != aBox);
+		}
+
+		std::vector<SelData> sels;
+		bool hasSels = this->get<uint8_t>();
+		if (hasSels)
+		{
+			for (size_t n = this->getSize(); n; --n)
+				sels.push_back(this->getSelData());
+		}
+
+		if (!valid)
+		{
+			labels_.push_back(nullptr);
+			return;
+		}
+
+		const std::vector<SelData>* nodeInfo = nullptr;
+		if (hasSels)
+		{	// the selectors are described by the type of the node
+			auto typeIter = std::find_if(node.begin(), node.end(),
+				[](const AbstractBox* aBox){ return aBox->isType(box_type_e::bTypeInfo); });
+			if (node.end() != typeIter)
+			{
+				nodeInfo = boxMan_.LookupTypeDesc(
+					static_cast<const TypeBox*>(*typeIter), sels);
+			}
+		}
+
+		labels_.push_back(&*boxMan_.lookupLabel(node, nodeInfo));
+	}
+
+	void readBox()
+	{
+		std::shared_ptr<TreeAut> output = this->getTA();
+		std::shared_ptr<TreeAut> input;
+		bool valid = (nullptr != output);
+		if (this->get<uint8_t>())
+		{
+			input = this->getTA();
+			valid = valid && (nullptr != input);
+		}
+
+		ConnectionGraph::CutpointSignature outputSignature = this->getSignature();
+		std::vector<size_t> inputMap(this->getCount(sizeof(uint64_t)));
+		for (size_t& sel : inputMap)
+			sel = this->getSize();
+		size_t inputIndex = this->getSize();
+		ConnectionGraph::CutpointSignature inputSignature = this->getSignature();
+		std::vector<std::pair<size_t, size_t>> selectors(
+			this->getCount(2 * sizeof(uint64_t)));
+		for (std::pair<size_t, size_t>& sel : selectors)
+		{
+			sel.first = this->getSize();
+			sel.second = this->getSize();
+		}
+
+		if (!valid)
+		{
+			boxes_.push_back(nullptr);
+			return;
+		}
+
+		boxes_.push_back(boxMan_.loadBox(Box(
+			"",
+			output,
+			outputSignature,
+			inputMap,
+			input,
+			inputIndex,
+			inputSignature,
+			selectors
+		)));
+
+		++loaded_;
+	}
+
+public:   // methods
+
+	BoxDbReader(
+		const char*                begin,
+		const char*                end,
+		BoxMan&                    boxMan,
+		TreeAut::Backend&          backend) :
+		pos_(begin),
+		end_(end),
+		boxMan_(boxMan),
+		backend_(backend),
+		boxes_{},
+		labels_{},
+		loaded_(0)
+	{ }
+
+	size_t read()
+	{
+		this->need(sizeof(BOX_DB_MAGIC));
+		if (std::memcmp(pos_, BOX_DB_MAGIC, sizeof(BOX_DB_MAGIC)))
+			throw std::runtime_error("BoxDb::load(): not a box database");
+		pos_ += sizeof(BOX_DB_MAGIC);
+
+		if (this->get<uint32_t>() != BOX_DB_VERSION)
+			throw std::runtime_error("BoxDb::load(): unsupported version of the database");
+
+		while (pos_ != end_)
+		{
+			switch (this->get<record_e>())
+			{
+				case record_e::r_sel:   this->readSel(); break;
+				case record_e::r_type:  this->readType(); break;
+				case record_e::r_label: this->readLabel(); break;
+				case record_e::r_box:   this->readBox(); break;
+				default:
+					throw std::runtime_error("BoxDb::load(): corrupted record");
+			}
+		}
+
+		return loaded_;
+	}
+};
+
+
+/**
+ * @brief  A read-only memory mapping of a file
+ */
+class MappedFile
+{
+private:  // data members
+
+	void* addr_;
+	size_t size_;
+
+private:  // methods
+
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+public:   // methods
+
+	explicit MappedFile(int fd) :
+		addr_(MAP_FAILED),
+		size_(0)
+	{
+		struct stat st;
+		if (fstat(fd, &st))
+			throw std::runtime_error(std::string("BoxDb::load(): ") + std::strerror(errno));
+
+		size_ = st.st_size;
+		if (0 == size_)
+			return;
+
+		addr_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (MAP_FAILED == addr_)
+			throw std::runtime_error(std::string("BoxDb::load(): ") + std::strerror(errno));
+	}
+
+	const char* begin() const
+	{
+		return (MAP_FAILED == addr_)? nullptr : static_cast<const char*>(addr_);
+	}
+
+	const char* end() const
+	{
+		return this->begin() + size_;
+	}
+
+	~MappedFile()
+	{
+		if (MAP_FAILED != addr_)
+			munmap(addr_, size_);
+	}
+};
+
+/**
+ * @brief  Retrieves all boxes of a box manager in the order of their names
+ */
+std::vector<const Box*> orderedBoxes(const BoxMan& boxMan)
+{
+	std::vector<const Box*> boxes;
+	boxMan.boxDatabase().asVector(boxes);
+
+	std::sort(boxes.begin(), boxes.end(),
+		[](const Box* lhs, const Box* rhs){ return lhs->getName() < rhs->getName(); });
+
+	return boxes;
+}
+} // namespace
+
+
+size_t BoxDb::load(
+	const std::string&             fileName,
+	BoxMan&                        boxMan,
+	TreeAut::Backend&              backend)
+{
+	int fd = open(fileName.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		if (ENOENT == errno)
+			return 0;
+
+		throw std::runtime_error("BoxDb::load(): unable to open " + fileName);
+	}
+
+	std::unique_ptr<MappedFile> file;
+	try
+	{
+		file.reset(new MappedFile(fd));
+	}
+	catch (...)
+	{
+		close(fd);
+		throw;
+	}
+
+	close(fd);
+
+	if (nullptr == file->begin())
+		return 0;
+
+	return BoxDbReader(file->begin(), file->end(), boxMan, backend).read();
+}
+
+
+size_t BoxDb::save(
+	const std::string&             fileName,
+	const BoxMan&                  boxMan)
+{
+	std::vector<const Box*> boxes = orderedBoxes(boxMan);
+
+	// write into a temporary file first so that the database is never broken
+	std::string tmpName = fileName + ".tmp";
+	std::ofstream os(tmpName.c_str(), std::ios::binary | std::ios::trunc);
+	if (!os.good())
+		throw std::runtime_error("BoxDb::save(): unable to open " + tmpName);
+
+	try
+	{
+		BoxDbWriter writer(os);
+		for (const Box* box : boxes)
+			writer.writeBox(box);
+	}
+	catch (...)
+	{
+		os.close();
+		std::remove(tmpName.c_str());
+		throw;
+	}
+
+	os.close();
+	if (os.fail() || std::rename(tmpName.c_str(), fileName.c_str()))
+	{
+		std::remove(tmpName.c_str());
+		throw std::runtime_error("BoxDb::save(): unable to write " + fileName);
+	}
+
+	return boxes.size();
+}
+
+
+void BoxDb::exportTimbuk(
+	std::ostream&                  os,
+	const BoxMan&                  boxMan)
+{
+	TAWriter<label_type> writer(os);
+
+	for (const Box* box : orderedBoxes(boxMan))
+	{
+		writer.writeOne(*box->getOutput(), box->getName() + "_output");
+		writer.endl();
+
+		if (nullptr != box->getInput())
+		{
+			writer.writeOne(*box->getInput(), box->getName() + "_input");
+			writer.endl();
+		}
+	}
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BOX_DB_H
+#define BOX_DB_H
+
+/**
+ * @file boxdb.hh
+ * BoxDb - a persistent database of boxes
+ */
+
+// Standard library headers
+#include <ostream>
+#include <string>
+
+// Forester headers
+#include "treeaut_label.hh"
+
+class BoxMan;
+
+/**
+ * @brief  A persistent database of boxes
+ *
+ * The database keeps the boxes of a @p BoxMan in a compact binary file so that
+ * a later analysis of related code may start with them instead of learning them
+ * again (and restarting after each of them). The file is a sequence of records
+ * (selectors, types, labels and boxes), each of them referring only to the
+ * records before it, so that it can be read in a single pass over the mapped
+ * file.
+ */
+class BoxDb
+{
+public:   // methods
+
+	/**
+	 * @brief  Loads boxes from a database file
+	 *
+	 * Loads the boxes stored in the file @p fileName into @p boxMan. Boxes that
+	 * refer to types not declared in the analysed program (or declared with
+	 * different selectors) are skipped. A missing file is an empty database.
+	 *
+	 * @param[in]      fileName  The name of the database file
+	 * @param[in,out]  boxMan    The box manager to receive the boxes
+	 * @param[in]      backend   The backend for the tree automata of the boxes
+	 *
+	 * @returns  The number of loaded boxes
+	 */
+	static size_t load(
+		const std::string&             fileName,
+		BoxMan&                        boxMan,
+		TreeAut::Backend&              backend);
+
+
+	/**
+	 * @brief  Stores boxes into a database file
+	 *
+	 * Stores all boxes of @p boxMan (i.e. both the loaded and the newly learnt
+	 * ones) into the file @p fileName. The file is replaced atomically.
+	 *
+	 * @param[in]  fileName  The name of the database file
+	 * @param[in]  boxMan    The box manager with the boxes
+	 *
+	 * @returns  The number of stored boxes
+	 */
+	static size_t save(
+		const std::string&             fileName,
+		const BoxMan&                  boxMan);
+
+
+	/**
+	 * @brief  Exports boxes in the Timbuk format
+	 *
+	 * Writes the tree automata of all boxes of @p boxMan to @p os in the Timbuk
+	 * format (for debugging purposes).
+	 *
+	 * @param[out]  os      The output stream
+	 * @param[in]   boxMan  The box manager with the boxes
+	 */
+	static void exportTimbuk(
+		std::ostream&                  os,
+		const BoxMan&                  boxMan);
+};
+
+#endif
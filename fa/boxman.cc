@@ -168,6 +168,8 @@ void BoxAntichain::asVector(std::vector<const Box*>& boxes) const
 
 const std::pair<const Data, NodeLabel*>& BoxMan::insertData(const Data& data)
 {
+	WorkerLock lock(mutex_);
+
 	std::pair<TDataStore::iterator, bool> p = dataStore_.insert(
 		std::make_pair(data, static_cast<NodeLabel*>(nullptr)));
 
@@ -197,6 +199,8 @@ label_type BoxMan::lookupLabel(
 	size_t                        arity,
 	const DataArray&              x)
 {
+	WorkerLock lock(mutex_);
+
 	std::pair<TVarDataStore::iterator, bool> p = vDataStore_.insert(
 		std::make_pair(std::make_pair(arity, x), static_cast<NodeLabel*>(nullptr)));
 	if (p.second)
@@ -248,6 +252,8 @@ label_type BoxMan::lookupLabel(
 	const std::vector<const AbstractBox*>&     x,
 	const std::vector<SelData>*                nodeInfo)
 {
+	WorkerLock lock(mutex_);
+
 	std::pair<TNodeStore::iterator, bool> p = nodeStore_.insert(
 		std::make_pair(x, static_cast<NodeLabel*>(nullptr)));
 
@@ -282,6 +288,8 @@ label_type BoxMan::lookupLabel(
 
 const SelBox* BoxMan::getSelector(const SelData& sel)
 {
+	WorkerLock lock(mutex_);
+
 	std::pair<const SelData, const SelBox*>& p = *selIndex_.insert(
 		std::make_pair(sel, static_cast<const SelBox*>(nullptr))
 	).first;
@@ -297,6 +305,8 @@ const SelBox* BoxMan::getSelector(const SelData& sel)
 
 const TypeBox* BoxMan::getTypeInfo(const std::string& name)
 {
+	WorkerLock lock(mutex_);
+
 	TTypeIndex::const_iterator i = typeIndex_.find(name);
 	if (i == typeIndex_.end())
 		throw std::runtime_error("BoxMan::getTypeInfo(): type for "
@@ -309,6 +319,8 @@ const TypeBox* BoxMan::createTypeInfo(
 	const std::string&            name,
 	const std::vector<size_t>&    selectors)
 {
+	WorkerLock lock(mutex_);
+
 	std::pair<const std::string, const TypeBox*>& p = *typeIndex_.insert(
 		std::make_pair(name, static_cast<const TypeBox*>(nullptr))).first;
 	if (p.second && (selectors != p.second->getSelectors()))
@@ -413,6 +425,8 @@ Box* BoxMan::createType2Box(
 
 const Box* BoxMan::getBox(const Box& box)
 {
+	WorkerLock lock(mutex_);
+
 	// insert the box into the manager
 	const Box* cpBox = boxes_.get(box);
 	assert(nullptr != cpBox);
@@ -428,6 +442,8 @@ const Box* BoxMan::getBox(const Box& box)
 		FA_DEBUG_AT(1, "learning " << *static_cast<const AbstractBox*>(cpBox)
 			<< ':' << std::endl << *cpBox);
 
+		learnt_.push_back(cpBox);
+
 #if FA_RESTART_AFTER_BOX_DISCOVERY
 		throw RestartRequest("a new box encountered");
 #endif
@@ -437,8 +453,32 @@ const Box* BoxMan::getBox(const Box& box)
 }
 
 
+const Box* BoxMan::loadBox(const Box& box)
+{
+	WorkerLock lock(mutex_);
+
+	const Box* cpBox = boxes_.get(box);
+	assert(nullptr != cpBox);
+
+	if (boxes_.modified())
+	{	// in the case a new box was inserted
+		Box* pBox = const_cast<Box*>(cpBox);
+
+		pBox->name_ = this->getBoxName();
+		pBox->initialize();
+
+		FA_DEBUG_AT(1, "loading " << *static_cast<const AbstractBox*>(cpBox)
+			<< ':' << std::endl << *cpBox);
+	}
+
+	return cpBox;
+}
+
+
 void BoxMan::clear()
 {
+	WorkerLock lock(mutex_);
+
 	utils::eraseMap(dataStore_);
 	dataIndex_.clear();
 	utils::eraseMap(nodeStore_);
@@ -447,4 +487,5 @@ void BoxMan::clear()
 	utils::eraseMap(selIndex_);
 	utils::eraseMap(typeIndex_);
 	boxes_.clear();
+	learnt_.clear();
 }
@@ -27,6 +27,7 @@
 
 // Forester headers
 #include "box.hh"
+#include "workermutex.hh"
 
 class BoxAntichain
 {
@@ -291,6 +292,12 @@ private:  // data members
 
 	TTypeDescDict typeDescDict_;
 
+	/// the boxes learnt since the last call of takeLearntBoxes()
+	std::vector<const Box*> learnt_;
+
+	/// guards all the stores against concurrent workers
+	mutable WorkerMutex mutex_;
+
 private:  // methods
 
 	const std::pair<const Data, NodeLabel*>& insertData(const Data& data);
@@ -319,6 +326,7 @@ public:
 		const TypeBox* tb,
 		const std::vector<SelData>& sels)
 	{
+		WorkerLock lock(mutex_);
 		auto itBoolPair = typeDescDict_.insert(std::make_pair(tb, sels));
 		if (!itBoolPair.second)
 		{	// in case a new element was not inserted
@@ -362,8 +370,16 @@ public:
 		return this->insertData(data).second->getDataId();
 	}
 
-	const Data& getData(size_t index) const
+	/**
+	 * @brief  Returns the data of the given index
+	 *
+	 * The data are returned by value as the index may be extended by other
+	 * workers once the lock is released.
+	 */
+	Data getData(size_t index) const
 	{
+		WorkerLock lock(mutex_);
+
 		// Assertions
 		assert(index < dataIndex_.size());
 
@@ -448,11 +464,49 @@ public:
 	const Box* getBox(const Box& box);
 
 
+	/**
+	 * @brief  Inserts a box loaded from a box database
+	 *
+	 * Unlike BoxMan::getBox(), the box is not considered to be learnt, i.e. it
+	 * does not trigger a restart of the analysis.
+	 *
+	 * @param[in]  box  The box to be inserted in the database
+	 *
+	 * @returns  Unique pointer to the box
+	 */
+	const Box* loadBox(const Box& box);
+
+
 	const Box* lookupBox(const Box& box) const
 	{
+		WorkerLock lock(mutex_);
 		return boxes_.lookup(box);
 	}
 
+	/**
+	 * @brief  Moves the boxes learnt since the last call to @p boxes
+	 *
+	 * @param[out]  boxes  The learnt boxes
+	 */
+	void takeLearntBoxes(std::vector<const Box*>& boxes)
+	{
+		WorkerLock lock(mutex_);
+		boxes.clear();
+		boxes.swap(learnt_);
+	}
+
+	/**
+	 * @brief  The number of boxes in the database
+	 *
+	 * Unlike @p boxDatabase().size(), this may be called while other workers
+	 * are learning boxes.
+	 */
+	size_t boxCount() const
+	{
+		WorkerLock lock(mutex_);
+		return boxes_.size();
+	}
+
 	BoxMan() :
 		dataStore_{},
 		dataIndex_{},
@@ -462,7 +516,9 @@ public:
 		selIndex_{},
 		typeIndex_{},
 		boxes_{},
-		typeDescDict_{}
+		typeDescDict_{},
+		learnt_{},
+		mutex_{}
 	{ }
 
 	~BoxMan()
@@ -30,6 +30,9 @@
 // Boost headers
 #include <boost/functional/hash.hpp>
 
+// Forester headers
+#include "workermutex.hh"
+
 template <class T>
 class Cache
 {
@@ -49,36 +52,45 @@ private:  // data members
 
 	std::vector<Listener*> listeners;
 
+	/// guards the store and the reference counters against concurrent workers
+	mutable WorkerMutex mutex;
+
 public:
 
 	Cache() :
 		store{},
-		listeners{}
+		listeners{},
+		mutex{}
 	{ }
 
 	void addListener(Listener* x)
 	{
+		WorkerLock lock(this->mutex);
 		this->listeners.push_back(x);
 	}
 
 	value_type* find(const T& x)
 	{
+		WorkerLock lock(this->mutex);
 		typename store_type::iterator i = this->store.find(x);
 		return (i == this->store.end())?(nullptr):(&*i);
 	}
 
 	value_type* lookup(const T& x)
 	{
+		WorkerLock lock(this->mutex);
 		return this->addRef(&*this->store.insert(std::make_pair(x, 0)).first);
 	}
 
 	value_type* addRef(value_type* x)
 	{
+		WorkerLock lock(this->mutex);
 		return ++x->second, x;
 	}
 
 	size_t release(value_type* x)
 	{
+		WorkerLock lock(this->mutex);
 		if (x->second > 1)
 			return --x->second;
 
@@ -91,6 +103,7 @@ public:
 
 	void clear()
 	{
+		WorkerLock lock(this->mutex);
 		for (Listener* lsnr : this->listeners)
 		{
 			for (typename store_type::iterator j = this->store.begin(); j != this->store.end(); ++j)
@@ -101,6 +114,7 @@ public:
 
 	bool empty() const
 	{
+		WorkerLock lock(this->mutex);
 		return this->store.empty();
 	}
 };
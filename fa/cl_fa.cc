@@ -19,6 +19,7 @@
 
 // Standard library headers
 #include <ctime>
+#include <fstream>
 #include <signal.h>
 
 // Code Listener headers
@@ -50,30 +51,53 @@ extern "C" {
     __attribute__ ((__visibility__ ("default"))) int plugin_is_GPL_compatible;
 }
 
-#if 0
-struct BoxDb {
-
-	std::unordered_map<std::string, std::string> store;
-
-	BoxDb(const std::string& root, const std::string& fileName) {
-		std::ifstream input((root + "/" + fileName).c_str());
-		if (!input.good())
-			throw std::runtime_error("Unable to open " + root + "/" + fileName);
-		std::string buf;
-		while (std::getline(input, buf)) {
-			if (buf.empty())
-				continue;
-			if (buf[0] == '#')
-				continue;
-			std::vector<std::string> data;
-			boost::split(data, buf, boost::is_from_range(':', ':'));
-			if (data.size() == 2)
-				this->store[data[0]] = root + "/" + data[1];
-		}
+// anonymous namespace
+namespace
+{
+/// the name of the box database file within the database root directory
+const char* const BOX_DB_FILE = "boxes.fadb";
+
+/// the name of the Timbuk export of the box database
+const char* const BOX_DB_EXPORT_FILE = "boxes.tim";
+
+/**
+ * @brief  Stores the boxes of the analysis into the box database
+ *
+ * @param[in]  se    The symbolic execution engine
+ * @param[in]  conf  The configuration of the analysis
+ */
+void saveBoxDb(const SymExec& se, const ProgramConfig& conf)
+{
+	const std::string fileName = conf.dbRoot + "/" + BOX_DB_FILE;
+	const size_t count = se.saveBoxes(fileName);
+	FA_LOG("stored " << count << " box(es) into " << fileName);
+
+	if (conf.exportBoxes)
+	{
+		const std::string exportName = conf.dbRoot + "/" + BOX_DB_EXPORT_FILE;
+		std::ofstream os(exportName.c_str());
+		se.exportBoxes(os);
+		if (!os.good())
+			throw std::runtime_error("unable to write " + exportName);
 	}
+}
 
-};
-#endif
+/**
+ * @brief  Dumps the automata of the fixpoints into a benchmark corpus
+ *
+ * @param[in]  se    The symbolic execution engine
+ * @param[in]  conf  The configuration of the analysis
+ */
+void dumpAutomata(SymExec& se, const ProgramConfig& conf)
+{
+	std::ofstream os(conf.taDump.c_str());
+	const size_t count = se.exportAutomata(os);
+	if (!os.good())
+		throw std::runtime_error("unable to write " + conf.taDump);
+
+	FA_LOG("dumped " << count << " automata into " << conf.taDump);
+}
+} // namespace
 
 void clEasyRun(const CodeStorage::Storage& stor, const char* configString)
 {
@@ -126,12 +150,13 @@ void clEasyRun(const CodeStorage::Storage& stor, const char* configString)
 		FA_LOG("loading types ...");
 		se->loadTypes(stor);
 
-/*
-		if (!conf.dbRoot.empty()){
-			BoxDb db(conf.dbRoot, "index");
-			se.loadBoxes(db.store);
+		if (!conf.dbRoot.empty())
+		{
+			const std::string fileName = conf.dbRoot + "/" + BOX_DB_FILE;
+			FA_LOG("loading boxes from " << fileName << " ...");
+			const size_t count = se->loadBoxes(fileName);
+			FA_LOG("loaded " << count << " box(es)");
 		}
-*/
 
 		FA_LOG("compiling to microcode ...");
 		se->compile(stor, *main);
@@ -155,6 +180,12 @@ void clEasyRun(const CodeStorage::Storage& stor, const char* configString)
 		{
 			FA_LOG("starting symbolic execution ...");
 			se->run();
+
+			if (!conf.dbRoot.empty())
+				saveBoxDb(*se, conf);
+
+			if (!conf.taDump.empty())
+				dumpAutomata(*se, conf);
 		}
 	}
 	catch (const NotImplementedException& e)
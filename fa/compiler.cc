@@ -29,6 +29,7 @@
 #include <sstream>
 #include <cstdlib>
 #include <list>
+#include <unordered_map>
 #include <unordered_set>
 
 // Code Listener headers
@@ -36,6 +37,7 @@
 #include <cl/cldebug.hh>
 
 // Forester headers
+#include "config.h"
 #include "notimpl_except.hh"
 #include "symctx.hh"
 #include "nodebuilder.hh"
@@ -165,6 +167,32 @@ std::string translOperandCode(const unsigned code)
 	}
 }
 
+/**
+ * @brief  Determines whether the result of an assignment is overwritten
+ *
+ * @param[in]  seq  A sequence of pure register assignments
+ * @param[in]  i    Index of the assignment in @p seq
+ *
+ * @returns  @p true if the destination register of @p seq[i] is assigned
+ *           later in @p seq without being read before
+ */
+bool isOverwritten(
+	const std::vector<const PureRegisterAssignment*>&   seq,
+	size_t                                              i)
+{
+	const size_t reg = seq[i]->dstReg();
+	for (size_t j = i + 1; j < seq.size(); ++j)
+	{
+		if (seq[j]->readsReg(reg))
+			return false;
+
+		if (seq[j]->dstReg() == reg)
+			return true;
+	}
+
+	return false;
+}
+
 } // namespace
 
 
@@ -2433,7 +2461,8 @@ public:
 
 Compiler::Compiler(TreeAut::Backend& fixpointBackend,
 	TreeAut::Backend& taBackend, BoxMan& boxMan)
-	: core_(new Core(fixpointBackend, taBackend, boxMan))
+	: core_(new Core(fixpointBackend, taBackend, boxMan)),
+	fuseMicrocode_(FA_FUSE_MICROCODE)
 { }
 
 
@@ -2447,4 +2476,85 @@ void Compiler::compile(Compiler::Assembly& assembly,
 	const CodeStorage::Storage& stor, const CodeStorage::Fnc& entry)
 {
 	core_->compile(assembly, stor, entry);
+
+	if (fuseMicrocode_)
+	{	// fuse the sequences of register assignments
+		fuse(assembly);
+	}
+}
+
+
+void Compiler::setFuseMicrocode(bool enabled)
+{
+	fuseMicrocode_ = enabled;
 }
+
+
+void Compiler::fuse(Compiler::Assembly& assembly)
+{
+	Compiler::Assembly::CodeList& code = assembly.code_;
+	Compiler::Assembly::CodeList result;
+
+	// the first instructions of the fused sequences and the fused instructions
+	std::unordered_map<AbstractInstruction*, AbstractInstruction*> fused;
+	std::unordered_set<const AbstractInstruction*> members;
+
+	for (AbstractInstruction* instr : code)
+	{
+		PureRegisterAssignment* cur = dynamic_cast<PureRegisterAssignment*>(instr);
+
+		// a target may be entered by jumps and the first instruction of the code
+		// is entered by the execution manager, they cannot be redirected
+		if ((nullptr == cur) || cur->isTarget() || (instr == code.front())
+			|| members.count(instr))
+		{
+			result.push_back(instr);
+			continue;
+		}
+
+		std::vector<const PureRegisterAssignment*> seq;
+		do
+		{
+			seq.push_back(cur);
+			cur = dynamic_cast<PureRegisterAssignment*>(cur->next());
+		} while ((nullptr != cur) && !cur->isTarget()
+			&& (cur->insn() == instr->insn()) && (cur != instr));
+
+		if (seq.size() < 2)
+		{
+			result.push_back(instr);
+			continue;
+		}
+
+		std::vector<const PureRegisterAssignment*> body;
+		for (size_t i = 0; i < seq.size(); ++i)
+		{
+			members.insert(seq[i]);
+
+			if (seq[i]->mayFail() || !isOverwritten(seq, i))
+				body.push_back(seq[i]);
+		}
+
+		AbstractInstruction* fusedInstr = new FI_fused(
+			instr->insn(), body, seq.back()->next()
+		);
+
+		fused.insert(std::make_pair(instr, fusedInstr));
+		result.push_back(fusedInstr);
+		result.push_back(instr);
+	}
+
+	code.swap(result);
+
+	for (AbstractInstruction* instr : code)
+	{	// redirect the predecessors of the fused sequences
+		SequentialInstruction* seqInstr = dynamic_cast<SequentialInstruction*>(instr);
+		if (nullptr == seqInstr)
+			continue;
+
+		auto iter = fused.find(seqInstr->next());
+		if (iter != fused.end())
+			seqInstr->next(iter->second);
+	}
+}
+
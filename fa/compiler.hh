@@ -330,6 +330,32 @@ public:
 	void compile(Assembly& assembly, const CodeStorage::Storage &stor,
 		const CodeStorage::Fnc& entry);
 
+	/**
+	 * @brief  Sets whether @p compile() fuses the register assignments
+	 *
+	 * @param[in]  enabled  Fuse the sequences of register assignments (see
+	 *                      @p fuse()), the default is FA_FUSE_MICROCODE
+	 */
+	void setFuseMicrocode(bool enabled);
+
+	/**
+	 * @brief  Fuses sequences of pure register assignments
+	 *
+	 * Every sequence of at least two pure register assignments that belong to
+	 * the same instruction in the code storage and that is entered only through
+	 * its first instruction is replaced by a single @p FI_fused instruction.
+	 * The fused instruction is inserted before the sequence (which stays in the
+	 * code, but it is not reachable any more) and the predecessor of the
+	 * sequence is redirected to it. Assignments (that cannot fail) whose result
+	 * is overwritten later in the sequence are left out.
+	 *
+	 * @note  The code has to be finalised, as the sequences follow the links
+	 *        between the instructions and their targets have to be known.
+	 *
+	 * @param[in,out]  assembly  The finalised assembly code
+	 */
+	static void fuse(Assembly& assembly);
+
 private:
 
 	/**
@@ -339,6 +365,9 @@ private:
 
 	/// The core of the compiler
 	Core *core_;
+
+	/// fuse the register assignments of the compiled code?
+	bool fuseMicrocode_;
 };
 
 #endif
@@ -65,5 +65,50 @@
  */
 #define FA_USE_PREDICATE_ABSTRACTION     0
 
+/**
+ * the number of bytes (approximately) every worker keeps the minimised forms
+ * and the simulations of automata (up to renaming of states) memoised in,
+ * including the ones of the unions checked for inclusion, the least recently
+ * used ones are dropped first, zero disables the cache (default is 0x1000000,
+ * i.e. 16 MiB)
+ */
+#define FA_MINIMIZATION_CACHE_BYTES     0x1000000
+
+/**
+ * the default number of worker threads exploring the symbolic state space, 1
+ * runs the sequential depth-first search, the plugin argument "workers:<n>"
+ * overrides it (default is 1)
+ */
+#define FA_WORKER_THREADS               1
+
+/**
+ * keep the fixpoints that the newly learnt boxes cannot be folded into when
+ * restarting the analysis after learning boxes (default is 1)
+ */
+#define FA_INCREMENTAL_RESTART          1
+
+/**
+ * the fixpoint configuration is minimised only when the number of its
+ * transitions grows this many times since its last minimisation, 1 minimises
+ * it after every extension (default is 2)
+ */
+#define FA_FIXPOINT_MINIMIZATION_FACTOR 2
+
+/**
+ * fuse the sequences of microinstructions that only assign local registers
+ * into single instructions executed without the intermediate states, the
+ * plugin argument "no-fusion" turns it off (default is 1)
+ */
+#define FA_FUSE_MICROCODE               1
+
+/**
+ * the distance (in the number of states along a path) between the states of
+ * the execution graph that keep their forest automata for counterexample
+ * traces, the other executed states drop them and the automata are recomputed
+ * from the nearest kept state when a trace is needed, 0 keeps all automata,
+ * the plugin argument "checkpoints:<n>" overrides it (default is 0)
+ */
+#define FA_TRACE_CHECKPOINT_INTERVAL    0
+
 
 #endif /* CONFIG_H */
@@ -49,61 +49,72 @@ void ConnectionGraph::updateStateSignature(
 }
 
 
-void ConnectionGraph::computeSignatures(
-	StateToCutpointSignatureMap&     stateMap,
-	const TreeAut&                   ta)
+namespace
+{
+/**
+ * @brief  Computes signatures of the states of the given transitions
+ *
+ * Computes the signatures of the right-hand side states of @p transitions,
+ * which need to be all transitions leading to these states. The signatures of
+ * the other states occurring in the left-hand sides need to be in @p stateMap
+ * already.
+ *
+ * @param[in,out]  stateMap     Mapping of states to cutpoint signatures
+ * @param[in]      transitions  The transitions to be processed
+ */
+void propagateSignatures(
+	ConnectionGraph::StateToCutpointSignatureMap&     stateMap,
+	const std::vector<const TreeAut::Transition*>&    transitions)
 {
-	stateMap.clear();
-
 	// the workset of transitions
-	std::list<const Transition*> transitions;
+	std::list<const TreeAut::Transition*> workset;
 
-	CutpointSignature v(1);
+	ConnectionGraph::CutpointSignature v(1);
 
 	// compute the initial signatures for leaves, other signatures are cleared
-	for (const Transition& trans : ta)
+	for (const TreeAut::Transition* trans : transitions)
 	{	// traverse transitions of the TA
 		const Data* data;
 
-		if (trans.label()->isData(data))
+		if (trans->label()->isData(data))
 		{	// for data transitions
 			if (data->isRef())
 			{	// for references, add the referenced root
-				v[0] = CutpointInfo(data->d_ref.root);
-				ConnectionGraph::updateStateSignature(stateMap, trans.rhs(), v);
+				v[0] = ConnectionGraph::CutpointInfo(data->d_ref.root);
+				ConnectionGraph::updateStateSignature(stateMap, trans->rhs(), v);
 			} else
 			{	// for non-reference data states
-				assert(stateMap.find(trans.rhs()) == stateMap.end());
-				ConnectionGraph::updateStateSignature(stateMap, trans.rhs(),
-					CutpointSignature());
+				assert(stateMap.find(trans->rhs()) == stateMap.end());
+				ConnectionGraph::updateStateSignature(stateMap, trans->rhs(),
+					ConnectionGraph::CutpointSignature());
 			}
 		} else
 		{	// for non-data states
-			transitions.push_back(&trans);
+			workset.push_back(trans);
 		}
 	}
 
 	// Now we propagate the computed signatures upward in the tree structure.
-	// 'transitions' contains transitions that are to be processed. The following
-	// loop looks at all remaining transitions in 'transitions' and in the case
+	// 'workset' contains transitions that are to be processed. The following
+	// loop looks at all remaining transitions in 'workset' and in the case
 	// all downward predecessors of the transition are processed, it updates
-	// information about the transition and removes it from 'transitions'. This
-	// is repeated until 'transitions' is empty.
+	// information about the transition and removes it from 'workset'. This
+	// is repeated until 'workset' is empty.
 
 	bool changed = true;
-	while (transitions.size()/* && changed*/)
+	while (workset.size()/* && changed*/)
 	{	// while there are still some transitions to be processed
 		if (!changed)
 			assert(false);      // fail gracefully
 
 		changed = false;
-		for (auto i = transitions.begin(); i != transitions.end(); )
+		for (auto i = workset.begin(); i != workset.end(); )
 		{
-			const Transition& t = **i;
+			const TreeAut::Transition& t = **i;
 			assert(t.label()->isNode());
 
 			v.clear();
-			if (!processNode(v, t.lhs(), t.label(), stateMap))
+			if (!ConnectionGraph::processNode(v, t.lhs(), t.label(), stateMap))
 			{	// in case this transition cannot be processed because of some downward
 				// states with missing cutpoint information
 				++i;
@@ -114,9 +125,226 @@ void ConnectionGraph::computeSignatures(
 			ConnectionGraph::updateStateSignature(stateMap, t.rhs(), v);
 
 			changed = true;
-			i = transitions.erase(i);
+			i = workset.erase(i);
+		}
+	}
+}
+
+/**
+ * @brief  Links the states in @p fresh and all states below them
+ *
+ * Links each of the states in @p fresh that is not in @p linked yet with the
+ * states of the left-hand sides of the transitions leading to it, and does the
+ * same for the states below it not known in @p links yet. The linked states
+ * are inserted into @p linked.
+ */
+void linkStates(
+	ConnectionGraph::StateToLinksMap&     links,
+	const TreeAut&                        ta,
+	std::vector<size_t>&                  fresh,
+	std::unordered_set<size_t>&           linked)
+{
+	while (!fresh.empty())
+	{
+		size_t state = fresh.back();
+		fresh.pop_back();
+
+		if (!linked.insert(state).second)
+			continue;
+
+		ConnectionGraph::StateLinks& stateLinks = links[state];
+		for (auto i = ta.begin(state); i != ta.end(state); ++i)
+		{
+			for (size_t child : i->lhs())
+			{
+				if (!links.count(child))
+					fresh.push_back(child);
+
+				stateLinks.children.push_back(child);
+				links[child].parents.push_back(state);
+			}
+		}
+	}
+}
+
+
+/**
+ * @brief  Checks whether a final state of @p ta is reachable upwards from
+ *         @p state
+ *
+ * @param[out]  visited  The states visited by the search
+ */
+bool reachesFinalState(
+	const ConnectionGraph::StateToLinksMap&     links,
+	const TreeAut&                              ta,
+	size_t                                      state,
+	std::unordered_set<size_t>&                 visited)
+{
+	std::vector<size_t> workset(1, state);
+	visited.insert(state);
+
+	while (!workset.empty())
+	{
+		state = workset.back();
+		workset.pop_back();
+
+		if (ta.isFinalState(state))
+			return true;
+
+		for (size_t parent : links.at(state).parents)
+		{
+			if (visited.insert(parent).second)
+				workset.push_back(parent);
 		}
 	}
+
+	return false;
+}
+
+
+/**
+ * @brief  Forgets the states right below @p state
+ *
+ * The former children of @p state are appended to @p orphans.
+ */
+void unlinkChildren(
+	ConnectionGraph::StateToLinksMap&     links,
+	size_t                                state,
+	std::vector<size_t>&                  orphans)
+{
+	auto iter = links.find(state);
+	if (links.end() == iter)
+		return;
+
+	std::vector<size_t> children;
+	children.swap(iter->second.children);
+	for (size_t child : children)
+	{
+		auto childIter = links.find(child);
+		if (links.end() == childIter)
+			continue;
+
+		std::vector<size_t>& parents = childIter->second.parents;
+		auto pos = std::find(parents.begin(), parents.end(), state);
+		assert(parents.end() != pos);
+
+		*pos = parents.back();
+		parents.pop_back();
+		orphans.push_back(child);
+	}
+}
+} // namespace
+
+
+void ConnectionGraph::computeSignatures(
+	StateToCutpointSignatureMap&     stateMap,
+	const TreeAut&                   ta)
+{
+	stateMap.clear();
+
+	std::vector<const Transition*> transitions;
+	for (const Transition& trans : ta)
+		transitions.push_back(&trans);
+
+	propagateSignatures(stateMap, transitions);
+}
+
+
+void ConnectionGraph::computeSignatures(
+	StateToCutpointSignatureMap&     stateMap,
+	StateToLinksMap&                 links,
+	const TreeAut&                   ta)
+{
+	stateMap.clear();
+	links.clear();
+
+	std::vector<size_t> fresh(ta.getFinalStates().begin(), ta.getFinalStates().end());
+	std::unordered_set<size_t> linked;
+	linkStates(links, ta, fresh, linked);
+
+	std::vector<const Transition*> transitions;
+	for (size_t state : linked)
+	{
+		for (auto i = ta.begin(state); i != ta.end(state); ++i)
+			transitions.push_back(&*i);
+	}
+
+	propagateSignatures(stateMap, transitions);
+}
+
+
+void ConnectionGraph::updateSignatures(
+	StateToCutpointSignatureMap&     stateMap,
+	StateToLinksMap&                 links,
+	const TreeAut&                   ta,
+	const std::vector<size_t>&       changed)
+{
+	// states that may have become unreachable
+	std::vector<size_t> orphans;
+
+	for (size_t state : changed)
+	{	// forget the former transitions of the changed states
+		orphans.push_back(state);
+		unlinkChildren(links, state, orphans);
+	}
+
+	// link the current transitions of the changed states and of the new states
+	// below them, all of them need their signatures to be recomputed
+	std::vector<size_t> fresh(changed);
+	for (size_t state : ta.getFinalStates())
+	{
+		if (!links.count(state))
+			fresh.push_back(state);
+	}
+
+	std::unordered_set<size_t> dirty;
+	linkStates(links, ta, fresh, dirty);
+
+	while (!orphans.empty())
+	{	// drop the states no longer reachable, together with the states below
+		size_t state = orphans.back();
+		orphans.pop_back();
+
+		if (!links.count(state))
+			continue;
+
+		std::unordered_set<size_t> visited;
+		if (reachesFinalState(links, ta, state, visited))
+			continue;
+
+		// all states above 'state' are unreachable as well
+		for (size_t unreachable : visited)
+		{
+			unlinkChildren(links, unreachable, orphans);
+			links.erase(unreachable);
+			stateMap.erase(unreachable);
+			dirty.erase(unreachable);
+		}
+	}
+
+	// close the dirty states upwards
+	std::vector<size_t> workset(dirty.begin(), dirty.end());
+	while (!workset.empty())
+	{
+		size_t state = workset.back();
+		workset.pop_back();
+
+		for (size_t parent : links.at(state).parents)
+		{
+			if (dirty.insert(parent).second)
+				workset.push_back(parent);
+		}
+	}
+
+	std::vector<const Transition*> transitions;
+	for (size_t state : dirty)
+	{
+		stateMap.erase(state);
+		for (auto i = ta.begin(state); i != ta.end(state); ++i)
+			transitions.push_back(&*i);
+	}
+
+	propagateSignatures(stateMap, transitions);
 }
 
 
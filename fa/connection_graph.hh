@@ -53,6 +53,77 @@ private:  // data type
 
 public:
 
+	/**
+	 * @brief  A set of selector offsets
+	 *
+	 * The few selectors of a cutpoint are kept in a sorted vector, which is more
+	 * compact than a @p std::set and faster to copy, compare and merge.
+	 */
+	class SelectorSet
+	{
+	private:  // data members
+
+		std::vector<size_t> items_;
+
+	public:   // data types
+
+		typedef std::vector<size_t>::const_iterator const_iterator;
+		typedef const_iterator iterator;
+
+	public:   // methods
+
+		SelectorSet() :
+			items_{}
+		{ }
+
+		const_iterator begin() const { return items_.begin(); }
+
+		const_iterator end() const { return items_.end(); }
+
+		size_t size() const { return items_.size(); }
+
+		bool empty() const { return items_.empty(); }
+
+		void clear() { items_.clear(); }
+
+		size_t count(size_t selector) const
+		{
+			return std::binary_search(items_.begin(), items_.end(), selector);
+		}
+
+		void insert(size_t selector)
+		{
+			auto iter = std::lower_bound(items_.begin(), items_.end(), selector);
+			if ((iter == items_.end()) || (*iter != selector))
+				items_.insert(iter, selector);
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			const size_t mid = items_.size();
+			items_.insert(items_.end(), first, last);
+			std::sort(items_.begin() + mid, items_.end());
+			std::inplace_merge(items_.begin(), items_.begin() + mid, items_.end());
+			items_.erase(std::unique(items_.begin(), items_.end()), items_.end());
+		}
+
+		bool operator==(const SelectorSet& rhs) const
+		{
+			return items_ == rhs.items_;
+		}
+
+		bool operator!=(const SelectorSet& rhs) const
+		{
+			return items_ != rhs.items_;
+		}
+
+		friend size_t hash_value(const SelectorSet& selectors)
+		{
+			return boost::hash_range(selectors.items_.begin(), selectors.items_.end());
+		}
+	};
+
 	struct CutpointInfo
 	{
 		/// cutpoint number
@@ -68,7 +139,7 @@ public:
 		bool refInherited;
 
 		/// a set of selectors which reach the given cutpoint
-		std::set<size_t> fwdSelectors;
+		SelectorSet fwdSelectors;
 
 		/// lowest selector of 'root' from which the state can be reached in the
 		/// opposite direction
@@ -76,7 +147,7 @@ public:
 
 		/// set of selectors of the cutpoint hidden in the subtree (includes
 		/// backwardSelector if exists)
-		std::set<size_t> defines;
+		SelectorSet defines;
 
 		CutpointInfo(size_t root = 0) :
 			root(root),
@@ -155,8 +226,56 @@ public:
 		return true;
 	}
 
+	/**
+	 * @brief  Appends the key of a signature
+	 *
+	 * Appends to @p key a sequence of numbers describing @p signature such that
+	 * two signatures give the same sequence iff they are related by @p %.
+	 *
+	 * @param[in,out]  key        The vector to append the key to
+	 * @param[in]      signature  The signature
+	 */
+	static void signatureKey(
+		std::vector<size_t>&         key,
+		const CutpointSignature&     signature)
+	{
+		key.push_back(signature.size());
+		for (const CutpointInfo& cutpoint : signature)
+		{
+			key.push_back(cutpoint.root);
+			key.push_back(cutpoint.refCount);
+#if FA_TRACK_SELECTORS
+			key.push_back(cutpoint.selCount);
+#endif
+			key.push_back(cutpoint.bwdSelector);
+			key.push_back(cutpoint.defines.size());
+			key.insert(key.end(), cutpoint.defines.begin(), cutpoint.defines.end());
+		}
+	}
+
 	typedef std::unordered_map<size_t, CutpointSignature> StateToCutpointSignatureMap;
 
+	/**
+	 * @brief  The states right below and right above a state of a TA
+	 *
+	 * A state occurs in the lists once per occurrence in a transition.
+	 */
+	struct StateLinks
+	{
+		/// the left-hand side states of the transitions leading to the state
+		std::vector<size_t> children;
+
+		/// the states the transitions of which have the state on the left
+		std::vector<size_t> parents;
+
+		StateLinks() :
+			children{},
+			parents{}
+		{ }
+	};
+
+	typedef std::unordered_map<size_t, StateLinks> StateToLinksMap;
+
 	friend std::ostream& operator<<(
 		std::ostream&               os,
 		const CutpointSignature&    signature)
@@ -262,16 +381,25 @@ public:
 	}
 
 	static bool areDisjoint(
-		const std::set<size_t>&    s1,
-		const std::set<size_t>&    s2)
+		const SelectorSet&         s1,
+		const SelectorSet&         s2)
 	{
-		std::vector<size_t> v(s1.size());
+		auto i = s1.begin();
+		auto j = s2.begin();
+		while ((i != s1.end()) && (j != s2.end()))
+		{
+			if (*i < *j)
+				++i;
+			else if (*j < *i)
+				++j;
+			else
+				return false;
+		}
 
-		return std::set_intersection(s1.begin(), s1.end(),
-			s2.begin(), s2.end(), v.begin()) == v.begin();
+		return true;
 	}
 
-	static bool isSubset(const std::set<size_t>& s1, const std::set<size_t>& s2)
+	static bool isSubset(const SelectorSet& s1, const SelectorSet& s2)
 	{
 		return std::includes(s1.begin(), s1.end(), s2.begin(), s2.end());
 	}
@@ -358,6 +486,46 @@ public:
 		StateToCutpointSignatureMap&    stateMap,
 		const TreeAut&                  ta);
 
+
+	/**
+	 * @brief  Computes signatures of the reachable states of a TA, links them
+	 *
+	 * Works as the above method for the states reachable from the final states
+	 * of @p ta only, in addition it fills @p links so that the signatures can
+	 * be later updated by ConnectionGraph::updateSignatures().
+	 *
+	 * @param[out]  stateMap  Mapping of states to cutpoint signatures
+	 * @param[out]  links     Mapping of states to the states below and above
+	 * @param[in]   ta        The tree automaton
+	 */
+	static void computeSignatures(
+		StateToCutpointSignatureMap&    stateMap,
+		StateToLinksMap&                links,
+		const TreeAut&                  ta);
+
+
+	/**
+	 * @brief  Updates signatures of states after a local change of a TA
+	 *
+	 * Given @p stateMap and @p links of a previous version of @p ta that differs
+	 * from @p ta only in the transitions leading to the states in @p changed
+	 * (and possibly in some removed or new states below them), this method
+	 * recomputes the signatures of the @p changed states and of all states above
+	 * them, and brings @p links up to date. Only the transitions leading to
+	 * these states are looked at, the signatures of the other states are kept.
+	 * States that are no longer reachable are dropped from both maps.
+	 *
+	 * @param[in,out]  stateMap  Mapping of states to cutpoint signatures
+	 * @param[in,out]  links     Mapping of states to the states below and above
+	 * @param[in]      ta        The changed tree automaton
+	 * @param[in]      changed   The states with changed transitions
+	 */
+	static void updateSignatures(
+		StateToCutpointSignatureMap&    stateMap,
+		StateToLinksMap&                links,
+		const TreeAut&                  ta,
+		const std::vector<size_t>&      changed);
+
 	// TODO: I don't know what this method does
 	// (computes signature for all states of ta) ???
 	static void fixSignatures(
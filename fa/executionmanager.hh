@@ -21,106 +21,540 @@
 #define EXECUTION_MANAGER_H
 
 // Standard library headers
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 // Forester headers
+#include "config.h"
 #include "types.hh"
 #include "recycler.hh"
 #include "abstractinstruction.hh"
 #include "fixpointinstruction.hh"
+#include "profiler.hh"
 #include "symstate.hh"
+#include "workermutex.hh"
 
 
 /**
  * @brief  Class that carries out symbolic execution of the code
  *
- * This class performs symbolic execution of the code.
+ * This class performs symbolic execution of the code.  The states are
+ * processed by a given number of workers, each of them having its own queue
+ * of states and its own recyclers of states and registers.  A worker processes
+ * the states of its queue in the DFS order; once the queue is empty, it steals
+ * the oldest state from the queue of another worker.
  */
 class ExecutionManager
 {
 private:  // data types
 
-	typedef std::list<SymState*> QueueType;
+	typedef std::deque<SymState*> QueueType;
 
-private:  // data members
+	/**
+	 * @brief  The data private to a single worker
+	 */
+	struct Worker
+	{
+		/// the queue with the states to be processed (guarded by queueMutex_)
+		QueueType queue;
 
-	/// the root of the execution graph
-	SymState* root_;
+		/// counter of evaluated states (read by other workers for statistics)
+		std::atomic<size_t> statesExecuted;
 
-	/// the queue with the states to be processed
-	QueueType queue_;
+		/// counter of evaluated paths (read by other workers for statistics)
+		std::atomic<size_t> pathsEvaluated;
 
-	/// counter of evaluated states
-	size_t statesExecuted_;
+		/// memory manager for states
+		Recycler<SymState> stateRecycler;
 
-	/// counter of evaluated paths
-	size_t pathsEvaluated_;
+		/// collects the successors of a state being replayed (if any)
+		std::vector<SymState*>* replay;
 
-	/// memory manager for registers
-	Recycler<DataArray> registerRecycler_;
-	/// memory manager for states
-	Recycler<SymState> stateRecycler_;
+		/// set while the worker executes a state
+		bool executing;
 
-	class RecycleRegisterF
-	{
-	private:  // data members
+		/// the successors of the executed state, they are queued once the
+		/// execution finishes
+		std::vector<SymState*> successors;
 
-		Recycler<DataArray>& recycler_;
+		/// the profile of the executed instructions (if profiling)
+		Profiler::Profile profile;
 
-	public:   // methods
+		Worker(const Worker&);
+		Worker& operator=(const Worker&);
 
-		RecycleRegisterF(Recycler<DataArray>& recycler) :
-			recycler_(recycler)
+		Worker() :
+			queue{},
+			statesExecuted{0},
+			pathsEvaluated{0},
+			stateRecycler{},
+			replay{},
+			executing{false},
+			successors{},
+			profile{}
 		{ }
-
-		void operator()(DataArray* x)
-		{
-			recycler_.recycle(x);
-		}
 	};
 
+private:  // data members
+
+	/// the roots of the execution graph (the initial states of the runs before
+	/// and after a restart that kept some fixpoints)
+	std::set<SymState*> roots_;
+
+	/// the workers
+	std::vector<std::unique_ptr<Worker>> workers_;
+
+	/// guards the links between the states of the execution graph
+	WorkerMutex treeMutex_;
+
+	/// guards the queues of all workers, @p pending_ and @p stopped_
+	std::mutex queueMutex_;
+
+	/// signalled when a state is queued or when there is nothing left to do
+	std::condition_variable queueChanged_;
+
+	/// the number of states that are either queued or being executed
+	size_t pending_;
+
+	/// set when a worker has failed, the other workers stop then
+	bool stopped_;
+
+	/// profiling the executed instructions?
+	bool profiling_;
+
+	/// the distance between the states that keep their forest automata (0
+	/// keeps all of them)
+	size_t checkpointInterval_;
+
 private:  // methods
 
 	ExecutionManager(const ExecutionManager&);
 	ExecutionManager& operator=(const ExecutionManager&);
 
+	/**
+	 * @brief  The index of the worker run by the current thread
+	 *
+	 * The thread that created the manager is the worker 0.
+	 */
+	static size_t& workerIndex()
+	{
+		static thread_local size_t index = 0;
+		return index;
+	}
+
+	Worker& worker()
+	{
+		assert(workerIndex() < workers_.size());
+		return *workers_[workerIndex()];
+	}
+
+	/**
+	 * @brief  Takes the next state to be processed by the current worker
+	 *
+	 * If there is no queued state, but some other worker is still executing
+	 * a state (which may give rise to new ones), the current worker waits.
+	 *
+	 * @returns  The state, or @p nullptr if there are no more states to be
+	 *           processed by any worker
+	 */
+	SymState* dequeue()
+	{
+		const size_t self = workerIndex();
+
+		std::unique_lock<std::mutex> lock(queueMutex_);
+		while (!stopped_)
+		{
+			Worker& worker = *workers_[self];
+			if (!worker.queue.empty())
+			{	// the own queue in the DFS order
+				SymState* state = worker.queue.back();
+				worker.queue.pop_back();
+				return state;
+			}
+
+			for (size_t i = 1; i < workers_.size(); ++i)
+			{	// steal the oldest state of another worker
+				Worker& victim = *workers_[(self + i) % workers_.size()];
+				if (!victim.queue.empty())
+				{
+					SymState* state = victim.queue.front();
+					victim.queue.pop_front();
+					return state;
+				}
+			}
+
+			if (0 == pending_)
+				return nullptr;
+
+			// some worker is executing a state and may produce new ones
+			queueChanged_.wait(lock);
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * @brief  Marks a state taken by @p dequeue() as processed
+	 */
+	void finished()
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		assert(0 < pending_);
+		if (0 == --pending_)
+			queueChanged_.notify_all();
+	}
+
+	/**
+	 * @brief  Stops all the workers (on an error)
+	 */
+	void stop()
+	{
+		std::lock_guard<std::mutex> lock(queueMutex_);
+		stopped_ = true;
+		queueChanged_.notify_all();
+	}
+
+	void push(SymState* state)
+	{
+		Worker& worker = this->worker();
+		if (nullptr != worker.replay)
+		{	// the successors of a replayed state are not processed
+			worker.replay->push_back(state);
+			return;
+		}
+
+		if (profiling_)
+			Profiler::successor(state->GetFAE().get());
+
+		if (worker.executing)
+		{	// a successor taken by another worker could finish its path and
+			// recycle the executed state before the execution is over
+			worker.successors.push_back(state);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			++pending_;
+			worker.queue.push_back(state);
+		}
+
+		queueChanged_.notify_one();
+	}
+
+	/**
+	 * @brief  Queues the successors of the state executed by the current worker
+	 */
+	void flush()
+	{
+		Worker& worker = this->worker();
+		worker.executing = false;
+		if (worker.successors.empty())
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(queueMutex_);
+			pending_ += worker.successors.size();
+			worker.queue.insert(worker.queue.end(), worker.successors.begin(),
+				worker.successors.end());
+		}
+
+		worker.successors.clear();
+		queueChanged_.notify_all();
+	}
+
+	/**
+	 * @brief  Determines whether a state keeps its forest automaton
+	 *
+	 * Besides every @p checkpointInterval_-th state on a path, the
+	 * fixpoint states and their successors are kept.  They are kept only so
+	 * that a fixpoint instruction is never replayed when a trace is recomputed.
+	 */
+	bool isCheckpoint(const SymState& state) const
+	{
+		const SymState* parent = static_cast<const SymState*>(state.GetParent());
+
+		return (0 == state.GetDepth() % checkpointInterval_)
+			|| (fi_type_e::fiFix == state.GetInstr()->getType())
+			|| ((nullptr != parent) && (fi_type_e::fiFix == parent->GetInstr()->getType()));
+	}
+
+	/**
+	 * @brief  Drops the forest automaton of an executed state
+	 *
+	 * @param[in,out]  state  The executed state
+	 */
+	void compact(SymState& state)
+	{
+		WorkerLock lock(treeMutex_);
+
+		// a state without successors has finished its path (and it has been
+		// recycled then)
+		if (state.GetChildren().empty() || isCheckpoint(state))
+			return;
+
+		state.compact();
+	}
+
+	/**
+	 * @brief  Recomputes the forest automaton of a state from its parent
+	 *
+	 * The instruction of @p parent is executed again on a copy of @p parent, and
+	 * the automaton of the successor that corresponds to @p state is restored in
+	 * @p state.
+	 *
+	 * @param[in]  parent  The parent of @p state (with its automaton)
+	 * @param[in]  state   The state whose automaton has been dropped
+	 */
+	void replay(
+		const SymState&                    parent,
+		SymState&                          state)
+	{
+		// Assertions
+		assert(nullptr != parent.GetFAE());
+		assert(nullptr == state.GetFAE());
+
+		std::vector<SymState*> successors;
+		SymState* tmpState = this->copyStateWithNewRegs(parent);
+
+		this->worker().replay = &successors;
+		try
+		{
+			tmpState->GetInstr()->execute(*this, *tmpState);
+		}
+		catch (...)
+		{
+			this->worker().replay = nullptr;
+			this->recycleState(tmpState);
+			throw;
+		}
+
+		this->worker().replay = nullptr;
+
+		// the successors are expected in the same order as in the original run,
+		// the digest of the automaton guards against a different one
+		const size_t branch = state.GetBranch();
+		const bool restored = (branch < successors.size())
+			&& (successors[branch]->GetInstr() == state.GetInstr())
+			&& state.restore(successors[branch]->GetFAE());
+
+		this->recycleState(tmpState);
+
+		if (!restored)
+			throw std::runtime_error("ExecutionManager::replay(): unable to recompute a state of the trace");
+	}
+
 public:
 
-	ExecutionManager() :
-		root_(nullptr),
-		queue_{},
-		statesExecuted_{},
-		pathsEvaluated_{},
-		registerRecycler_{},
-		stateRecycler_{}
-	{ }
+	/**
+	 * @param[in]  workers  The number of workers (at least one)
+	 */
+	explicit ExecutionManager(size_t workers = FA_WORKER_THREADS) :
+		roots_{},
+		workers_{},
+		treeMutex_{},
+		queueMutex_{},
+		queueChanged_{},
+		pending_{0},
+		stopped_{false},
+		profiling_{false},
+		checkpointInterval_{FA_TRACE_CHECKPOINT_INTERVAL}
+	{
+		// Assertions
+		assert(0 < workers);
+
+		for (size_t i = 0; i < workers; ++i)
+			workers_.push_back(std::unique_ptr<Worker>(new Worker()));
+	}
 
 	~ExecutionManager()
 	{
 		this->clear();
+
+		// the recycled states may still hold registers
+		for (auto& worker : workers_)
+			worker->stateRecycler.clear();
 	}
 
-	size_t statesEvaluated() const { return statesExecuted_; }
+	size_t statesEvaluated() const
+	{
+		size_t result = 0;
+		for (auto& worker : workers_)
+			result += worker->statesExecuted.load(std::memory_order_relaxed);
 
-	size_t pathsEvaluated() const { return pathsEvaluated_; }
+		return result;
+	}
+
+	size_t pathsEvaluated() const
+	{
+		size_t result = 0;
+		for (auto& worker : workers_)
+			result += worker->pathsEvaluated.load(std::memory_order_relaxed);
+
+		return result;
+	}
+
+	/**
+	 * @brief  Enables or disables profiling of the executed instructions
+	 *
+	 * The profiles are kept across restarts of the analysis.
+	 */
+	void setProfiling(bool profiling)
+	{
+		profiling_ = profiling;
+	}
+
+	/**
+	 * @brief  Sets the distance between the states that keep their automata
+	 *
+	 * The other executed states drop their forest automata, which are
+	 * recomputed by @p restoreTrace() when a trace is needed.
+	 *
+	 * @param[in]  interval  The distance (in the number of states along a
+	 *                       path), 0 keeps all automata (the default is
+	 *                       @p FA_TRACE_CHECKPOINT_INTERVAL)
+	 */
+	void setCheckpointInterval(size_t interval)
+	{
+		checkpointInterval_ = interval;
+	}
+
+	/**
+	 * @brief  Merges the profiles of all workers
+	 *
+	 * @param[out]  dst  The merged profile
+	 */
+	void getProfile(Profiler::Profile& dst) const
+	{
+		for (auto& worker : workers_)
+		{
+			for (const auto& instrRecordPair : worker->profile)
+				dst[instrRecordPair.first].merge(instrRecordPair.second);
+		}
+	}
 
 	void clear()
 	{
-		if (nullptr != root_)
+		for (SymState* root : roots_)
+			root->recycle(this->worker().stateRecycler);
+
+		roots_.clear();
+
+		this->reset();
+	}
+
+	/**
+	 * @brief  Empties the queues and resets the counters of all workers
+	 */
+	void reset()
+	{
+		for (auto& worker : workers_)
 		{
-			root_->recycle(stateRecycler_);
-			root_ = nullptr;
+			worker->queue.clear();
+			worker->successors.clear();
+			worker->executing = false;
+			worker->statesExecuted = 0;
+			worker->pathsEvaluated = 0;
 		}
 
-		queue_.clear();
+		pending_ = 0;
+		stopped_ = false;
+	}
 
-		statesExecuted_ = 0;
-		pathsEvaluated_ = 0;
+	/**
+	 * @brief  Prepares the execution graph for a restart of the analysis
+	 *
+	 * The states at the instructions in @p fixpoints whose successors are still
+	 * being explored are kept together with the paths leading to them, and
+	 * their successors are scheduled again.  The rest of the graph is dropped.
+	 * The traces of the rescheduled states thus still start at the initial
+	 * state of the program.
+	 *
+	 * @param[in]  fixpoints  The fixpoint instructions kept across the restart
+	 */
+	void restart(const std::set<const AbstractInstruction*>& fixpoints)
+	{
+		// Assertions
+		assert(0 == workerIndex());
+
+		this->reset();
+
+		// the kept fixpoint states, the instructions and automata of their
+		// successors, and the states on the paths to the kept fixpoint states
+		std::vector<SymState*> resumed;
+		std::vector<std::pair<AbstractInstruction*, std::shared_ptr<const FAE>>>
+			successors;
+		std::set<const LinkTree*> needed;
+
+		std::vector<SymState*> stack(roots_.begin(), roots_.end());
+		while (!stack.empty())
+		{
+			SymState* state = stack.back();
+			stack.pop_back();
+
+			for (LinkTree* child : state->GetChildren())
+				stack.push_back(static_cast<SymState*>(child));
+
+			if (!fixpoints.count(state->GetInstr()) || state->GetChildren().empty())
+				continue;
+
+			// the only successor of a fixpoint state is the admitted configuration
+			assert(1 == state->GetChildren().size());
+
+			SymState* succ = static_cast<SymState*>(*state->GetChildren().begin());
+			assert(nullptr != succ->GetFAE());
+
+			resumed.push_back(state);
+			successors.push_back(std::make_pair(succ->GetInstr(), succ->GetFAE()));
+
+			for (const LinkTree* s = state; nullptr != s; s = s->GetParent())
+			{
+				if (!needed.insert(s).second)
+					break;
+			}
+		}
+
+		std::vector<SymState*> dropped;
+		for (SymState* root : roots_)
+		{
+			if (!needed.count(root))
+				dropped.push_back(root);
+		}
+
+		for (const LinkTree* state : needed)
+		{
+			for (LinkTree* child : state->GetChildren())
+			{
+				if (!needed.count(child))
+					dropped.push_back(static_cast<SymState*>(child));
+			}
+		}
+
+		for (SymState* state : dropped)
+		{
+			roots_.erase(state);
+			state->recycle(this->worker().stateRecycler);
+		}
+
+		for (size_t i = 0; i < resumed.size(); ++i)
+		{
+			this->enqueue(resumed[i], resumed[i]->GetRegs(), successors[i].second,
+				successors[i].first);
+		}
 	}
 
 	SymState* createState()
 	{
-		SymState* state = stateRecycler_.alloc();
+		SymState* state = this->worker().stateRecycler.alloc();
 		assert(nullptr != state);
 		return state;
 	}
@@ -131,6 +565,8 @@ public:
 		AbstractInstruction*               instr)
 	{
 		SymState* state = createState();
+
+		WorkerLock lock(treeMutex_);
 		state->initChildFrom(&oldState, instr);
 
 		return state;
@@ -141,8 +577,11 @@ public:
 		AbstractInstruction*               instr)
 	{
 		SymState* state = createState();
-		const std::shared_ptr<DataArray> regs = allocRegisters(oldState.GetRegs());
-		state->initChildFrom(&oldState, instr, regs);
+
+		// the register file is persistent, the copy shares the registers until
+		// they are assigned
+		WorkerLock lock(treeMutex_);
+		state->initChildFrom(&oldState, instr, oldState.GetRegs());
 
 		return state;
 	}
@@ -160,8 +599,7 @@ public:
 		const SymState&                    oldState)
 	{
 		SymState* state = createState();
-		const std::shared_ptr<DataArray> regs = allocRegisters(oldState.GetRegs());
-		state->init(oldState, regs);
+		state->init(oldState, oldState.GetRegs());
 
 		return state;
 	}
@@ -171,22 +609,25 @@ public:
 		const AbstractInstruction*         insn)
 	{
 		SymState* state = createState();
-		const std::shared_ptr<DataArray> regs = allocRegisters(oldState.GetRegs());
-		state->init(oldState, regs, const_cast<AbstractInstruction*>(insn));
+		state->init(oldState, oldState.GetRegs(), const_cast<AbstractInstruction*>(insn));
 
 		return state;
 	}
 
 	SymState* enqueue(
 		SymState*                           parent,
-		const std::shared_ptr<DataArray>&   registers,
+		const RegisterFile&                 registers,
 		const std::shared_ptr<const FAE>&   fae,
 		AbstractInstruction*                instr)
 	{
 		SymState* state = createState();
 
-		state->init(parent, instr, fae, registers);
-		queue_.push_back(state);
+		{
+			WorkerLock lock(treeMutex_);
+			state->init(parent, instr, fae, registers);
+		}
+
+		this->push(state);
 
 		return state;
 	}
@@ -197,51 +638,103 @@ public:
 		// Assertions
 		assert(nullptr != state);
 
-		queue_.push_back(state);
+		this->push(state);
 		return state;
 	}
 
-	SymState* dequeueBFS()
+	/**
+	 * @brief  Processes the queued states and all the states they give rise to
+	 *
+	 * With a single worker, the states are processed by the calling thread.
+	 * Otherwise, the other workers are run in their own threads.  The first
+	 * exception thrown by a worker stops all the workers, and it is rethrown
+	 * once all of them have finished.
+	 *
+	 * @param[in]  f  The functor called on each state to be processed, it is
+	 *                expected to call @p execute() on the state
+	 */
+	template <class F>
+	void run(F f)
 	{
-		if (queue_.empty())
-			return nullptr;
+		assert(0 == workerIndex());
 
-		SymState* state = queue_.front();
-		assert(nullptr != state);
+		if (1 == workers_.size())
+		{
+			SymState* state;
+			while (nullptr != (state = this->dequeue()))
+			{
+				f(*state);
+				this->finished();
+			}
 
-		queue_.pop_front();
+			return;
+		}
 
-		return state;
-	}
+		std::exception_ptr error = nullptr;
+		std::mutex errorMutex;
 
-	SymState* dequeueDFS()
-	{
-		if (queue_.empty())
-			return nullptr;
+		auto work = [this, &f, &error, &errorMutex](size_t index)
+		{
+			workerIndex() = index;
 
-		SymState* state = queue_.back();
-		assert(nullptr != state);
+			try
+			{
+				SymState* state;
+				while (nullptr != (state = this->dequeue()))
+				{
+					f(*state);
+					this->finished();
+				}
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(errorMutex);
+				if (nullptr == error)
+					error = std::current_exception();
 
-		queue_.pop_back();
+				this->stop();
+			}
 
-		return state;
-	}
+			workerIndex() = 0;
+		};
 
-	std::shared_ptr<DataArray> allocRegisters(const DataArray& model)
-	{
-		DataArray* v = registerRecycler_.alloc();
-		assert(nullptr != v);
+		// the shared data are locked only while the other workers run
+		WorkerMutex::setConcurrent(true);
+
+		std::vector<std::thread> threads;
+		for (size_t i = 1; i < workers_.size(); ++i)
+			threads.push_back(std::thread(work, i));
+
+		work(0);
 
-		*v = model;
+		for (auto& thread : threads)
+			thread.join();
 
-		return std::shared_ptr<DataArray>(v, RecycleRegisterF(registerRecycler_));
+		WorkerMutex::setConcurrent(false);
+
+		if (nullptr != error)
+			std::rethrow_exception(error);
 	}
 
-	void init(const DataArray& registers, const std::shared_ptr<const FAE>& fae,
+	/**
+	 * @brief  Schedules a new root of the execution graph
+	 *
+	 * @param[in]  registers  Values of registers
+	 * @param[in]  fae        The forest automaton of the state
+	 * @param[in]  instr      The instruction the state starts at
+	 */
+	void schedule(const RegisterFile& registers, const std::shared_ptr<const FAE>& fae,
 		AbstractInstruction* instr)
 	{
-		this->clear();
-		root_ = this->enqueue(nullptr, this->allocRegisters(registers), fae, instr);
+		SymState* state = createState();
+
+		{
+			WorkerLock lock(treeMutex_);
+			state->init(nullptr, instr, fae, registers);
+			roots_.insert(state);
+		}
+
+		this->push(state);
 	}
 
 	void execute(SymState& state)
@@ -249,14 +742,74 @@ public:
 		// Assertions
 		assert(nullptr != state.GetInstr());
 
-		++statesExecuted_;
+		this->worker().statesExecuted.fetch_add(1, std::memory_order_relaxed);
+
+		this->worker().executing = true;
+		try
+		{
+			Profiler::InstrScope scope(
+				profiling_ ? &this->worker().profile : nullptr,
+				state.GetInstr(),
+				profiling_ ? state.GetFAE().get() : nullptr);
+
+			state.GetInstr()->execute(*this, state);
+		}
+		catch (...)
+		{	// the successors stay in the execution graph, which owns them
+			this->worker().successors.clear();
+			this->worker().executing = false;
+			throw;
+		}
+
+		if (0 < checkpointInterval_)
+			this->compact(state);
+
+		this->flush();
+	}
+
+	/**
+	 * @brief  Recomputes the forest automata dropped from the states of a trace
+	 *
+	 * The automata are recomputed by executing again the instructions from the
+	 * nearest state on the trace that kept its automaton (see
+	 * @p setCheckpointInterval()). The states of the trace are looked up in
+	 * the execution graph, which owns them.
+	 *
+	 * @param[in]  trace  The trace (as given by @p SymState::getTrace())
+	 */
+	void restoreTrace(const SymState::Trace& trace)
+	{
+		SymState* parent = nullptr;
+		for (auto it = trace.crbegin(); it != trace.crend(); ++it)
+		{	// from the initial state of the trace, look the state up in the graph
+			SymState* state = nullptr;
+			if (nullptr == parent)
+			{
+				auto root = std::find(roots_.begin(), roots_.end(), *it);
+				assert(roots_.end() != root);
+				state = *root;
+			} else
+			{
+				auto child = std::find(parent->GetChildren().begin(),
+					parent->GetChildren().end(), *it);
+				assert(parent->GetChildren().end() != child);
+				state = static_cast<SymState*>(*child);
+			}
+
+			if (nullptr == state->GetFAE())
+			{	// Assertions
+				assert(nullptr != parent);
+
+				this->replay(*parent, *state);
+			}
 
-		state.GetInstr()->execute(*this, state);
+			parent = state;
+		}
 	}
 
 	void pathFinished(SymState* state)
 	{
-		++pathsEvaluated_;
+		this->worker().pathsEvaluated.fetch_add(1, std::memory_order_relaxed);
 
 		this->destroyBranch(state);
 	}
@@ -274,7 +827,8 @@ public:
 		// Assertions
 		assert(nullptr != state);
 
-		state->recycle(stateRecycler_);
+		WorkerLock lock(treeMutex_);
+		state->recycle(this->worker().stateRecycler);
 	}
 
 
@@ -283,21 +837,25 @@ public:
 		// Assertions
 		assert(nullptr != state);
 
+		WorkerLock lock(treeMutex_);
+		Recycler<SymState>& recycler = this->worker().stateRecycler;
+		const SymState* leaf = state;
+
 		while (state->GetParent())
 		{
 			// Assertions
 			assert(state->GetParent()->GetChildren().size());
 
-			if (state->GetInstr()->getType() == fi_type_e::fiFix)
-			{
-				FixpointInstruction* fixpoint =
-					static_cast<FixpointInstruction*>(state->GetInstr());
-				fixpoint->extendFixpoint(state->GetFAE());
+			if ((state != leaf)
+				&& (state->GetInstr()->getType() == fi_type_e::fiFix))
+			{	// all the successors of an admitted configuration are explored
+				static_cast<FixpointInstruction*>(state->GetInstr())
+					->branchFinished();
 			}
 
 			if (state->GetParent()->GetChildren().size() > 1)
 			{
-				state->recycle(stateRecycler_);
+				state->recycle(recycler);
 				return;
 			}
 
@@ -305,10 +863,10 @@ public:
 		}
 
 		// Assertions
-		assert(state == root_);
+		assert(roots_.count(state));
 
-		root_->recycle(stateRecycler_);
-		root_ = nullptr;
+		roots_.erase(state);
+		state->recycle(recycler);
 	}
 };
 
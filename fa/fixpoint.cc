@@ -19,6 +19,7 @@
 
 // Standard library headers
 #include <ostream>
+#include <unordered_set>
 
 // Code Listener headers
 #include <cl/storage.hh>
@@ -31,6 +32,7 @@
 #include "folding.hh"
 #include "forestautext.hh"
 #include "normalization.hh"
+#include "profiler.hh"
 #include "regdef.hh"
 #include "splitting.hh"
 #include "streams.hh"
@@ -51,18 +53,18 @@ struct ExactTMatchF
 	}
 };
 
-struct SmartTMatchF
+struct SmartTKeyF
 {
-	bool operator()(
-		const TT<label_type>&              t1,
-		const TT<label_type>&              t2)
+	size_t operator()(
+		const TT<label_type>&              t)
 	{
-		if (t1.label()->isNode() && t2.label()->isNode())
+		// nodes with the same tag match, other labels match only themselves
+		if (t.label()->isNode())
 		{
-			return t1.label()->getTag() == t2.label()->getTag();
+			return reinterpret_cast<size_t>(t.label()->getTag());
 		}
 
-		return t1.label() == t2.label();
+		return reinterpret_cast<size_t>(&*t.label());
 	}
 };
 
@@ -178,6 +180,8 @@ bool normalize(
 	const std::set<size_t>&   forbidden,
 	bool                      extended)
 {
+	Profiler::PhaseScope phase(Profiler::phase_e::normalization);
+
 	Normalization norm(fae, state);
 
 	std::vector<size_t> order;
@@ -211,6 +215,8 @@ bool fold(
 	BoxMan&                      boxMan,
 	const std::set<size_t>&      forbidden)
 {
+	Profiler::PhaseScope phase(Profiler::phase_e::folding);
+
 	std::vector<size_t> order;
 	std::vector<bool> marked;
 
@@ -269,6 +275,8 @@ void reorder(
 	const SymState*   state,
 	FAE&              fae)
 {
+	Profiler::PhaseScope phase(Profiler::phase_e::normalization);
+
 	fae.unreachableFree();
 
 	Normalization norm(fae, state);
@@ -286,10 +294,28 @@ void reorder(
 	FA_DEBUG_AT(3, "after reordering: " << std::endl << fae);
 }
 
+/**
+ * @brief  Tests inclusion of a configuration in the fixpoint and extends it
+ *
+ * If @p fae is not included in @p fwdConf, it is joined into it. The joined
+ * configurations are not minimised immediately, @p fwdConf is minimised only
+ * when it has grown FA_FIXPOINT_MINIMIZATION_FACTOR times since its last
+ * minimisation, so the inclusion is until then checked against the union of
+ * the minimised configurations and the recently joined ones.
+ *
+ * @param[in,out]  fae             The tested configuration
+ * @param[in,out]  fwdConf         The fixpoint configuration
+ * @param[in,out]  fwdConfWrapper  The wrapper of @p fwdConf
+ * @param[in,out]  minimizedSize   The number of transitions of @p fwdConf
+ *                                 after its last minimisation
+ *
+ * @returns  @p true if @p fae is included in @p fwdConf
+ */
 bool testInclusion(
 	FAE&                           fae,
 	TreeAut&                       fwdConf,
-	UFAE&                          fwdConfWrapper)
+	UFAE&                          fwdConfWrapper,
+	size_t&                        minimizedSize)
 {
 	TreeAut ta(*fwdConf.backend);
 
@@ -304,10 +330,16 @@ bool testInclusion(
 
 	fwdConfWrapper.join(ta, index);
 
-	ta.clear();
+	if (fwdConf.getTransitions().size() >=
+		FA_FIXPOINT_MINIMIZATION_FACTOR * minimizedSize)
+	{	// the unminimised part has grown too large
+		ta.clear();
 
-	fwdConf.minimized(ta);
-	fwdConf = ta;
+		fwdConf.minimized(ta);
+		fwdConf = ta;
+
+		minimizedSize = fwdConf.getTransitions().size();
+	}
 
 	return false;
 }
@@ -351,6 +383,8 @@ void getCandidates(
 
 void learn1(FAE& fae, BoxMan& boxMan)
 {
+	Profiler::PhaseScope phase(Profiler::phase_e::folding);
+
 	fae.unreachableFree();
 
 	std::set<size_t> forbidden = Normalization::computeForbiddenSet(fae);
@@ -373,6 +407,8 @@ void learn2(
 	FAE&       fae,
 	BoxMan&    boxMan)
 {
+	Profiler::PhaseScope phase(Profiler::phase_e::folding);
+
 	fae.unreachableFree();
 
 	std::set<size_t> forbidden = Normalization::computeForbiddenSet(fae);
@@ -389,6 +425,38 @@ void learn2(
 		folding.discover3(i, forbidden, false);
 	}
 }
+
+/**
+ * @brief  Collects the tags of the nodes of a tree automaton
+ *
+ * The tag of a node consists of its type and the selectors it covers.
+ */
+void collectNodeTags(
+	std::unordered_set<const void*>&    tags,
+	const TreeAut&                      ta)
+{
+	for (const TreeAut::Transition& t : ta)
+	{
+		if (t.label()->isNode())
+			tags.insert(t.label()->getTag());
+	}
+}
+
+/**
+ * @brief  Checks whether a tree automaton has a node with any of the tags
+ */
+bool hasNodeTag(
+	const TreeAut&                            ta,
+	const std::unordered_set<const void*>&    tags)
+{
+	for (const TreeAut::Transition& t : ta)
+	{
+		if (t.label()->isNode() && tags.count(t.label()->getTag()))
+			return true;
+	}
+
+	return false;
+}
 } // namespace
 
 
@@ -409,9 +477,46 @@ SymState* FixpointBase::reverseAndIsect(
 }
 
 
+bool FixpointBase::restart(const std::vector<const Box*>& boxes)
+{
+	WorkerLock lock(mutex_);
+
+	if (boxes.empty() || branchFinished_)
+	{	// nothing is known about the reason of the restart, or the successors of
+		// some configurations have been explored and they cannot be scheduled
+		// again
+		this->clear();
+		return false;
+	}
+
+	// a box can only be folded into nodes with the same labels as the nodes
+	// inside the box, hence also with the same tags
+	std::unordered_set<const void*> tags;
+	for (const Box* box : boxes)
+	{
+		assert(nullptr != box->getOutput());
+		collectNodeTags(tags, *box->getOutput());
+
+		if (nullptr != box->getInput())
+			collectNodeTags(tags, *box->getInput());
+	}
+
+	// the automaton of the fixpoint has the nodes of all its configurations
+	if (hasNodeTag(fwdConf_, tags))
+	{
+		this->clear();
+		return false;
+	}
+
+	return true;
+}
+
+
 void FI_abs::abstract(
 	FAE&                 fae)
 {
+	Profiler::PhaseScope phase(Profiler::phase_e::abstraction);
+
 	fae.unreachableFree();
 
 	FA_DEBUG_AT(3, "before abstraction: " << std::endl << fae);
@@ -423,15 +528,19 @@ void FI_abs::abstract(
 
 		ContainerGuard<std::vector<FAE*>> g(tmp);
 
-		FAE::loadCompatibleFAs(
-			/* the result */ tmp,
-			fwdConf_,
-			taBackend_,
-			boxMan_,
-			fae,
-			0,
-			CompareVariablesF()
-		);
+		{	// the fixpoint may be extended by other workers meanwhile
+			WorkerLock lock(mutex_);
+
+			FAE::loadCompatibleFAs(
+				/* the result */ tmp,
+				fwdConf_,
+				taBackend_,
+				boxMan_,
+				fae,
+				0,
+				CompareVariablesF()
+			);
+		}
 
 		for (size_t i = 0; i < tmp.size(); ++i)
 		{
@@ -463,8 +572,7 @@ void FI_abs::abstract(
 		{
 			if (!excludedRoots[i])
 			{
-				abstraction.heightAbstraction(i, FA_ABS_HEIGHT, SmartTMatchF());
-//				abstraction.heightAbstraction(i, FA_ABS_HEIGHT, SmarterTMatchF(fae));
+				abstraction.heightAbstraction(i, FA_ABS_HEIGHT, SmartTKeyF());
 			}
 		}
 	}
@@ -485,7 +593,7 @@ void FI_abs::execute(ExecutionManager& execMan, SymState& state)
 	// reorder components into the canonical form (no merging!)
 	reorder(&state, *fae);
 
-	if (!boxMan_.boxDatabase().empty())
+	if (0 != boxMan_.boxCount())
 	{	// in the case there are some boxes, try to fold immediately before
 		// normalization
 		for (size_t i = 0; i < FIXED_REG_COUNT; ++i)
@@ -507,7 +615,7 @@ void FI_abs::execute(ExecutionManager& execMan, SymState& state)
 #if FA_ALLOW_FOLDING
 	learn1(*fae, boxMan_);
 
-	if (boxMan_.boxDatabase().size())
+	if (boxMan_.boxCount())
 	{
 		FAE old(*fae->backend, boxMan_);
 
@@ -532,7 +640,15 @@ void FI_abs::execute(ExecutionManager& execMan, SymState& state)
 	}
 #endif
 	// test inclusion
-	if (testInclusion(*fae, fwdConf_, fwdConfWrapper_))
+	bool covered;
+	{
+		WorkerLock lock(mutex_);
+		covered = testInclusion(
+			*fae, fwdConf_, fwdConfWrapper_, minimizedSize_
+		);
+	}
+
+	if (covered)
 	{
 		FA_DEBUG_AT(3, "hit");
 
@@ -559,7 +675,7 @@ void FI_fix::execute(ExecutionManager& execMan, SymState& state)
 #if FA_ALLOW_FOLDING
 	reorder(&state, *fae);
 
-	if (!boxMan_.boxDatabase().size())
+	if (!boxMan_.boxCount())
 	{
 		for (size_t i = 0; i < FIXED_REG_COUNT; ++i)
 		{
@@ -573,7 +689,7 @@ void FI_fix::execute(ExecutionManager& execMan, SymState& state)
 
 	normalize(*fae, &state, forbidden, true);
 #if FA_ALLOW_FOLDING
-	if (boxMan_.boxDatabase().size())
+	if (boxMan_.boxCount())
 	{
 		forbidden.clear();
 
@@ -598,7 +714,15 @@ void FI_fix::execute(ExecutionManager& execMan, SymState& state)
 	}
 #endif
 	// test inclusion
-	if (testInclusion(*fae, fwdConf_, fwdConfWrapper_))
+	bool covered;
+	{
+		WorkerLock lock(mutex_);
+		covered = testInclusion(
+			*fae, fwdConf_, fwdConfWrapper_, minimizedSize_
+		);
+	}
+
+	if (covered)
 	{
 		FA_DEBUG_AT(3, "hit");
 
@@ -26,9 +26,11 @@
 
 // Forester headers
 #include "boxman.hh"
+#include "config.h"
 #include "fixpointinstruction.hh"
 #include "forestautext.hh"
 #include "ufae.hh"
+#include "workermutex.hh"
 
 /**
  * @brief  The base class for fixpoint instructions
@@ -42,46 +44,37 @@ protected:
 
 	UFAE fwdConfWrapper_;
 
-	std::vector<std::shared_ptr<const FAE>> fixpoint_;
+	/// the number of transitions of @p fwdConf_ after its last minimisation
+	size_t minimizedSize_;
+
+	/// set once all successors of an admitted configuration have been explored
+	bool branchFinished_;
 
 	TreeAut::Backend& taBackend_;
 
 	BoxMan& boxMan_;
 
-public:
+	/// serialises the updates of the fixpoint by concurrent workers
+	WorkerMutex mutex_;
 
-	virtual void extendFixpoint(const std::shared_ptr<const FAE>& fae)
-	{
-		fixpoint_.push_back(fae);
-	}
+public:
 
 	virtual void clear()
 	{
-		fixpoint_.clear();
+		WorkerLock lock(mutex_);
+		branchFinished_ = false;
 		fwdConf_.clear();
 		fwdConfWrapper_.clear();
+		minimizedSize_ = 0;
 	}
 
-#if 0
-	void recompute()
+	virtual void branchFinished()
 	{
-		fwdConf_.clear();
-		fwdConfWrapper_.clear();
-		TreeAut ta(*fwdConf_.backend);
-		Index<size_t> index;
-
-		for (auto fae : fixpoint_)
-		{
-			fwdConfWrapper_.fae2ta(ta, index, *fae);
-		}
-
-		if (!ta.getTransitions().empty())
-		{
-			fwdConfWrapper_.adjust(index);
-			ta.minimized(fwdConf_);
-		}
+		WorkerLock lock(mutex_);
+		branchFinished_ = true;
 	}
-#endif
+
+	virtual bool restart(const std::vector<const Box*>& boxes);
 
 public:
 
@@ -93,9 +86,11 @@ public:
 		FixpointInstruction(insn),
 		fwdConf_(fixpointBackend),
 		fwdConfWrapper_(fwdConf_, boxMan),
-		fixpoint_{},
+		minimizedSize_(0),
+		branchFinished_(false),
 		taBackend_(taBackend),
-		boxMan_(boxMan)
+		boxMan_(boxMan),
+		mutex_{}
 	{ }
 
 	virtual ~FixpointBase()
@@ -106,6 +101,15 @@ public:
 		return fwdConf_;
 	}
 
+	virtual void getAutomata(
+		std::vector<std::shared_ptr<const TreeAut>>& dst)
+	{
+		WorkerLock lock(mutex_);
+
+		if (!fwdConf_.getTransitions().empty())
+			dst.push_back(std::make_shared<const TreeAut>(fwdConf_));
+	}
+
 	virtual SymState* reverseAndIsect(
 		ExecutionManager&                      execMan,
 		const SymState&                        fwdPred,
@@ -21,11 +21,14 @@
 #define FIXPOINT_INSTRUCTION_H
 
 #include <memory>
+#include <vector>
 
 #include "treeaut_label.hh"
 
 #include "sequentialinstruction.hh"
 
+class Box;
+
 class FixpointInstruction : public SequentialInstruction {
 
 public:
@@ -35,10 +38,50 @@ public:
 
 	virtual void clear() = 0;
 
-	virtual void extendFixpoint(const std::shared_ptr<const class FAE>& fae) = 0;
+	/**
+	 * @brief  Notes that all successors of an admitted configuration have
+	 *         been explored
+	 */
+	virtual void branchFinished() = 0;
+
+	/**
+	 * @brief  Prepares the fixpoint for a restart of the analysis
+	 *
+	 * The fixpoint is kept if none of its configurations contains a node
+	 * that could be folded into any of the newly learnt @p boxes, and if the
+	 * successors of all its configurations are still being explored (they are
+	 * scheduled again then, see @p ExecutionManager::restart()).  Otherwise, it
+	 * is cleared.
+	 *
+	 * @param[in]  boxes  The boxes learnt since the last restart
+	 *
+	 * @returns  @p true if the fixpoint has been kept
+	 */
+	virtual bool restart(const std::vector<const Box*>& boxes) = 0;
 
+	/**
+	 * @brief  Retrieves the automaton of the fixpoint
+	 *
+	 * The automaton is minimised only as it grows (see
+	 * @p FA_FIXPOINT_MINIMIZATION_FACTOR), i.e. it may contain the unminimised
+	 * configurations admitted since its last minimisation.  It is not locked,
+	 * so it is to be retrieved only when no worker is running.
+	 *
+	 * @returns  The automaton of the fixpoint
+	 */
 	virtual const TreeAut& getFixPoint() const = 0;
 
+	/**
+	 * @brief  Collects the tree automata of the fixpoint
+	 *
+	 * Appends the automaton of the fixpoint (as it is, i.e. possibly not
+	 * minimised) to @p dst, e.g. for a benchmark corpus.
+	 *
+	 * @param[out]  dst  The collected automata
+	 */
+	virtual void getAutomata(
+		std::vector<std::shared_ptr<const TreeAut>>& dst) = 0;
+
 };
 
 #endif
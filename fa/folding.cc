@@ -267,18 +267,37 @@ const ConnectionGraph::StateToCutpointSignatureMap& Folding::getSignatures(
 	// Preconditions
 	assert(root < signatureMap_.size());
 
-	if (!signatureMap_[root].first)
+	RootSignatures& rootSignatures = signatureMap_[root];
+
+	if (!rootSignatures.valid)
 	{	// if the signature is not valid, recompute it
 		ConnectionGraph::computeSignatures(
-			signatureMap_[root].second, *fae_.getRoot(root)
+			rootSignatures.signatures, rootSignatures.links, *fae_.getRoot(root)
+		);
+
+		rootSignatures.valid = true;
+		rootSignatures.changed.clear();
+	} else if (!rootSignatures.changed.empty())
+	{	// if only some transitions have changed, update just the states above them
+		ConnectionGraph::updateSignatures(
+			rootSignatures.signatures, rootSignatures.links, *fae_.getRoot(root),
+			rootSignatures.changed
 		);
 
-		signatureMap_[root].first = true;
+		rootSignatures.changed.clear();
+
+#ifndef NDEBUG
+		// check the update against the signatures computed from scratch
+		ConnectionGraph::StateToCutpointSignatureMap signatures;
+		ConnectionGraph::StateToLinksMap links;
+		ConnectionGraph::computeSignatures(signatures, links, *fae_.getRoot(root));
+		assert(signatures == rootSignatures.signatures);
+#endif
 	}
 
-	assert(signatureMap_[root].first);
+	assert(rootSignatures.valid);
 
-	return signatureMap_[root].second;
+	return rootSignatures.signatures;
 }
 
 
@@ -370,7 +389,9 @@ dis2_start:
 			continue;
 		}
 
-		// the signatures of all states in the automaton
+		// the signatures of the states reachable from the final states; the
+		// unreachable ones (left behind by previous folds) do not contribute to
+		// the language of the root, so nothing is folded at them
 		const ConnectionGraph::StateToCutpointSignatureMap& signatures =
 			this->getSignatures(root);
 
@@ -733,7 +754,8 @@ const Box* Folding::makeType1Box(
 
 	fae_.connectionGraph.invalidate(root);
 
-	this->invalidateSignatures(root);
+	// only the transitions leaving 'state' have changed
+	this->invalidateSignatures(root, state);
 
 	return boxPtr;
 }
@@ -892,12 +914,15 @@ const Box* Folding::makeType2Box(
 
 	fae_.connectionGraph.invalidate(root);
 
-	this->invalidateSignatures(root);
+	// only the transitions leaving the final states have changed
+	this->invalidateSignatures(root, finalState);
+
+	const size_t auxFinalState = fae_.getRoot(aux)->getFinalState();
 
 	fae_.setRoot(aux, auxP.first);
 	fae_.connectionGraph.invalidate(aux);
 
-	this->invalidateSignatures(aux);
+	this->invalidateSignatures(aux, auxFinalState);
 
 	return boxPtr;
 }
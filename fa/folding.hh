@@ -43,12 +43,37 @@ private:  // data types
 	typedef TreeAut::Transition Transition;
 	typedef std::shared_ptr<TreeAut> TreeAutShPtr;
 
+	/**
+	 * @brief  Cutpoint signatures of the states of a root
+	 */
+	struct RootSignatures
+	{
+		/// have the signatures been computed?
+		bool valid;
+
+		/// states with transitions changed since the signatures were updated
+		std::vector<size_t> changed;
+
+		/// the signatures of the states reachable from the final states
+		ConnectionGraph::StateToCutpointSignatureMap signatures;
+
+		/// the states below and above each state, kept for the updates
+		ConnectionGraph::StateToLinksMap links;
+
+		RootSignatures() :
+			valid(false),
+			changed{},
+			signatures{},
+			links{}
+		{ }
+	};
+
 private:  // data members
 
 	FAE& fae_;
 	BoxMan& boxMan_;
 
-	std::vector<std::pair<bool, ConnectionGraph::StateToCutpointSignatureMap>> signatureMap_;
+	std::vector<RootSignatures> signatureMap_;
 
 protected:
 
@@ -128,7 +153,28 @@ protected:
 		// Preconditions
 		assert(root < signatureMap_.size());
 
-		signatureMap_[root].first = false;
+		signatureMap_[root].valid = false;
+		signatureMap_[root].changed.clear();
+	}
+
+
+	/**
+	 * @brief  Invalidates the signatures of a root after a local change
+	 *
+	 * Marks the transitions leading to @p state in the root @p root as changed,
+	 * so that only the signatures of @p state and of the states above it are
+	 * recomputed.
+	 *
+	 * @param[in]  root   Index of the root to be invalidated
+	 * @param[in]  state  The state the transitions of which have changed
+	 */
+	void invalidateSignatures(size_t root, size_t state)
+	{
+		// Preconditions
+		assert(root < signatureMap_.size());
+
+		if (signatureMap_[root].valid)
+			signatureMap_[root].changed.push_back(state);
 	}
 
 
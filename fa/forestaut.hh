@@ -36,6 +36,7 @@
 #include "abstractbox.hh"
 #include "connection_graph.hh"
 #include "streams.hh"
+#include "workermutex.hh"
 
 
 /**
@@ -61,6 +62,12 @@ public:   // data members
 
 	mutable ConnectionGraph connectionGraph;
 
+private:  // data members
+
+	/// guards the lazy update of @p connectionGraph, the forest automaton may
+	/// be shared by the states of several workers
+	mutable WorkerMutex connectionGraphMutex_;
+
 public:   // methods
 
 
@@ -98,6 +105,12 @@ protected:// methods
 		variables_ = data;
 	}
 
+	ConnectionGraph lockedConnectionGraph() const
+	{
+		WorkerLock lock(connectionGraphMutex_);
+		return this->connectionGraph;
+	}
+
 public:   // methods
 
 	static bool isData(size_t state)
@@ -109,14 +122,16 @@ public:   // methods
 		backend(&backend),
 		variables_{},
 		roots_{},
-		connectionGraph{}
+		connectionGraph{},
+		connectionGraphMutex_{}
 	{ }
 
 	FA(const FA& src) :
 		backend(src.backend),
 		variables_(src.variables_),
 		roots_(src.roots_),
-		connectionGraph(src.connectionGraph)
+		connectionGraph(src.lockedConnectionGraph()),
+		connectionGraphMutex_{}
 	{ }
 
 	/**
@@ -129,7 +144,7 @@ public:   // methods
 			backend = src.backend;
 			variables_ = src.variables_;
 			roots_ = src.roots_;
-			connectionGraph = src.connectionGraph;
+			connectionGraph = src.lockedConnectionGraph();
 		}
 
 		return *this;
@@ -213,6 +228,7 @@ public:   // methods
 
 	void updateConnectionGraph() const
 	{
+		WorkerLock lock(connectionGraphMutex_);
 		this->connectionGraph.updateIfNeeded(this->getRoots());
 	}
 
@@ -53,21 +53,21 @@ TreeAut& FAE::relabelReferences(
 		std::vector<size_t> lhs;
 		for (size_t state : tr.lhs())
 		{
-			const Data* data;
+			Data data;
 			if (this->isData(state, data))
 			{
-				if (data->isRef())
+				if (data.isRef())
 				{
-					if (index[data->d_ref.root] != static_cast<size_t>(-1))
+					if (index[data.d_ref.root] != static_cast<size_t>(-1))
 					{
-						lhs.push_back(this->addData(dst, Data::createRef(index[data->d_ref.root], data->d_ref.displ)));
+						lhs.push_back(this->addData(dst, Data::createRef(index[data.d_ref.root], data.d_ref.displ)));
 					}
 					else
 					{
 						lhs.push_back(this->addData(dst, Data::createUndef()));
 					}
 				} else {
-					lhs.push_back(this->addData(dst, *data));
+					lhs.push_back(this->addData(dst, data));
 				}
 			} else
 			{
@@ -93,8 +93,8 @@ TreeAut& FAE::invalidateReference(
 		std::vector<size_t> lhs;
 		for (size_t state : tr.lhs())
 		{
-			const Data* data;
-			if (FAE::isData(state, data) && data->isRef(root))
+			Data data;
+			if (FAE::isData(state, data) && data.isRef(root))
 			{
 				lhs.push_back(this->addData(dst, Data::createUndef()));
 			} else {
@@ -113,19 +113,18 @@ void FAE::buildLTCacheExt(
 	TreeAut::lt_cache_type&      cache)
 {
 	label_type lUndef = this->boxMan->lookupLabel(Data::createUndef());
+	std::vector<std::pair<label_type, const TT<label_type>*>> entries;
 	for (TreeAut::iterator i = ta.begin(); i != ta.end(); ++i)
 	{
 		if (i->label()->isData())
 		{
-			cache.insert(
-				make_pair(lUndef, std::vector<const TT<label_type>*>())
-			).first->second.push_back(&*i);
+			entries.push_back(std::make_pair(lUndef, &*i));
 		} else {
-			cache.insert(
-				make_pair(i->label(), std::vector<const TT<label_type>*>())
-			).first->second.push_back(&*i);
+			entries.push_back(std::make_pair(i->label(), &*i));
 		}
 	}
+
+	cache.build(entries);
 }
 
 
@@ -152,10 +152,9 @@ public:
 		size_t                          stateOffset,
 		F                               funcCompat)
 	{
-		// build TD cache and insert empty set of root transitions (if not present)
+		// build TD cache and get the (possibly empty) set of root transitions
 		TreeAut::td_cache_type cache = src.buildTDCache();
-		std::vector<const Transition*>& v = cache.insert(
-			std::make_pair(0, std::vector<const Transition*>())).first->second;
+		TreeAut::td_cache_type::Range v = cache.group(0);
 
 		for (const Transition* trans : v)
 		{ // iterate over all "synthetic" transitions and constuct new FAE for each
@@ -341,15 +340,15 @@ public:
 		return state;
 	}
 
-	bool isData(size_t state, const Data*& data) const
+	bool isData(size_t state, Data& data) const
 	{
 		if (!FA::isData(state))
 			return false;
-		data = &this->boxMan->getData(_MSB_GET(state));
+		data = this->boxMan->getData(_MSB_GET(state));
 		return true;
 	}
 
-	const Data& getData(size_t state) const
+	Data getData(size_t state) const
 	{
 		assert(FA::isData(state));
 
@@ -361,7 +360,7 @@ public:
 		if (!FA::isData(state))
 			return false;
 
-		const Data& data = this->boxMan->getData(_MSB_GET(state));
+		const Data data = this->boxMan->getData(_MSB_GET(state));
 		if (!data.isRef())
 			return false;
 
@@ -373,7 +372,7 @@ public:
 	{
 		assert(FA::isData(state));
 
-		const Data& data = this->boxMan->getData(_MSB_GET(state));
+		const Data data = this->boxMan->getData(_MSB_GET(state));
 
 		assert(data.isRef());
 
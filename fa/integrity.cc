@@ -111,9 +111,9 @@ struct Integrity::CheckIntegrityF
 				{
 					assert(offset + i < this->t.lhs().size());
 
-					const Data* data;
+					Data data;
 
-					if (this->integrity.fae_.isData(this->t.lhs()[offset + i], data) && !data->isRef() && !data->isUndef())
+					if (this->integrity.fae_.isData(this->t.lhs()[offset + i], data) && !data.isRef() && !data.isUndef())
 						return false;
 
 					if (!this->integrity.checkState(this->ta, this->t.lhs()[offset + i], tmp->inputCoverage(i), this->bitmap, states))
@@ -176,14 +176,14 @@ bool Integrity::checkState(
 	std::vector<bool>& bitmap,
 	std::map<std::pair<const TreeAut*, size_t>, std::set<size_t>>& states) const
 {
-	const Data* data;
+	Data data;
 
 	if (fae_.isData(state, data))
 	{
-		if (!data->isRef())
+		if (!data.isRef())
 			return true;
 
-		return this->checkRoot(data->d_ref.root, bitmap, states);
+		return this->checkRoot(data.d_ref.root, bitmap, states);
 	}
 
 	auto p = states.insert(std::make_pair(std::make_pair(&ta, state), defined));
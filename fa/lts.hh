@@ -20,79 +20,323 @@
 #ifndef LTS_H
 #define LTS_H
 
-#include "smartset.hh"
+// Standard library headers
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
 
-class LTS {
+/**
+ * @brief  A labelled transition system in the compressed sparse row format
+ *
+ * The transitions are first collected by @p addTransition() and then turned
+ * by @p build() into two CSR tables: one holding the predecessors of each
+ * state, grouped by labels, and one holding the successors of each state,
+ * grouped by labels in the same way.  Both the tables are built by counting
+ * sort in time linear in the number of states, labels, and transitions, and
+ * they take space linear in the same.  In particular, nothing is allocated per
+ * a pair of a label and a state that has no transition under the label.
+ */
+class LTS
+{
+public:   // data types
+
+	/**
+	 * @brief  A contiguous range of indices stored in the LTS
+	 */
+	class Range
+	{
+	private:  // data members
+
+		const size_t* begin_;
+		const size_t* end_;
+
+	public:   // methods
+
+		Range(const size_t* begin, const size_t* end) :
+			begin_(begin),
+			end_(end)
+		{ }
+
+		typedef const size_t* const_iterator;
+
+		const size_t* begin() const { return begin_; }
+		const size_t* end() const { return end_; }
+
+		size_t size() const { return end_ - begin_; }
+		bool empty() const { return begin_ == end_; }
+	};
+
+private:  // data types
+
+	struct Transition
+	{
+		size_t q;
+		size_t a;
+		size_t r;
+	};
+
+	/**
+	 * @brief  Transitions of all states grouped by the states and the labels
+	 *
+	 * The labels of state @p s are @p labels[labelOff[s] .. labelOff[s + 1]),
+	 * sorted.  The states related to @p s by the @p k-th of those labels are
+	 * @p data[groupOff[k] .. groupOff[k + 1]).
+	 */
+	struct Table
+	{
+		std::vector<size_t> labelOff;
+		std::vector<size_t> labels;
+		std::vector<size_t> groupOff;
+		std::vector<size_t> data;
+
+		Table() :
+			labelOff(),
+			labels(),
+			groupOff(),
+			data()
+		{ }
+
+		void build(
+			const std::vector<Transition>&   trans,
+			size_t Transition::*             state,
+			size_t Transition::*             item,
+			size_t                           states)
+		{
+			labelOff.assign(states + 1, 0);
+			labels.clear();
+			groupOff.clear();
+			data.resize(trans.size());
+
+			// the transitions are sorted by (state, label)
+			size_t k = 0;
+			for (size_t s = 0; s < states; ++s)
+			{
+				labelOff[s] = labels.size();
+				for (; (k < trans.size()) && (trans[k].*state == s); ++k)
+				{
+					if ((labels.size() == labelOff[s]) || (labels.back() != trans[k].a))
+					{
+						labels.push_back(trans[k].a);
+						groupOff.push_back(k);
+					}
+
+					data[k] = trans[k].*item;
+				}
+			}
+
+			labelOff[states] = labels.size();
+			groupOff.push_back(trans.size());
+		}
+
+		/**
+		 * @brief  Returns the position of label @p a among the labels of @p s
+		 */
+		size_t find(size_t s, size_t a) const
+		{
+			const size_t* begin = labels.data() + labelOff[s];
+			const size_t* end = labels.data() + labelOff[s + 1];
+			const size_t* i = std::lower_bound(begin, end, a);
+			return ((i != end) && (*i == a)) ? (i - labels.data()) : labels.size();
+		}
+
+		Range group(size_t s, size_t a) const
+		{
+			const size_t k = this->find(s, a);
+			if (k == labels.size())
+				return Range(nullptr, nullptr);
+
+			return Range(data.data() + groupOff[k], data.data() + groupOff[k + 1]);
+		}
+
+		Range labelsOf(size_t s) const
+		{
+			if (labelOff[s] == labelOff[s + 1])
+				return Range(nullptr, nullptr);
+
+			return Range(labels.data() + labelOff[s], labels.data() + labelOff[s + 1]);
+		}
+	};
+
+private:  // data members
 
 	size_t _labels;
 	size_t _states;
+
+	/// the transitions added since the last call of build()
+	std::vector<Transition> _trans;
+
+	/// predecessors of states: (r, a) -> { q | q --a--> r }
+	Table _pre;
+
+	/// successors of states: (q, a) -> { r | q --a--> r }
+	Table _post;
+
+	/// for each successor group of @p _post, the rank of its state in @p _src
+	std::vector<size_t> _postKey;
+
+	/// the sources of transitions by label: a -> { q | q --a--> _ }, sorted
+	std::vector<size_t> _srcOff;
+	std::vector<size_t> _src;
+
 	size_t _transitions;
-	std::vector<std::vector<std::vector<size_t> > > _dataPre;
-	std::vector<SmartSet> _lPre;
+	bool _built;
+
+private:  // methods
+
+	/**
+	 * @brief  Stable counting sort of transitions by the given member
+	 */
+	static void sortBy(
+		std::vector<Transition>&         trans,
+		size_t Transition::*             member,
+		size_t                           range,
+		std::vector<Transition>&         tmp)
+	{
+		std::vector<size_t> off(range + 1, 0);
+		for (const Transition& t : trans)
+			++off[t.*member + 1];
+
+		for (size_t i = 0; i < range; ++i)
+			off[i + 1] += off[i];
+
+		tmp.resize(trans.size());
+		for (const Transition& t : trans)
+			tmp[off[t.*member]++] = t;
+
+		trans.swap(tmp);
+	}
 
 public:
 
 	LTS(size_t labels = 0, size_t states = 0) :
-		_labels(labels), _states(states), _transitions(0),
-		_dataPre(labels, std::vector<std::vector<size_t> >(states)),
-		_lPre(states, SmartSet(labels)) {}
-/*
-	LTS(const LTS& lts) :
-		_labels(lts._labels), _states(lts._states), _transitions(lts._transitions),
-		_dataPre(lts._dataPre),
-		_lPre(lts._lPre) {}
-*/
-	void addTransition(size_t q, size_t a, size_t r) {
-		if (a >= this->_dataPre.size())
+		_labels(labels),
+		_states(states),
+		_trans(),
+		_pre(),
+		_post(),
+		_postKey(),
+		_srcOff(),
+		_src(),
+		_transitions(0),
+		_built(false)
+	{ }
+
+	void addTransition(size_t q, size_t a, size_t r)
+	{
+		if (a >= this->_labels)
 			throw std::runtime_error("label index out of range");
-		if (r >= this->_dataPre[a].size()) {
-			std::cout << r << "<" << this->_dataPre[a].size() << "\n";
+		if ((q >= this->_states) || (r >= this->_states))
 			throw std::runtime_error("state index out of range");
+
+		assert(!this->_built);
+		this->_trans.push_back(Transition{q, a, r});
+	}
+
+	/**
+	 * @brief  Builds the CSR tables from the transitions added so far
+	 *
+	 * Needs to be called once all the transitions have been added and before
+	 * the LTS is queried.  The list of added transitions is released then, no
+	 * transitions can be added afterwards.
+	 */
+	void build()
+	{
+		std::vector<Transition> tmp;
+
+		this->_transitions = this->_trans.size();
+
+		// successors, sorted by (q, a)
+		sortBy(this->_trans, &Transition::a, this->_labels, tmp);
+		sortBy(this->_trans, &Transition::q, this->_states, tmp);
+		this->_post.build(this->_trans, &Transition::q, &Transition::r, this->_states);
+
+		// as the groups are sorted by q, the sources of each label come sorted
+		this->_srcOff.assign(this->_labels + 1, 0);
+		for (size_t a : this->_post.labels)
+			++this->_srcOff[a + 1];
+
+		for (size_t a = 0; a < this->_labels; ++a)
+			this->_srcOff[a + 1] += this->_srcOff[a];
+
+		std::vector<size_t> next(this->_srcOff.begin(), this->_srcOff.end() - 1);
+		this->_src.resize(this->_post.labels.size());
+		this->_postKey.resize(this->_post.labels.size());
+		for (size_t q = 0; q < this->_states; ++q)
+		{
+			for (size_t k = this->_post.labelOff[q]; k < this->_post.labelOff[q + 1]; ++k)
+			{
+				const size_t a = this->_post.labels[k];
+				this->_postKey[k] = next[a] - this->_srcOff[a];
+				this->_src[next[a]++] = q;
+			}
 		}
-		if (q >= this->_dataPre[a].size())
-			throw std::runtime_error("state index out of range");
-		this->_dataPre[a][r].push_back(q);
-		this->_lPre[r].add(a);
-		++this->_transitions;
+
+		// predecessors, sorted by (r, a)
+		sortBy(this->_trans, &Transition::a, this->_labels, tmp);
+		sortBy(this->_trans, &Transition::r, this->_states, tmp);
+		this->_pre.build(this->_trans, &Transition::r, &Transition::q, this->_states);
+
+		// release the memory of the transitions
+		std::vector<Transition>().swap(this->_trans);
+
+		this->_built = true;
 	}
 
-	const std::vector<size_t>& pre(size_t q, size_t a) const {
-		return this->_dataPre[a][q];
+	/**
+	 * @brief  The states @p q such that @p q --a--> @p r
+	 */
+	Range pre(size_t r, size_t a) const
+	{
+		assert(this->_built);
+		return this->_pre.group(r, a);
 	}
-/*
-	method iter f =
-    Array.iteri (fun a pre_a -> Array.iteri (fun r pre_a_r -> List.iter (fun q -> f q a r) pre_a_r) pre_a) _data_pre
-*/
-	const std::vector<std::vector<std::vector<size_t> > >& dataPre() const { return this->_dataPre; }
-
-	void buildPost(size_t label, std::vector<std::vector<size_t> >& dst) const {
-		dst.clear();
-		dst.resize(this->_states);
-		for (size_t i = 0; i < this->_dataPre[label].size(); ++i) {
-			for (std::vector<size_t>::const_iterator j = this->_dataPre[label][i].begin(); j != this->_dataPre[label][i].end(); ++j)
-				dst[*j].push_back(i);
-		}
+
+	/**
+	 * @brief  The states @p r such that @p q --a--> @p r
+	 */
+	Range post(size_t q, size_t a) const
+	{
+		assert(this->_built);
+		return this->_post.group(q, a);
 	}
-	
-	void buildDelta(std::vector<SmartSet>& delta, std::vector<SmartSet>& delta1) const {
-		delta.resize(this->_labels);
-		delta1.resize(this->_labels);
-		for (size_t a = 0; a < this->_labels; ++a) {
-			delta[a] = SmartSet(this->_states);
-			delta1[a] = SmartSet(this->_states);
-			for (size_t i = 0; i < this->_dataPre[a].size(); ++i) {
-				for (std::vector<size_t>::const_iterator j = this->_dataPre[a][i].begin(); j != this->_dataPre[a][i].end(); ++j) {
-					delta[a].add(i);
-					delta1[a].add(*j);
-				}
-			}
-		}
+
+	/**
+	 * @brief  The labels of transitions leading to @p r, sorted
+	 */
+	Range lPre(size_t r) const
+	{
+		assert(this->_built);
+		return this->_pre.labelsOf(r);
 	}
 
-	const std::vector<SmartSet>& lPre() const {
-		return this->_lPre;
+	/**
+	 * @brief  The states having an outgoing transition under @p a, sorted
+	 */
+	Range sources(size_t a) const
+	{
+		assert(this->_built);
+		if (this->_srcOff[a] == this->_srcOff[a + 1])
+			return Range(nullptr, nullptr);
+
+		return Range(this->_src.data() + this->_srcOff[a],
+			this->_src.data() + this->_srcOff[a + 1]);
+	}
+
+	/**
+	 * @brief  The position of @p q within @p sources(a)
+	 *
+	 * @p q is required to have an outgoing transition under @p a.
+	 */
+	size_t key(size_t a, size_t q) const
+	{
+		assert(this->_built);
+		const size_t k = this->_post.find(q, a);
+		assert(k < this->_postKey.size());
+		return this->_postKey[k];
 	}
-	
+
 	size_t labels() const {
 		return this->_labels;
 	}
@@ -101,32 +345,20 @@ public:
 		return this->_states;
 	}
 
+	size_t transitions() const {
+		return this->_transitions;
+	}
+
 	void dump() const {
-		std::cout << "states: " << this->_states << ", labels: " << this->_labels << std::endl;
-		for (size_t i = 0; i < this->_labels; ++i) {
-			for (size_t j = 0; j < this->_states; ++j) {
-				for (size_t k = 0; k < this->_dataPre[i][j].size(); ++k)
-					std::cout << this->_dataPre[i][j][k] << " --" << i << "--> " << j << std::endl;
+		std::cout << "states: " << this->_states << ", labels: " << this->_labels
+			<< ", transitions: " << this->_transitions << std::endl;
+		for (size_t r = 0; r < this->_states; ++r) {
+			for (size_t a : this->lPre(r)) {
+				for (size_t q : this->pre(r, a))
+					std::cout << q << " --" << a << "--> " << r << std::endl;
 			}
 		}
 	}
-
-/*
-(*
-		method setData d = (
-		_data <- d;
-		_nsymbols <- Array.length _data;
-		_nstates <- Array.length _data.(0)
-	)
-*)	
-	method nsymbols = _nsymbols
-	method nstates = _nstates
-	method ntransitions = _ntransitions
-	
-	method stats =
-		Printf.sprintf "states: %d, symbols: %d, transitions: %d" _nstates _nsymbols _ntransitions
-
-*/
 };
 
 #endif
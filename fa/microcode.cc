@@ -172,97 +172,75 @@ void FI_acc_all::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_load_cst
-void FI_load_cst::execute(ExecutionManager& execMan, SymState& state)
+void FI_load_cst::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, data_);
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, data_);
 }
 
 // FI_move_reg
-void FI_move_reg::execute(ExecutionManager& execMan, SymState& state)
+void FI_move_reg::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, tmpState->GetReg(src_));
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, state.GetReg(src_));
 }
 
 // FI_bnot
-void FI_bnot::execute(ExecutionManager& execMan, SymState& state)
+void FI_bnot::assign(SymState& state, const SymState&) const
 {
 	// Assertions
 	assert(state.GetReg(dstReg_).isBool());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, Data::createBool(!tmpState->GetReg(dstReg_).d_bool));
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, Data::createBool(!state.GetReg(dstReg_).d_bool));
 }
 
 // FI_inot
-void FI_inot::execute(ExecutionManager& execMan, SymState& state)
+void FI_inot::assign(SymState& state, const SymState&) const
 {
 	// Assertions
 	assert(state.GetReg(dstReg_).isInt());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	tmpState->SetReg(dstReg_, Data::createBool(!tmpState->GetReg(dstReg_).d_int));
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, Data::createBool(!state.GetReg(dstReg_).d_int));
 }
 
 // FI_move_reg_offs
-void FI_move_reg_offs::execute(ExecutionManager& execMan, SymState& state)
+void FI_move_reg_offs::assign(SymState& state, const SymState& pred) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = tmpState->GetReg(src_);
+	Data data = state.GetReg(src_);
 
 	if (!data.isRef())
 	{
 		std::stringstream ss;
 		ss << "dereferenced value is not a valid reference [" << data << ']';
-		throw ProgramError(ss.str(), &state, getLoc(state));
+		throw ProgramError(ss.str(), &pred, getLoc(pred));
 	}
 
 	data.d_ref.displ += offset_;
 
-	tmpState->SetReg(dstReg_, data);
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, data);
 }
 
 // FI_move_reg_inc
-void FI_move_reg_inc::execute(ExecutionManager& execMan, SymState& state)
+void FI_move_reg_inc::assign(SymState& state, const SymState& pred) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = tmpState->GetReg(src1_);
+	Data data = state.GetReg(src1_);
 
 	if (!data.isRef())
 	{
 		std::stringstream ss;
 		ss << "dereferenced value is not a valid reference [" << data << ']';
-		throw ProgramError(ss.str(), &state, getLoc(state));
+		throw ProgramError(ss.str(), &pred, getLoc(pred));
 	}
 
 	// make sure that the value is really integer
-	assert(tmpState->GetReg(src2_).isInt());
-
-	data.d_ref.displ += tmpState->GetReg(src2_).d_int;
-	tmpState->SetReg(dstReg_, data);
+	assert(state.GetReg(src2_).isInt());
 
-	execMan.enqueue(tmpState);
+	data.d_ref.displ += state.GetReg(src2_).d_int;
+	state.SetReg(dstReg_, data);
 }
 
 // FI_get_greg
-void FI_get_greg::execute(ExecutionManager& execMan, SymState& state)
+void FI_get_greg::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-
-	tmpState->SetReg(dstReg_, VirtualMachine(*(tmpState->GetFAE())).varGet(src_));
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, VirtualMachine(*(state.GetFAE())).varGet(src_));
 }
 
 // FI_set_greg
@@ -278,67 +256,54 @@ void FI_set_greg::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_get_ABP
-void FI_get_ABP::execute(ExecutionManager& execMan, SymState& state)
+void FI_get_ABP::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = VirtualMachine(*(tmpState->GetFAE())).varGet(ABP_INDEX);
+	Data data = VirtualMachine(*(state.GetFAE())).varGet(ABP_INDEX);
 	data.d_ref.displ += offset_;
 
-	tmpState->SetReg(dstReg_, data);
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, data);
 }
 
 // FI_get_GLOB
-void FI_get_GLOB::execute(ExecutionManager& execMan, SymState& state)
+void FI_get_GLOB::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	Data data = VirtualMachine(*(tmpState->GetFAE())).varGet(GLOB_INDEX);
+	Data data = VirtualMachine(*(state.GetFAE())).varGet(GLOB_INDEX);
 	data.d_ref.displ += offset_;
 
-	tmpState->SetReg(dstReg_, data);
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, data);
 }
 
 // FI_load
-void FI_load::execute(ExecutionManager& execMan, SymState& state)
+void FI_load::assign(SymState& state, const SymState&) const
 {
 	// Assertions
 	assert(state.GetReg(src_).isRef());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-
-	Data data = tmpState->GetReg(src_);
+	Data data = state.GetReg(src_);
 
 	Data out;
-	VirtualMachine(*(tmpState->GetFAE())).nodeLookup(
+	VirtualMachine(*(state.GetFAE())).nodeLookup(
 		data.d_ref.root, data.d_ref.displ + offset_, out
 	);
 
-	tmpState->SetReg(dstReg_, out);
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, out);
 }
 
 // FI_load_ABP
-void FI_load_ABP::execute(ExecutionManager& execMan, SymState& state)
+void FI_load_ABP::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	VirtualMachine vm(*(tmpState->GetFAE()));
+	VirtualMachine vm(*(state.GetFAE()));
 
 	Data data = vm.varGet(ABP_INDEX);
 	Data out;
 	vm.nodeLookup(data.d_ref.root, static_cast<size_t>(offset_), out);
-	tmpState->SetReg(dstReg_, out);
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, out);
 }
 
 // FI_load_GLOB
-void FI_load_GLOB::execute(ExecutionManager& execMan, SymState& state)
+void FI_load_GLOB::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	VirtualMachine vm(*(tmpState->GetFAE()));
+	VirtualMachine vm(*(state.GetFAE()));
 
 	Data data = vm.varGet(GLOB_INDEX);
 	// make sure that the value is really a tree reference
@@ -346,9 +311,7 @@ void FI_load_GLOB::execute(ExecutionManager& execMan, SymState& state)
 
 	Data out;
 	vm.nodeLookup(data.d_ref.root, static_cast<size_t>(offset_), out);
-	tmpState->SetReg(dstReg_, out);
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, out);
 }
 
 // FI_store
@@ -376,22 +339,20 @@ void FI_store::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_loads
-void FI_loads::execute(ExecutionManager& execMan, SymState& state)
+void FI_loads::assign(SymState& state, const SymState&) const
 {
 	// Assertions
 	assert(state.GetReg(src_).isRef());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-	const Data& data = tmpState->GetReg(src_);
+	const Data data = state.GetReg(src_);
 
 	Data out;
-	VirtualMachine(*(tmpState->GetFAE())).nodeLookupMultiple(
+	VirtualMachine(*(state.GetFAE())).nodeLookupMultiple(
 		data.d_ref.root, data.d_ref.displ + base_, offsets_,
 		out
 	);
 
-	tmpState->SetReg(dstReg_, out);
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, out);
 }
 
 // FI_stores
@@ -515,17 +476,13 @@ void FI_node_free::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_iadd
-void FI_iadd::execute(ExecutionManager& execMan, SymState& state)
+void FI_iadd::assign(SymState& state, const SymState&) const
 {
 	// Assertions
 	assert(state.GetReg(src1_).isInt() && state.GetReg(src2_).isInt());
 
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-
-	int sum = tmpState->GetReg(src1_).d_int + tmpState->GetReg(src2_).d_int;
-	tmpState->SetReg(dstReg_, Data::createInt((sum > 0)? 1 : 0));
-
-	execMan.enqueue(tmpState);
+	int sum = state.GetReg(src1_).d_int + state.GetReg(src2_).d_int;
+	state.SetReg(dstReg_, Data::createInt((sum > 0)? 1 : 0));
 }
 
 // FI_check
@@ -546,7 +503,7 @@ void FI_assert::execute(ExecutionManager& execMan, SymState& state)
 
 	if (tmpState->GetReg(dst_) != cst_)
 	{
-		FA_DEBUG_AT(1, "registers: " << utils::wrap(state.GetRegs()) << ", heap:"
+		FA_DEBUG_AT(1, "registers: " << state.GetRegs() << ", heap:"
 			<< std::endl << *(state.GetFAE()));
 		throw std::runtime_error("assertion failed");
 	}
@@ -561,20 +518,16 @@ void FI_abort::execute(ExecutionManager& execMan, SymState& state)
 }
 
 // FI_build_struct
-void FI_build_struct::execute(ExecutionManager& execMan, SymState& state)
+void FI_build_struct::assign(SymState& state, const SymState&) const
 {
-	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
-
 	std::vector<Data::item_info> items;
 
 	for (size_t i = 0; i < offsets_.size(); ++i)
 	{
-		items.push_back(std::make_pair(offsets_[i], tmpState->GetReg(start_ + i)));
+		items.push_back(std::make_pair(offsets_[i], state.GetReg(start_ + i)));
 	}
 
-	tmpState->SetReg(dstReg_, Data::createStruct(items));
-
-	execMan.enqueue(tmpState);
+	state.SetReg(dstReg_, Data::createStruct(items));
 }
 
 // FI_push_greg
@@ -624,8 +577,8 @@ struct DumpCtx {
 		vm.nodeLookupMultiple(vm.varGet(ABP_INDEX).d_ref.root, 0, offs, data);
 
 		std::unordered_map<size_t, Data> tmp;
-		for (std::vector<Data::item_info>::const_iterator i = data.d_struct->begin();
-			i != data.d_struct->end(); ++i)
+		for (std::vector<Data::item_info>::const_iterator i = data.GetStruct().begin();
+			i != data.GetStruct().end(); ++i)
 			tmp.insert(std::make_pair(i->first, i->second));
 
 		for (CodeStorage::TVarSet::const_iterator i = cd.ctx.GetFnc().vars.begin();
@@ -683,11 +636,23 @@ void FI_plot_heap::execute(ExecutionManager& execMan, SymState& state)
 }
 
 
+// FI_fused
+void FI_fused::execute(ExecutionManager& execMan, SymState& state)
+{
+	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
+
+	for (const PureRegisterAssignment* instr : body_)
+		instr->assign(*tmpState, state);
+
+	execMan.enqueue(tmpState);
+}
+
+
 void FI_error::execute(ExecutionManager& execMan, SymState& state)
 {
 	(void)execMan;
 
-	FA_DEBUG_AT(1, "registers: " << utils::wrap(state.GetRegs()) << ", heap:"
+	FA_DEBUG_AT(1, "registers: " << state.GetRegs() << ", heap:"
 		<< std::endl << *(state.GetFAE()));
 	throw ProgramError(msg_, &state, getLoc(state));
 }
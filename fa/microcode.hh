@@ -180,7 +180,7 @@ public:
 /**
  * @brief  Loads a constant into a register
  */
-class FI_load_cst : public RegisterAssignment
+class FI_load_cst : public PureRegisterAssignment
 {
 	/// The data value to be loaded into the register denoted by @p dst_
 	Data data_;
@@ -188,9 +188,11 @@ class FI_load_cst : public RegisterAssignment
 public:
 
 	FI_load_cst(const CodeStorage::Insn* insn, size_t dst, const Data& data)
-		: RegisterAssignment(insn, dst), data_(data) {}
+		: PureRegisterAssignment(insn, dst), data_(data) {}
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t) const { return false; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", " << this->data_;
@@ -201,7 +203,7 @@ public:
 /**
  * @brief  Moves a value between two registers
  */
-class FI_move_reg : public RegisterAssignment
+class FI_move_reg : public PureRegisterAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -209,13 +211,15 @@ class FI_move_reg : public RegisterAssignment
 public:
 
 	FI_move_reg(const CodeStorage::Insn* insn, size_t dst, size_t src)
-		: RegisterAssignment(insn, dst), src_(src)
+		: PureRegisterAssignment(insn, dst), src_(src)
 	{
 		// Check that we don't make a useless move
 		assert(src_ != dstReg_);
 	}
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return reg == src_; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", r" << this->src_;
@@ -226,14 +230,16 @@ public:
 /**
  * @brief  Negates a Boolean value in a register
  */
-class FI_bnot : public RegisterAssignment
+class FI_bnot : public PureRegisterAssignment
 {
 public:
 
 	FI_bnot(const CodeStorage::Insn* insn, size_t dst)
-		: RegisterAssignment(insn, dst) { }
+		: PureRegisterAssignment(insn, dst) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return reg == this->dstReg_; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "not   \tr" << this->dstReg_;
@@ -246,14 +252,16 @@ public:
  *
  * Negates an integer value in a register: the result is a Boolean.
  */
-class FI_inot : public RegisterAssignment
+class FI_inot : public PureRegisterAssignment
 {
 public:
 
 	FI_inot(const CodeStorage::Insn* insn, size_t dst) :
-		RegisterAssignment(insn, dst) { }
+		PureRegisterAssignment(insn, dst) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return reg == this->dstReg_; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "not   \tr" << this->dstReg_;
@@ -268,7 +276,7 @@ public:
  * register. Before storing the reference into the target register, the
  * displacement is incremented by a specified offset.
  */
-class FI_move_reg_offs : public RegisterAssignment
+class FI_move_reg_offs : public PureRegisterAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -280,10 +288,14 @@ public:
 
 	FI_move_reg_offs(const CodeStorage::Insn* insn,
 		size_t dst, size_t src, int offset)
-		: RegisterAssignment(insn, dst), src_(src), offset_(offset)
+		: PureRegisterAssignment(insn, dst), src_(src), offset_(offset)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return reg == src_; }
+
+	virtual bool mayFail() const { return true; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", r" << this->src_
@@ -299,7 +311,7 @@ public:
  * register. Before storing the reference into the target register, the
  * displacement is incremented by the value in the specified register.
  */
-class FI_move_reg_inc : public RegisterAssignment
+class FI_move_reg_inc : public PureRegisterAssignment
 {
 	/// Index of the source register
 	size_t src1_;
@@ -311,10 +323,14 @@ public:
 
 	FI_move_reg_inc(const CodeStorage::Insn* insn,
 		size_t dst, size_t src1, size_t src2)
-		: RegisterAssignment(insn, dst), src1_(src1), src2_(src2)
+		: PureRegisterAssignment(insn, dst), src1_(src1), src2_(src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return (reg == src1_) || (reg == src2_); }
+
+	virtual bool mayFail() const { return true; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", r" << this->src1_
@@ -328,7 +344,7 @@ public:
  *
  * Loads the value from a global register into a local register.
  */
-class FI_get_greg : public RegisterAssignment
+class FI_get_greg : public PureRegisterAssignment
 {
 	/// Index of the source global register
 	size_t src_;
@@ -336,9 +352,11 @@ class FI_get_greg : public RegisterAssignment
 public:
 
 	FI_get_greg(const CodeStorage::Insn* insn, size_t dst, size_t src)
-		: RegisterAssignment(insn, dst), src_(src) { }
+		: PureRegisterAssignment(insn, dst), src_(src) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t) const { return false; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", gr" << this->src_;
@@ -382,7 +400,7 @@ public:
  *
  * Loads the ABP pointer incremented by the specified offset into a register.
  */
-class FI_get_ABP : public RegisterAssignment
+class FI_get_ABP : public PureRegisterAssignment
 {
 	/// Offset to be added to the loaded pointer
 	int offset_;
@@ -390,9 +408,11 @@ class FI_get_ABP : public RegisterAssignment
 public:
 
 	FI_get_ABP(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst), offset_(offset) { }
+		: PureRegisterAssignment(insn, dst), offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t) const { return false; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", ABP + " << this->offset_;
@@ -405,7 +425,7 @@ public:
  *
  * Loads the GLOB pointer incremented by the specified offset into a register.
  */
-class FI_get_GLOB : public RegisterAssignment
+class FI_get_GLOB : public PureRegisterAssignment
 {
 	/// Offset to be added to the loaded pointer
 	int offset_;
@@ -413,9 +433,11 @@ class FI_get_GLOB : public RegisterAssignment
 public:
 
 	FI_get_GLOB(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst),  offset_(offset) { }
+		: PureRegisterAssignment(insn, dst),  offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t) const { return false; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", GLOB + " << this->offset_;
@@ -429,7 +451,7 @@ public:
  * Loads a value at a given @p offset_ from the location pointed by the @p src_
  * register into the @p dst_ register.
  */
-class FI_load : public RegisterAssignment
+class FI_load : public PureRegisterAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -440,10 +462,12 @@ class FI_load : public RegisterAssignment
 public:
 
 	FI_load(const CodeStorage::Insn* insn, size_t dst, size_t src, int offset)
-		: RegisterAssignment(insn, dst), src_(src), offset_(offset)
+		: PureRegisterAssignment(insn, dst), src_(src), offset_(offset)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return reg == src_; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [r" << this->src_
@@ -458,7 +482,7 @@ public:
  * Loads a value which is at the specified offset from the location pointed by
  * the ABP pointer into a register.
  */
-class FI_load_ABP : public RegisterAssignment
+class FI_load_ABP : public PureRegisterAssignment
 {
 	/// Offset from the ABP 
 	int offset_;
@@ -466,9 +490,11 @@ class FI_load_ABP : public RegisterAssignment
 public:
 
 	FI_load_ABP(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst), offset_(offset) { }
+		: PureRegisterAssignment(insn, dst), offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t) const { return false; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [ABP + " << this->offset_ << ']';
@@ -482,7 +508,7 @@ public:
  * Loads a value which is at the specified offset from the location pointed by
  * the GLOB pointer into a register.
  */
-class FI_load_GLOB : public RegisterAssignment
+class FI_load_GLOB : public PureRegisterAssignment
 {
 	/// Offset from the GLOB
 	int offset_;
@@ -490,9 +516,11 @@ class FI_load_GLOB : public RegisterAssignment
 public:
 
 	FI_load_GLOB(const CodeStorage::Insn* insn, size_t dst, int offset)
-		: RegisterAssignment(insn, dst), offset_(offset) { }
+		: PureRegisterAssignment(insn, dst), offset_(offset) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t) const { return false; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [GLOB + " << this->offset_ << ']';
@@ -547,7 +575,7 @@ public:
  * Loads a structure with multiple offsets pointed by the @p src_ register into
  * the @p dst_ register.
  */
-class FI_loads : public RegisterAssignment
+class FI_loads : public PureRegisterAssignment
 {
 	/// Index of the source register
 	size_t src_;
@@ -562,11 +590,13 @@ public:
 
 	FI_loads(const CodeStorage::Insn* insn, size_t dst, size_t src, int base,
 		const std::vector<size_t>& offsets) :
-		RegisterAssignment(insn, dst), src_(src), base_(base),
+		PureRegisterAssignment(insn, dst), src_(src), base_(base),
 		offsets_(offsets)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return reg == src_; }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "mov   \tr" << this->dstReg_ << ", [r" << this->src_ << " + "
@@ -744,7 +774,7 @@ public:
 /**
  * @brief  Computes integer addition
  */
-class FI_iadd : public RegisterAssignment
+class FI_iadd : public PureRegisterAssignment
 {
 	/// Index of the register with the first operand
 	size_t src1_;
@@ -755,10 +785,12 @@ class FI_iadd : public RegisterAssignment
 public:
 
 	FI_iadd(const CodeStorage::Insn* insn, size_t dst, size_t src1, size_t src2)
-		: RegisterAssignment(insn, dst), src1_(src1), src2_(src2)
+		: PureRegisterAssignment(insn, dst), src1_(src1), src2_(src2)
 	{ }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return (reg == src1_) || (reg == src2_); }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		return os << "iadd  \tr" << this->dstReg_ << ", r" << this->src1_
@@ -848,7 +880,7 @@ public:
  * Builds a memory structure (e.g. a stack frame) from registers' content
  * (starting from the @p start_ register.
  */
-class FI_build_struct : public RegisterAssignment
+class FI_build_struct : public PureRegisterAssignment
 {
 	/// Index of the starting register
 	size_t start_;
@@ -860,9 +892,11 @@ public:
 
 	FI_build_struct(const CodeStorage::Insn* insn, size_t dst, size_t start,
 		const std::vector<size_t>& offsets) :
-		RegisterAssignment(insn, dst), start_(start), offsets_(offsets) { }
+		PureRegisterAssignment(insn, dst), start_(start), offsets_(offsets) { }
 
-	virtual void execute(ExecutionManager& execMan, SymState& state);
+	virtual void assign(SymState& state, const SymState& pred) const;
+
+	virtual bool readsReg(size_t reg) const { return (start_ <= reg) && (reg < start_ + offsets_.size()); }
 
 	virtual std::ostream& toStream(std::ostream& os) const {
 		os << "mov   \tr" << this->dstReg_ << ", {";
@@ -985,6 +1019,74 @@ public:
 	}
 };
 
+/**
+ * @brief  A sequence of fused pure register assignments
+ *
+ * Performs a sequence of pure register assignments (which stay in the code as
+ * they are) in a single step, i.e. without the intermediate states. The
+ * sequence is created by the compiler once the code is finalised, assignments
+ * whose results are overwritten later in the sequence are left out.
+ */
+class FI_fused : public SequentialInstruction
+{
+private:  // data members
+
+	/// the assignments to be performed (in this order)
+	std::vector<const PureRegisterAssignment*> body_;
+
+private:  // methods
+
+	FI_fused(const FI_fused&);
+	FI_fused& operator=(const FI_fused&);
+
+public:
+
+	FI_fused(const CodeStorage::Insn* insn,
+		const std::vector<const PureRegisterAssignment*>& body,
+		AbstractInstruction* next) :
+		SequentialInstruction(insn),
+		body_(body)
+	{
+		// Assertions
+		assert(!body_.empty());
+
+		this->next_ = next;
+	}
+
+	virtual void execute(ExecutionManager& execMan, SymState& state);
+
+	/**
+	 * @brief  Does nothing, the instruction is created in finalised code
+	 */
+	virtual void finalize(
+		const std::unordered_map<const CodeStorage::Block*,
+		AbstractInstruction*>& codeIndex,
+		std::vector<AbstractInstruction*>::const_iterator cur)
+	{
+		(void)codeIndex;
+		(void)cur;
+	}
+
+	virtual SymState* reverseAndIsect(
+		ExecutionManager&                      execMan,
+		const SymState&                        fwdPred,
+		const SymState&                        bwdSucc) const;
+
+	virtual std::ostream& toStream(std::ostream& os) const
+	{
+		os << "fused \t{ ";
+		for (const PureRegisterAssignment* instr : body_)
+		{
+			if (instr != body_.front())
+				os << "; ";
+
+			os << *instr;
+		}
+
+		return os << " }";
+	}
+};
+
 /**
  * @brief  Error instruction
  *
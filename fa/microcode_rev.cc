@@ -344,3 +344,16 @@ SymState* FI_set_greg::reverseAndIsect(
 
 	return tmpState;
 }
+
+SymState* FI_fused::reverseAndIsect(
+	ExecutionManager&                      execMan,
+	const SymState&                        fwdPred,
+	const SymState&                        bwdSucc) const
+{
+	// copy the previous values of all assigned registers
+	SymState* tmpState = execMan.copyStateWithNewRegs(bwdSucc, fwdPred.GetInstr());
+	for (const PureRegisterAssignment* instr : body_)
+		tmpState->SetReg(instr->dstReg(), fwdPred.GetReg(instr->dstReg()));
+
+	return tmpState;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Code Listener headers
+#include <cl/storage.hh>
+
+// Forester headers
+#include "abstractinstruction.hh"
+#include "forestautext.hh"
+#include "profiler.hh"
+
+namespace
+{
+/// the location of an instruction: the file, the line and the column
+typedef std::tuple<std::string, int, int> Location;
+
+uint64_t elapsed(const std::chrono::steady_clock::time_point& start)
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start).count();
+}
+
+void addSize(size_t& roots, size_t& transitions, const FAE* fae)
+{
+	if (nullptr == fae)
+		return;
+
+	for (const std::shared_ptr<TreeAut>& root : fae->getRoots())
+	{
+		if (nullptr == root)
+			continue;
+
+		++roots;
+		transitions += root->getTransitions().size();
+	}
+}
+
+double toMs(uint64_t ns)
+{
+	return ns / 1e6;
+}
+
+/**
+ * @brief  Writes a file name as a CSV field
+ */
+void writeString(std::ostream& os, const std::string& str)
+{
+	os << '"';
+	for (char c : str)
+	{
+		if ('"' == c)
+			os << '"';
+
+		os << c;
+	}
+
+	os << '"';
+}
+} // namespace
+
+
+void Profiler::Record::merge(const Record& rhs)
+{
+	count += rhs.count;
+	time += rhs.time;
+	rootsIn += rhs.rootsIn;
+	transitionsIn += rhs.transitionsIn;
+	successors += rhs.successors;
+	rootsOut += rhs.rootsOut;
+	transitionsOut += rhs.transitionsOut;
+
+	for (size_t i = 0; i < PHASE_COUNT; ++i)
+		phases[i] += rhs.phases[i];
+}
+
+
+Profiler::InstrScope::InstrScope(
+	Profile*                       profile,
+	const AbstractInstruction*     instr,
+	const FAE*                     fae) :
+	record_(nullptr),
+	outer_(current()),
+	start_{}
+{
+	if (nullptr == profile)
+		return;
+
+	record_ = &(*profile)[instr];
+	++record_->count;
+	addSize(record_->rootsIn, record_->transitionsIn, fae);
+
+	current() = record_;
+	start_ = std::chrono::steady_clock::now();
+}
+
+
+Profiler::InstrScope::~InstrScope()
+{
+	if (nullptr == record_)
+		return;
+
+	record_->time += elapsed(start_);
+	current() = outer_;
+}
+
+
+Profiler::PhaseScope::PhaseScope(phase_e phase) :
+	record_(nullptr),
+	phase_(phase),
+	start_{}
+{
+	if (0 == depth(phase_)++)
+		record_ = current();
+
+	if (nullptr != record_)
+		start_ = std::chrono::steady_clock::now();
+}
+
+
+Profiler::PhaseScope::~PhaseScope()
+{
+	--depth(phase_);
+
+	if (nullptr != record_)
+		record_->phases[static_cast<size_t>(phase_)] += elapsed(start_);
+}
+
+
+void Profiler::addSuccessor(Record& record, const FAE* fae)
+{
+	++record.successors;
+	addSize(record.rootsOut, record.transitionsOut, fae);
+}
+
+
+void Profiler::writeReport(
+	std::ostream&                  os,
+	const Profile&                 profile)
+{
+	std::map<Location, Record> locations;
+	for (const auto& instrRecordPair : profile)
+	{
+		const CodeStorage::Insn* insn = instrRecordPair.first->insn();
+
+		Location loc("", 0, 0);
+		if ((nullptr != insn) && (nullptr != insn->loc.file))
+			loc = Location(insn->loc.file, insn->loc.line, insn->loc.column);
+
+		locations[loc].merge(instrRecordPair.second);
+	}
+
+	std::vector<std::pair<Location, Record>> sorted(
+		locations.begin(), locations.end());
+
+	std::stable_sort(sorted.begin(), sorted.end(),
+		[](const std::pair<Location, Record>& lhs,
+			const std::pair<Location, Record>& rhs)
+		{
+			return lhs.second.time > rhs.second.time;
+		});
+
+	os << "file,line,column,executions,time_ms,roots_in,transitions_in,"
+		"successors,roots_out,transitions_out,folding_ms,normalization_ms,"
+		"abstraction_ms,inclusion_ms,minimization_ms" << std::endl;
+
+	for (const auto& locRecordPair : sorted)
+	{
+		const Location& loc = locRecordPair.first;
+		const Record& record = locRecordPair.second;
+
+		writeString(os, std::get<0>(loc));
+		os << ',' << std::get<1>(loc) << ',' << std::get<2>(loc)
+			<< ',' << record.count << ',' << toMs(record.time)
+			<< ',' << record.rootsIn << ',' << record.transitionsIn
+			<< ',' << record.successors << ',' << record.rootsOut
+			<< ',' << record.transitionsOut;
+
+		for (size_t i = 0; i < PHASE_COUNT; ++i)
+			os << ',' << toMs(record.phases[i]);
+
+		os << std::endl;
+	}
+}
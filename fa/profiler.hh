@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/**
+ * @file profiler.hh
+ * Profiler - profiling of the execution of microinstructions
+ */
+
+// Standard library headers
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+
+class AbstractInstruction;
+class FAE;
+
+/**
+ * @brief  Profiling of the execution of microinstructions
+ *
+ * Every worker collects its own profile of the executed microinstructions
+ * (see @p InstrScope): the number of executions, their time, the sizes of the
+ * input forest automata and of the forest automata of the successors, and the
+ * time spent in the expensive phases of the analysis (see @p PhaseScope). The
+ * profiles are merged and aggregated per source location by @p writeReport().
+ */
+class Profiler
+{
+public:   // data types
+
+	/**
+	 * @brief  The profiled phases of the analysis
+	 */
+	enum class phase_e
+	{
+		folding,
+		normalization,
+		abstraction,
+		inclusion,
+		minimization,
+		count          ///< the number of the phases
+	};
+
+	/// the number of the profiled phases
+	static const size_t PHASE_COUNT = static_cast<size_t>(phase_e::count);
+
+	/**
+	 * @brief  The profile of a microinstruction (or a source location)
+	 */
+	struct Record
+	{
+		/// the number of executions
+		size_t count;
+
+		/// the total time of the executions (in ns)
+		uint64_t time;
+
+		/// the total number of the roots of the input forest automata
+		size_t rootsIn;
+
+		/// the total number of transitions of the input forest automata
+		size_t transitionsIn;
+
+		/// the number of successor states
+		size_t successors;
+
+		/// the total number of the roots of the successors' forest automata
+		size_t rootsOut;
+
+		/// the total number of transitions of the successors' forest automata
+		size_t transitionsOut;
+
+		/// the total time spent in the phases (in ns)
+		uint64_t phases[PHASE_COUNT];
+
+		Record() :
+			count(0),
+			time(0),
+			rootsIn(0),
+			transitionsIn(0),
+			successors(0),
+			rootsOut(0),
+			transitionsOut(0),
+			phases{}
+		{ }
+
+		void merge(const Record& rhs);
+	};
+
+	typedef std::unordered_map<const AbstractInstruction*, Record> Profile;
+
+	/**
+	 * @brief  Profiles the execution of a microinstruction
+	 *
+	 * The execution is accounted to the record of the instruction in the given
+	 * profile from the construction till the destruction of the scope.
+	 */
+	class InstrScope
+	{
+	private:  // data members
+
+		/// the record of the instruction (@p nullptr if not profiling)
+		Record* record_;
+
+		/// the record of the enclosing scope (if any)
+		Record* outer_;
+
+		/// the start of the execution
+		std::chrono::steady_clock::time_point start_;
+
+	private:  // methods
+
+		InstrScope(const InstrScope&);
+		InstrScope& operator=(const InstrScope&);
+
+	public:   // methods
+
+		/**
+		 * @brief  Constructor
+		 *
+		 * @param[in,out]  profile  The profile of the worker (@p nullptr to
+		 *                          disable profiling)
+		 * @param[in]      instr    The executed instruction
+		 * @param[in]      fae      The input forest automaton (may be
+		 *                          @p nullptr)
+		 */
+		InstrScope(
+			Profile*                       profile,
+			const AbstractInstruction*     instr,
+			const FAE*                     fae);
+
+		~InstrScope();
+	};
+
+	/**
+	 * @brief  Profiles a phase of the analysis
+	 *
+	 * The time from the construction till the destruction of the scope is
+	 * accounted to the phase of the instruction being executed by the current
+	 * thread (if profiled). Nested scopes of the same phase are accounted only
+	 * once, nested scopes of different phases are accounted to both of them.
+	 */
+	class PhaseScope
+	{
+	private:  // data members
+
+		/// the record of the profiled instruction (@p nullptr if none)
+		Record* record_;
+
+		/// the phase
+		phase_e phase_;
+
+		/// the start of the phase
+		std::chrono::steady_clock::time_point start_;
+
+	private:  // methods
+
+		PhaseScope(const PhaseScope&);
+		PhaseScope& operator=(const PhaseScope&);
+
+	public:   // methods
+
+		explicit PhaseScope(phase_e phase);
+
+		~PhaseScope();
+	};
+
+private:  // methods
+
+	/**
+	 * @brief  The record of the instruction executed by the current thread
+	 */
+	static Record*& current()
+	{
+		static thread_local Record* record = nullptr;
+		return record;
+	}
+
+	/**
+	 * @brief  The nesting depth of a phase in the current thread
+	 */
+	static size_t& depth(phase_e phase)
+	{
+		static thread_local size_t depths[PHASE_COUNT] = {};
+		return depths[static_cast<size_t>(phase)];
+	}
+
+	static void addSuccessor(Record& record, const FAE* fae);
+
+public:   // methods
+
+	/**
+	 * @brief  Accounts a successor state to the instruction being executed
+	 *
+	 * @param[in]  fae  The forest automaton of the successor (may be
+	 *                  @p nullptr)
+	 */
+	static void successor(const FAE* fae)
+	{
+		if (nullptr != current())
+			addSuccessor(*current(), fae);
+	}
+
+	/**
+	 * @brief  Writes a report of the profile
+	 *
+	 * The report is a table in the CSV format with a header line and a line
+	 * for every source location with profiled instructions (the instructions
+	 * without a location are reported as a location with an empty file name),
+	 * sorted by the time of the executions. Times are given in milliseconds.
+	 *
+	 * @param[out]  os       The output stream
+	 * @param[in]   profile  The (merged) profile
+	 */
+	static void writeReport(
+		std::ostream&                  os,
+		const Profile&                 profile);
+};
+
+#endif
@@ -71,6 +71,20 @@ void ProgramConfig::processArg(const std::string& arg)
 		return;
 	}
 
+	if (std::string("db-export") == key)
+	{
+		this->exportBoxes = true;
+		FA_LOG("Config::processArg: \"db-export\" mode requested");
+		return;
+	}
+
+	if (std::string("no-fusion") == key)
+	{
+		this->fuseMicrocode = false;
+		FA_LOG("Config::processArg: \"no-fusion\" mode requested");
+		return;
+	}
+
 	//      ***************  binary arguments ****************
 	if (std::string("db-root") == key)
 	{
@@ -84,5 +98,60 @@ void ProgramConfig::processArg(const std::string& arg)
 		return;
 	}
 
+	if (std::string("ta-dump") == key)
+	{
+		if (data.size() != 2)
+		{
+			throw std::invalid_argument("use \"ta-dump:<file>\"");
+		}
+
+		this->taDump = data[1];
+		FA_LOG("Config::processArg: \"ta-dump\" is \"" + this->taDump + "\"");
+		return;
+	}
+
+	if (std::string("profile") == key)
+	{
+		if (data.size() != 2)
+		{
+			throw std::invalid_argument("use \"profile:<file>\"");
+		}
+
+		this->profile = data[1];
+		FA_LOG("Config::processArg: \"profile\" is \"" + this->profile + "\"");
+		return;
+	}
+
+	if (std::string("workers") == key)
+	{
+		if ((data.size() != 2) || data[1].empty()
+			|| (data[1].find_first_not_of("0123456789") != std::string::npos))
+		{
+			throw std::invalid_argument("use \"workers:<number>\"");
+		}
+
+		this->workers = std::stoul(data[1]);
+		if (0 == this->workers)
+		{
+			throw std::invalid_argument("at least one worker is needed");
+		}
+
+		FA_LOG("Config::processArg: \"workers\" is " << this->workers);
+		return;
+	}
+
+	if (std::string("checkpoints") == key)
+	{
+		if ((data.size() != 2) || data[1].empty()
+			|| (data[1].find_first_not_of("0123456789") != std::string::npos))
+		{
+			throw std::invalid_argument("use \"checkpoints:<number>\"");
+		}
+
+		this->checkpoints = std::stoul(data[1]);
+		FA_LOG("Config::processArg: \"checkpoints\" is " << this->checkpoints);
+		return;
+	}
+
 	FA_WARN("unhandled argument: \"" << arg << "\"");
 }
@@ -24,6 +24,7 @@
 #include <boost/algorithm/string.hpp>
 
 // Forester headers
+#include "config.h"
 #include "streams.hh"
 
 struct ProgramConfig
@@ -31,6 +32,12 @@ struct ProgramConfig
 public:   // data members
 
 	std::string dbRoot;             ///< box database root directory
+	bool        exportBoxes;        ///< exporting the box database in Timbuk?
+	std::string taDump;             ///< file to dump the fixpoint automata into
+	std::string profile;            ///< file to write the profile into
+	size_t      workers;            ///< number of workers exploring the states
+	size_t      checkpoints;        ///< distance of the states keeping automata
+	bool        fuseMicrocode;      ///< fusing register assignments?
 	bool        printUcode;         ///< printing microcode?
 	bool        printOrigCode;      ///< printing the original code?
 	bool        onlyCompile;        ///< only compiling?
@@ -45,6 +52,12 @@ public:   // methods
 
 	ProgramConfig(const std::string& confStr = "") :
 		dbRoot(""),
+		exportBoxes(false),
+		taDump(""),
+		profile(""),
+		workers(FA_WORKER_THREADS),
+		checkpoints(FA_TRACE_CHECKPOINT_INTERVAL),
+		fuseMicrocode(FA_FUSE_MICROCODE),
 		printUcode(false),
 		printOrigCode(false),
 		onlyCompile(false),
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REGISTER_FILE_H
+#define REGISTER_FILE_H
+
+/**
+ * @file registerfile.hh
+ * RegisterFile - a persistent array of local registers
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+// Forester headers
+#include "types.hh"
+
+/**
+ * @brief  A persistent array of local registers
+ *
+ * The registers are split into chunks of a fixed size that are shared by all
+ * copies of the register file. Copying a register file copies only the
+ * pointers to the chunks, and assigning a register copies (only) the chunk
+ * containing it if the chunk is shared. As a symbolic state usually changes
+ * at most one register of its parent, the register files of the states along
+ * a path share most of their chunks.
+ */
+class RegisterFile
+{
+private:  // data types
+
+	typedef std::vector<Data> Chunk;
+
+	/// the number of registers in a chunk
+	static const size_t CHUNK_SIZE = 8;
+
+private:  // data members
+
+	/// the chunks of the registers
+	std::vector<std::shared_ptr<Chunk>> chunks_;
+
+	/// the number of registers
+	size_t size_;
+
+public:   // methods
+
+	RegisterFile() :
+		chunks_{},
+		size_(0)
+	{ }
+
+	/**
+	 * @brief  Constructor
+	 *
+	 * Creates a register file with the given values of the registers.
+	 *
+	 * @param[in]  values  The values of the registers
+	 */
+	explicit RegisterFile(const DataArray& values) :
+		chunks_{},
+		size_(values.size())
+	{
+		for (size_t i = 0; i < size_; i += CHUNK_SIZE)
+		{
+			const size_t end = std::min(i + CHUNK_SIZE, size_);
+			chunks_.push_back(std::make_shared<Chunk>(
+				values.begin() + i, values.begin() + end));
+		}
+	}
+
+	size_t size() const
+	{
+		return size_;
+	}
+
+	const Data& operator[](size_t index) const
+	{
+		// Assertions
+		assert(index < size_);
+
+		return (*chunks_[index / CHUNK_SIZE])[index % CHUNK_SIZE];
+	}
+
+	/**
+	 * @brief  Assigns a register
+	 *
+	 * The chunk containing the register is copied first if it is shared with
+	 * another register file.
+	 *
+	 * @param[in]  index  The index of the register
+	 * @param[in]  data   The new value of the register
+	 */
+	void set(size_t index, const Data& data)
+	{
+		// Assertions
+		assert(index < size_);
+
+		std::shared_ptr<Chunk>& chunk = chunks_[index / CHUNK_SIZE];
+		if (1 != chunk.use_count())
+		{	// the chunk is shared, copy it
+			chunk = std::make_shared<Chunk>(*chunk);
+		}
+
+		(*chunk)[index % CHUNK_SIZE] = data;
+	}
+
+	/**
+	 * @brief  Releases all registers
+	 */
+	void clear()
+	{
+		chunks_.clear();
+		size_ = 0;
+	}
+
+	/**
+	 * @brief  The output stream operator
+	 *
+	 * @param[in,out]  os    The output stream
+	 * @param[in]      regs  The register file to be appended to the stream
+	 *
+	 * @returns  The modified output stream
+	 */
+	friend std::ostream& operator<<(std::ostream& os, const RegisterFile& regs)
+	{
+		os << '{';
+		for (size_t i = 0; i < regs.size(); ++i)
+		{
+			if (0 != i)
+				os << ',';
+
+			os << regs[i];
+		}
+
+		return os << '}';
+	}
+};
+
+#endif
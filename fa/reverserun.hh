@@ -39,7 +39,7 @@ struct CustomIntersectF {
 	 : fae(fae), dst(dst), src1(src1), src2(src2) {}
 
 	void operator()(const TT<label_type>* t1, const TT<label_type>* t2, const std::vector<size_t>& lhs, size_t& rhs) {
-		const Data* data;
+		Data data;
 		if (this->fae.isData(t2->rhs(), data))
 			rhs = t2->rhs();
 		this->dst.addTransition(lhs, t2->_label, rhs);
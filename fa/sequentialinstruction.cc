@@ -49,6 +49,14 @@ SymState* RegisterAssignment::reverseAndIsect(
 	return tmpState;
 }
 
+void PureRegisterAssignment::execute(ExecutionManager& execMan, SymState& state)
+{
+	SymState* tmpState = execMan.createChildStateWithNewRegs(state, next_);
+	this->assign(*tmpState, state);
+
+	execMan.enqueue(tmpState);
+}
+
 SymState* VoidInstruction::reverseAndIsect(
 	ExecutionManager&                      execMan,
 	const SymState&                        fwdPred,
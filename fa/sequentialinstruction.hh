@@ -82,6 +82,16 @@ public:
 	 * @returns  The next instruction in the sequence
 	 */
 	AbstractInstruction* next() const { return this->next_; }
+
+	/**
+	 * @brief  Sets the next instruction
+	 *
+	 * Method that redirects the instruction to another next instruction (used
+	 * when the code is optimised after it has been finalised).
+	 *
+	 * @param[in]  next  The new next instruction
+	 */
+	void next(AbstractInstruction* next) { this->next_ = next; }
 };
 
 
@@ -125,6 +135,80 @@ public:   // methods
 };
 
 
+/**
+ * @brief  Instruction for assignment into a local register only
+ *
+ * An assignment into a local register that neither modifies the forest
+ * automaton nor splits the symbolic state, i.e. it always has exactly one
+ * successor that differs only in the registers. The effect of such
+ * instructions is given by the @p assign() method, so that a sequence of them
+ * can be fused into a single instruction (see @p FI_fused).
+ */
+class PureRegisterAssignment : public RegisterAssignment
+{
+protected:// methods
+
+	/**
+	 * @brief  Constructor
+	 *
+	 * Creates a pure register assignment instruction for given instruction in
+	 * the Code Storage.
+	 *
+	 * @param[in]  insn    Corresponding instruction in the Code Storage
+	 * @param[in]  dstReg  The destination register of the instruction
+	 */
+	explicit PureRegisterAssignment(const CodeStorage::Insn* insn, size_t dstReg) :
+		RegisterAssignment(insn, dstReg)
+	{ }
+
+public:   // methods
+
+	/**
+	 * @copydoc  AbstractInstruction::execute
+	 */
+	virtual void execute(ExecutionManager& execMan, SymState& state);
+
+
+	/**
+	 * @brief  Performs the assignment
+	 *
+	 * Performs the assignment on the registers of @p state, which is
+	 * a successor of @p pred being created.
+	 *
+	 * @param[in,out]  state  The state with the registers to be modified
+	 * @param[in]      pred   The state in which the instruction is executed
+	 *                        (for reporting errors)
+	 */
+	virtual void assign(SymState& state, const SymState& pred) const = 0;
+
+
+	/**
+	 * @brief  Determines whether the instruction reads a register
+	 *
+	 * @param[in]  reg  Index of the local register
+	 *
+	 * @returns  @p true if the assignment depends on the value of @p reg
+	 */
+	virtual bool readsReg(size_t reg) const = 0;
+
+
+	/**
+	 * @brief  Determines whether the instruction may report an error
+	 *
+	 * @returns  @p true if the assignment may throw a @p ProgramError
+	 */
+	virtual bool mayFail() const { return false; }
+
+
+	/**
+	 * @brief  Gets the destination register
+	 *
+	 * @returns  Index of the destination register
+	 */
+	size_t dstReg() const { return this->dstReg_; }
+};
+
+
 /**
  * @brief  Instruction with void effect
  *
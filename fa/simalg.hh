@@ -34,8 +34,7 @@ class Counter {
 //	int _labels;
 //	int _states;
 	std::vector<std::vector<size_t> > _data;
-	const std::vector<std::vector<size_t> >* _key;
-	const std::vector<size_t>* _range;
+	const LTS* _lts;
 	
 private:  // methods
 
@@ -43,11 +42,11 @@ private:  // methods
 
 public:
 
-	Counter(size_t labels, const std::vector<std::vector<size_t> >& key, const std::vector<size_t>& range)
-		: _data(labels), _key(&key), _range(&range) {}
+	Counter(const LTS& lts)
+		: _data(lts.labels()), _lts(&lts) {}
 
 	Counter(const Counter& counter)
-		: _data(counter._data.size()), _key(counter._key), _range(counter._range) {}
+		: _data(counter._data.size()), _lts(counter._lts) {}
 /*
 	void setKey(const std::vector<std::vector<int> >& key, const std::vector<int>& range) {
 		this->_key = &key;
@@ -60,21 +59,18 @@ public:
 	
 	size_t incr(size_t label, size_t state) {
 		if (this->_data[label].size() == 0)
-			this->_data[label].resize((*this->_range)[label]);
-		return ++this->_data[label][(*this->_key)[label][state]];
+			this->_data[label].resize(this->_lts->sources(label).size());
+		return ++this->_data[label][this->_lts->key(label, state)];
 	} 
 	
 	size_t decr(size_t label, size_t state) {
-		if ((*this->_key)[label][state] >= this->_data[label].size()) {
-			for (size_t a = 0; a < this->_key->size(); ++a) {
-				for (size_t i = 0; i < (*this->_key)[a].size(); ++i)
-					std::cout << (*this->_key)[a][i] << " ";
-				std::cout << "\n";
-			}
+		const size_t key = this->_lts->key(label, state);
+		if (key >= this->_data[label].size()) {
+			this->_lts->dump();
 			this->dump();
 			throw std::runtime_error("Counter::decr() : location not allocated");
 		}
-		return --this->_data[label][(*this->_key)[label][state]];
+		return --this->_data[label][key];
 	}
 
 	const std::vector<size_t>& getRow(size_t label) const {
@@ -193,12 +189,12 @@ private:  // methods
 
 public:
 
-	OLRTBlock(size_t index, const LTS& lts, const std::vector<std::vector<size_t> >& key, const std::vector<size_t>& range)
-		: _index(index), _states(nullptr), _remove(lts.labels()), _counter(lts.labels(), key, range), _intersection(nullptr), _inset(lts.labels()), _tmp(nullptr) {
+	OLRTBlock(size_t index, const LTS& lts)
+		: _index(index), _states(nullptr), _remove(lts.labels()), _counter(lts), _intersection(nullptr), _inset(lts.labels()), _tmp(nullptr) {
 		for (size_t i = 0; i < lts.states(); ++i) {
 			new StateListElem(i, this, this->_states);
-			for (SmartSet::iterator j = lts.lPre()[i].begin(); j != lts.lPre()[i].end(); ++j)
-				this->_inset.add(*j);
+			for (size_t a : lts.lPre(i))
+				this->_inset.add(a);
 		}
 	}
 	
@@ -208,9 +204,9 @@ public:
 		parent->_intersection = this;
 		StateListElem* elem = this->_states;
 		do {
-			for (SmartSet::iterator i = lts.lPre()[elem->state()].begin(); i != lts.lPre()[elem->state()].end(); ++i) {
-				parent->_inset.remove(*i);
-				this->_inset.add(*i);
+			for (size_t a : lts.lPre(elem->state())) {
+				parent->_inset.remove(a);
+				this->_inset.add(a);
 			}
 			elem->block(this);
 			elem = elem->next();
@@ -307,10 +303,6 @@ class OLRTAlgorithm {
 	std::vector<StateListElem*> _index;
 	std::vector<std::pair<OLRTBlock*, size_t> > _queue;
 	std::vector<bool> _tmp;
-	std::vector<SmartSet> _delta;
-	std::vector<SmartSet> _delta1;
-	std::vector<std::vector<size_t> > _key;
-	std::vector<size_t> _range;
 	
 	std::vector<std::vector<size_t>*> _removeCache;
 	
@@ -359,8 +351,9 @@ protected:
 			(*i)->intersection(nullptr);
 //			for (std::vector<OLRTBlock*>::iterator j = this->_partition.begin(); j != this->_partition.end(); ++j) {
 			for (std::vector<OLRTBlock*>::reverse_iterator j = this->_partition.rbegin(); j != this->_partition.rend(); ++j) {
-				this->_relation.data()[(*j)->index()][bint->index()] = this->_relation.data()[(*j)->index()][(*i)->index()];
-				this->_relation.data()[bint->index()][(*j)->index()] = this->_relation.data()[(*i)->index()][(*j)->index()];
+				BitMatrix& rel = this->_relation.data();
+				rel.set((*j)->index(), bint->index(), rel.get((*j)->index(), (*i)->index()));
+				rel.set(bint->index(), (*j)->index(), rel.get((*i)->index(), (*j)->index()));
 			}
 		}
 	}
@@ -391,8 +384,9 @@ protected:
 			(*i)->intersection(nullptr);
 //			for (std::vector<OLRTBlock*>::iterator j = this->_partition.begin(); j != this->_partition.end(); ++j) {
 			for (std::vector<OLRTBlock*>::reverse_iterator j = this->_partition.rbegin(); j != this->_partition.rend(); ++j) {
-				this->_relation.data()[(*j)->index()][bint->index()] = this->_relation.data()[(*j)->index()][(*i)->index()];
-				this->_relation.data()[bint->index()][(*j)->index()] = this->_relation.data()[(*i)->index()][(*j)->index()];
+				BitMatrix& rel = this->_relation.data();
+				rel.set((*j)->index(), bint->index(), rel.get((*j)->index(), (*i)->index()));
+				rel.set(bint->index(), (*j)->index(), rel.get((*i)->index(), (*j)->index()));
 			}
 			for (SmartSet::iterator j = bint->inset().begin(); j != bint->inset().end(); ++j) {
 				bint->counter().copyRow(*j, (*i)->counter());
@@ -419,26 +413,26 @@ protected:
 		this->split(*remove, removeList);
 		std::fill(this->_tmp.begin(), this->_tmp.end(), true);
 		for (std::vector<StateListElem*>::iterator i = prev.begin(); i != prev.end(); ++i) {
-			for (std::vector<size_t>::const_iterator j = this->_lts->dataPre()[label][(*i)->state()].begin(); j != this->_lts->dataPre()[label][(*i)->state()].end(); ++j) {
-				StateListElem* elem = this->_index[*j];
+			for (size_t q : this->_lts->pre((*i)->state(), label)) {
+				StateListElem* elem = this->_index[q];
 				OLRTBlock* block2 = elem->block();
 				if (this->_tmp[block2->index()]) {
 					this->_tmp[block2->index()] = false;
 					for (std::vector<OLRTBlock*>::iterator k = removeList.begin(); k != removeList.end(); ++k) {
 						assert(block2->index() != (*k)->index());
-						if (this->_relation.data()[block2->index()][(*k)->index()]) {
-							this->_relation.data()[block2->index()][(*k)->index()] = false;
+						if (this->_relation.data().get(block2->index(), (*k)->index())) {
+							this->_relation.data().set(block2->index(), (*k)->index(), false);
 							for (SmartSet::iterator a = (*k)->inset().begin(); a != (*k)->inset().end(); ++a) {
 								if (block2->inset().contains(*a)) {
 									StateListElem* elem2 = (*k)->states();
 									do {
-										for (std::vector<size_t>::const_iterator l = this->_lts->dataPre()[*a][elem2->state()].begin(); l != this->_lts->dataPre()[*a][elem2->state()].end(); ++l) {
-											if (!block2->counter().decr(*a, *l)) {
+										for (size_t l : this->_lts->pre(elem2->state(), *a)) {
+											if (!block2->counter().decr(*a, l)) {
 												if (!block2->remove()[*a]) {
 													block2->remove()[*a] = this->rcAlloc();
 													this->_queue.push_back(std::pair<OLRTBlock*, size_t>(block2, *a));
 												}
-												block2->remove()[*a]->push_back(*l);
+												block2->remove()[*a]->push_back(l);
 											}
 										}
 										elem2 = elem2->next();
@@ -456,8 +450,8 @@ protected:
 public:
 
 	OLRTAlgorithm(const LTS& lts)
-		: _lts(&lts), _partition(), _relation(), _index{}, _queue{}, _tmp(lts.states()), _delta{}, _delta1{}, _key{}, _range{}, _removeCache() {
-		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts, this->_key, this->_range);
+		: _lts(&lts), _partition(), _relation(), _index{}, _queue{}, _tmp(lts.states()), _removeCache() {
+		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts);
 		block->storeStates(this->_index);
 		this->_partition.push_back(block);
 	}
@@ -475,69 +469,62 @@ public:
 		this->_relation.reset();
 		this->_lts = &lts;
 		this->_tmp.resize(lts.states());
-		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts, this->_key, this->_range);
+		OLRTBlock* block = new OLRTBlock(this->_relation.newEntry(), lts);
 		block->storeStates(this->_index);
 		this->_partition.push_back(block);
 	}
 
 	void init() {
-		this->_lts->buildDelta(this->_delta, this->_delta1);
-		this->_key.resize(this->_lts->labels());
-		this->_range.resize(this->_lts->labels());
-		for (size_t a = 0; a < this->_lts->labels(); ++a) {
-			this->_key[a].resize(this->_lts->states());
-			this->_range[a] = this->_delta1[a].size();
-			size_t x = 0;
-			for (SmartSet::iterator i = this->_delta1[a].begin(); i != this->_delta1[a].end(); ++i)
-				this->_key[a][*i] = x++;
-		}
 		std::vector<size_t> tmp2;
 		for (size_t a = 0; a < this->_lts->labels(); ++a) {
 //			this->dump();
-			this->_delta1[a].buildVector(tmp2);
+			LTS::Range src = this->_lts->sources(a);
+			tmp2.assign(src.begin(), src.end());
 			this->fastSplit(tmp2);
 		}
-		std::vector<std::vector<bool> > tmp[2];
-		tmp[0].resize(this->_lts->labels(), std::vector<bool>(this->_partition.size(), true));
-		tmp[1].resize(this->_lts->labels(), std::vector<bool>(this->_partition.size(), true));
+		// the blocks are now either included in or disjoint with each sources(a)
+		// block indices need not be dense if the relation has been loaded, the
+		// columns past the last block stay zero so that rowAndNot() below does
+		// not touch the (all-true) relation entries of blocks to be created
+		size_t blocks = 0;
+		for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i)
+			blocks = std::max(blocks, (*i)->index() + 1);
+		BitMatrix tmp[2];
+		tmp[0].assign(this->_lts->labels(), blocks, true);
+		tmp[1].assign(this->_lts->labels(), blocks, true);
+		std::vector<bool> hasSucc(blocks);
 		for (size_t a = 0; a < this->_lts->labels(); ++a) {
-			for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i) {
-				StateListElem* elem = (*i)->states();
-				do {
-					tmp[(this->_delta1[a].contains(elem->state()))?(1):(0)][a][(*i)->index()] = false;
-					elem = elem->next();
-				} while (elem != (*i)->states());
-			}
+			std::fill(hasSucc.begin(), hasSucc.end(), false);
+			for (size_t q : this->_lts->sources(a))
+				hasSucc[this->_index[q]->block()->index()] = true;
+			for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i)
+				tmp[(hasSucc[(*i)->index()])?(1):(0)].set(a, (*i)->index(), false);
 		}
+		// the columns of tmp are indexed by blocks, as well as those of the relation
 		for (size_t a = 0; a < this->_lts->labels(); ++a) {
 			for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i) {
-				if (tmp[0][a][(*i)->index()]) {
-					for (std::vector<OLRTBlock*>::iterator j = this->_partition.begin(); j != this->_partition.end(); ++j) {
-						if (tmp[1][a][(*j)->index()])
-							this->_relation.data()[(*i)->index()][(*j)->index()] = false;
-					}
-				}
+				if (tmp[0].get(a, (*i)->index()))
+					this->_relation.data().rowAndNot((*i)->index(), tmp[1], a);
 			}			
 		}		
-		std::vector<std::vector<size_t> > post;
 //		for (std::vector<OLRTBlock*>::iterator i = this->_partition.begin(); i != this->_partition.end(); ++i) {
 		for (std::vector<OLRTBlock*>::reverse_iterator i = this->_partition.rbegin(); i != this->_partition.rend(); ++i) {
 			for (SmartSet::iterator j = (*i)->inset().begin(); j != (*i)->inset().end(); ++j) {
-				this->_lts->buildPost(*j, post);
-				for (SmartSet::iterator k = this->_delta1[*j].begin(); k != this->_delta1[*j].end(); ++k) {
-					for (std::vector<size_t>::iterator l = post[*k].begin(); l != post[*k].end(); ++l) {
-						if (this->_relation.data()[(*i)->index()][this->_index[*l]->block()->index()])
-							(*i)->counter().incr(*j, *k);
+				for (size_t k : this->_lts->sources(*j)) {
+					for (size_t l : this->_lts->post(k, *j)) {
+						if (this->_relation.data().get((*i)->index(), this->_index[l]->block()->index()))
+							(*i)->counter().incr(*j, k);
 					}
 				}
-				for (size_t k = 0; k < this->_lts->states(); ++k)
-					this->_tmp[k] = this->_delta1[*j].contains(k);
+				std::fill(this->_tmp.begin(), this->_tmp.end(), false);
+				for (size_t k : this->_lts->sources(*j))
+					this->_tmp[k] = true;
 				for (std::vector<OLRTBlock*>::iterator k = this->_partition.begin(); k != this->_partition.end(); ++k) {
-					if (this->_relation.data()[(*i)->index()][(*k)->index()]) {
+					if (this->_relation.data().get((*i)->index(), (*k)->index())) {
 						StateListElem* elem = (*k)->states();
 						do {
-							for (std::vector<size_t>::const_iterator l = this->_lts->dataPre()[*j][elem->state()].begin(); l != this->_lts->dataPre()[*j][elem->state()].end(); ++l)
-								this->_tmp[*l] = false;
+							for (size_t l : this->_lts->pre(elem->state(), *j))
+								this->_tmp[l] = false;
 							elem = elem->next();
 						} while (elem != (*k)->states());
 					}
@@ -593,13 +580,12 @@ public:
 		return this->_relation;
 	}
 	
-	void buildRel(size_t size, std::vector<std::vector<bool> >& rel) const {
-		rel.clear();
-		rel.resize(size, std::vector<bool>(size));
+	void buildRel(size_t size, BitMatrix& rel) const {
+		rel.assign(size, false);
 		for (size_t i = 0; i < size; ++i) {
 			size_t ii = this->_index[i]->block()->index();
 			for (size_t j = 0; j < size; ++j)
-				rel[i][j] = this->_relation.data()[ii][this->_index[j]->block()->index()];
+				rel.set(i, j, this->_relation.data().get(ii, this->_index[j]->block()->index()));
 		}
 	}
 	
@@ -633,7 +633,7 @@ void Splitting::isolateSet(
 
 	for (size_t i : offsU)
 	{	// upward selectors are isolated separately 
-		for (FAE* aut : tmp)
+		for (FAE*& aut : tmp)
 		{	// each FAE is also processed separately
 			assert(nullptr != aut);
 
@@ -643,8 +643,10 @@ void Splitting::isolateSet(
 			// get root selectors (from the new FA) into tmpS
 			splitting.enumerateSelectorsAtRoot(tmpS, target);
 			if (tmpS.count(i))
-			{	// in case 
-				tmp2.push_back(new FAE(*aut));
+			{	// in case the selector is already at the root, the FA is taken over
+				// as it is (without copying)
+				tmp2.push_back(aut);
+				aut = nullptr;
 			}
 			else
 			{
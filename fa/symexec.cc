@@ -41,6 +41,8 @@ void reportErrorNoLocation(const char* errMsg)
 #include <list>
 #include <set>
 #include <algorithm>
+#include <atomic>
+#include <fstream>
 
 // Code Listener headers
 #include <cl/cl_msg.hh>
@@ -52,16 +54,19 @@ void reportErrorNoLocation(const char* errMsg)
 
 // Forester headers
 #include "backward_run.hh"
+#include "boxdb.hh"
 #include "executionmanager.hh"
 #include "fixpoint.hh"
 #include "fixpointinstruction.hh"
 #include "forestautext.hh"
 #include "memplot.hh"
 #include "programconfig.hh"
+#include "profiler.hh"
 #include "programerror.hh"
 #include "restart_request.hh"
 #include "symctx.hh"
 #include "symexec.hh"
+#include "tacorpus.hh"
 
 using namespace ssd;
 
@@ -183,6 +188,27 @@ std::ostream& printUcodeTrace(
 
 	return os;
 }
+
+
+/**
+ * @brief  Minimises the automaton of a fixpoint
+ *
+ * @param[in]  fixpoint  The fixpoint instruction
+ *
+ * @returns  The minimised automaton of @p fixpoint
+ */
+TreeAut minimizedFixpoint(
+	const AbstractInstruction&    fixpoint)
+{
+	const TreeAut& fwdConf =
+		static_cast<const FixpointInstruction&>(fixpoint).getFixPoint();
+
+	TreeAut ta(*fwdConf.backend);
+	if (!fwdConf.getTransitions().empty())
+		fwdConf.minimized(ta);
+
+	return ta;
+}
 } // namespace
 
 
@@ -202,7 +228,9 @@ private:  // data members
 	const ProgramConfig& conf_;
 
 	volatile bool dbgFlag_;
-	volatile bool userRequestFlag_;
+
+	/// set by a signal handler, consumed by any of the workers
+	std::atomic<bool> userRequestFlag_;
 
 protected:
 
@@ -235,6 +263,28 @@ protected:
 		}
 	}
 
+	/**
+	 * @brief  Writes the profile of the executed instructions (if requested)
+	 */
+	void writeProfile() const
+	{
+		if (conf_.profile.empty())
+			return;
+
+		Profiler::Profile profile;
+		execMan_.getProfile(profile);
+
+		std::ofstream os(conf_.profile.c_str());
+		Profiler::writeReport(os, profile);
+		if (!os.good())
+		{
+			FA_WARN("unable to write the profile into " << conf_.profile);
+			return;
+		}
+
+		FA_LOG("the profile has been written into " << conf_.profile);
+	}
+
 	/**
 	 * @brief  Clears all fixpoints
 	 */
@@ -251,6 +301,33 @@ protected:
 		}
 	}
 
+	/**
+	 * @brief  Prepares the fixpoints for a restart after learning boxes
+	 *
+	 * Keeps the fixpoints that the newly learnt boxes cannot be folded into
+	 * and clears the others.  The execution graph is then pruned to the paths
+	 * to the kept fixpoints.
+	 */
+	void restartFixpoints()
+	{
+		std::vector<const Box*> boxes;
+		boxMan_.takeLearntBoxes(boxes);
+
+		std::set<const AbstractInstruction*> kept;
+		for (auto instr : assembly_.code_)
+		{
+			if (instr->getType() == fi_type_e::fiFix)
+			{
+				if (static_cast<FixpointInstruction*>(instr)->restart(boxes))
+					kept.insert(instr);
+			}
+		}
+
+		FA_DEBUG_AT(2, "keeping " << kept.size() << " fixpoint(s) across the restart");
+
+		execMan_.restart(kept);
+	}
+
 
 	/**
 	 * @brief  The main execution loop
@@ -302,30 +379,27 @@ protected:
 
 		FA_DEBUG_AT(2, "scheduling initial state ...");
 
-		// schedule the initial state for processing
-		execMan_.init(
-			DataArray(assembly_.regFileSize_, Data::createUndef()),
+		// schedule the initial state for processing (next to the successors of
+		// the fixpoints kept across a restart, if any)
+		execMan_.schedule(
+			RegisterFile(DataArray(assembly_.regFileSize_, Data::createUndef())),
 			fae,
 			assembly_.code_.front()
 		);
 
-		SymState* state = nullptr;
-
 		try
 		{	// expecting problems...
-			while (nullptr != (state = execMan_.dequeueDFS()))
+			execMan_.run([this](SymState& state)
 			{	// process all states in the DFS order
-				assert(nullptr != state);
-
-				const CodeStorage::Insn* insn = state->GetInstr()->insn();
+				const CodeStorage::Insn* insn = state.GetInstr()->insn();
 				if (nullptr != insn)
 				{	// in case current instruction IS an instruction
 					FA_DEBUG_AT(2, SSD_INLINE_COLOR(C_LIGHT_RED, insn->loc << *insn));
-					FA_DEBUG_AT(2, *state);
+					FA_DEBUG_AT(2, state);
 				}
 				else
 				{
-					FA_DEBUG_AT(3, *state);
+					FA_DEBUG_AT(3, state);
 				}
 
 				if (testAndClearUserRequestFlag())
@@ -336,8 +410,8 @@ protected:
 				}
 
 				// run the state
-				execMan_.execute(*state);
-			}
+				execMan_.execute(state);
+			});
 
 			return true;
 		}
@@ -357,12 +431,18 @@ protected:
 			else
 				reportErrorNoLocation(e.what());
 
+			const SymState::Trace trace = e.state()->getTrace();
+			if (conf_.printTrace || FA_USE_PREDICATE_ABSTRACTION)
+			{	// recompute the automata dropped from the states of the trace
+				execMan_.restoreTrace(trace);
+			}
+
 			if (conf_.printTrace)
 			{
 				FA_LOG_MSG(e.location(), "Printing trace");
 
 				std::ostringstream oss;
-				printTrace(oss, e.state()->getTrace());
+				printTrace(oss, trace);
 				Streams::trace(oss.str().c_str());
 			}
 
@@ -371,7 +451,7 @@ protected:
 				FA_LOG_MSG(e.location(), "Printing microcode trace");
 
 				std::ostringstream oss;
-				printUcodeTrace(oss, e.state()->getTrace());
+				printUcodeTrace(oss, trace);
 				Streams::traceUcode(oss.str().c_str());
 			}
 
@@ -382,7 +462,6 @@ protected:
 				// check whether the counterexample is spurious and in case it is collect
 				// some perhaps helpful information (failpoint and predicate)
 				BackwardRun bwdRun(execMan_);
-				SymState::Trace trace = e.state()->getTrace();
 				SymState* failPoint = nullptr;
 				std::shared_ptr<const FAE> predicate = nullptr;
 
@@ -411,6 +490,7 @@ protected:
 					absInstr->addPredicate(predicate);
 
 					clearFixpoints();
+					execMan_.clear();
 
 					return false;
 				}
@@ -427,8 +507,18 @@ protected:
 			}
 		}
 		catch (RestartRequest& e)
-		{	// in case a restart is requested, clear all fixpoint computation points
-			clearFixpoints();
+		{	// in case a restart is requested, clear the fixpoint computation points
+			// affected by the new boxes (the backward run of predicate abstraction
+			// needs traces from the initial state, so all of them are cleared then)
+			if (FA_INCREMENTAL_RESTART && !FA_USE_PREDICATE_ABSTRACTION)
+			{
+				restartFixpoints();
+			}
+			else
+			{
+				clearFixpoints();
+				execMan_.clear();
+			}
 
 			FA_DEBUG_AT(2, e.what());
 
@@ -449,11 +539,20 @@ public:   // methods
 		boxMan_{},
 		compiler_(fixpointBackend_, taBackend_, boxMan_),
 		assembly_{},
-		execMan_{},
+		execMan_(conf.workers),
 		conf_(conf),
 		dbgFlag_{false},
 		userRequestFlag_{false}
-	{ }
+	{
+		compiler_.setFuseMicrocode(conf.fuseMicrocode);
+		execMan_.setCheckpointInterval(conf.checkpoints);
+	}
+
+	~Engine()
+	{
+		// the automata memoised by the caches refer to the labels of boxMan_
+		TreeAut::clearCaches();
+	}
 
 	/**
 	 * @brief  Loads types from a storage
@@ -548,23 +647,46 @@ public:   // methods
 			<< *boxMan_.getTypeInfo(GLOBAL_VARS_BLOCK_STR));
 	}
 
-#if 0
-	void loadBoxes(const std::unordered_map<std::string, std::string>& db) {
-
+	size_t loadBoxes(const std::string& fileName)
+	{
 		FA_DEBUG_AT(2, "loading boxes ...");
 
-		for (auto p : db) {
+		return BoxDb::load(fileName, boxMan_, taBackend_);
+	}
+
+	size_t saveBoxes(const std::string& fileName) const
+	{
+		return BoxDb::save(fileName, boxMan_);
+	}
+
+	void exportBoxes(std::ostream& os) const
+	{
+		BoxDb::exportTimbuk(os, boxMan_);
+	}
 
-			this->boxes.push_back((const Box*)boxMan_.loadBox(p.first, db));
+	size_t exportAutomata(std::ostream& os) const
+	{
+		TACorpus corpus;
+		size_t count = 0;
 
-			FA_DEBUG(p.first << ':' << std::endl << *(const FA*)this->boxes.back());
+		for (auto instr : assembly_.code_)
+		{
+			if (instr->getType() != fi_type_e::fiFix)
+				continue;
 
-		}
+			std::vector<std::shared_ptr<const TreeAut>> automata;
+			static_cast<FixpointInstruction*>(instr)->getAutomata(automata);
 
-		boxMan_.buildBoxHierarchy(this->hierarchy, this->basicBoxes);
+			for (const std::shared_ptr<const TreeAut>& ta : automata)
+			{
+				std::ostringstream name;
+				name << "fixpoint" << count++;
+				corpus.add(*ta, name.str());
+			}
+		}
 
+		return corpus.write(os);
 	}
-#endif
 
 	void compile(const CodeStorage::Storage& stor, const CodeStorage::Fnc& entry)
 	{
@@ -581,6 +703,8 @@ public:   // methods
 		// Assertions
 		assert(assembly_.code_.size());
 
+		execMan_.setProfiling(!conf_.profile.empty());
+
 		try
 		{	// expect problems...
 			while (!this->mainLoop())
@@ -603,11 +727,11 @@ public:   // methods
 				if (instr->insn())
 				{
 					FA_DEBUG_AT(1, "fixpoint at " << instr->insn()->loc << std::endl
-						<< (static_cast<FixpointInstruction*>(instr))->getFixPoint());
+						<< minimizedFixpoint(*instr));
 				} else
 				{
 					FA_DEBUG_AT(1, "fixpoint at unknown location" << std::endl
-						<< (static_cast<FixpointInstruction*>(instr))->getFixPoint());
+						<< minimizedFixpoint(*instr));
 				}
 			}
 
@@ -623,9 +747,12 @@ public:   // methods
 			FA_DEBUG(e.what());
 
 			this->printBoxes();
+			this->writeProfile();
 
 			throw;
 		}
+
+		this->writeProfile();
 	}
 
 	void run(const Compiler::Assembly& assembly)
@@ -657,9 +784,7 @@ public:   // methods
 
 	bool testAndClearUserRequestFlag()
 	{
-		bool oldValue = userRequestFlag_;
-		userRequestFlag_ = false;
-		return oldValue;
+		return userRequestFlag_.exchange(false);
 	}
 };
 
@@ -683,11 +808,37 @@ void SymExec::loadTypes(const CodeStorage::Storage& stor)
 	this->engine->loadTypes(stor);
 }
 
-#if 0
-void SymExec::loadBoxes(const std::unordered_map<std::string, std::string>& db) {
-	this->engine->loadBoxes(db);
+size_t SymExec::loadBoxes(const std::string& fileName)
+{
+	// Assertions
+	assert(engine != nullptr);
+
+	return this->engine->loadBoxes(fileName);
+}
+
+size_t SymExec::saveBoxes(const std::string& fileName) const
+{
+	// Assertions
+	assert(engine != nullptr);
+
+	return this->engine->saveBoxes(fileName);
+}
+
+void SymExec::exportBoxes(std::ostream& os) const
+{
+	// Assertions
+	assert(engine != nullptr);
+
+	this->engine->exportBoxes(os);
+}
+
+size_t SymExec::exportAutomata(std::ostream& os) const
+{
+	// Assertions
+	assert(engine != nullptr);
+
+	return this->engine->exportAutomata(os);
 }
-#endif
 
 const Compiler::Assembly& SymExec::GetAssembly() const
 {
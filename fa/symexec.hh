@@ -21,7 +21,8 @@
 #define SYM_EXEC_H
 
 // Standard library headers
-#include <unordered_map>
+#include <ostream>
+#include <string>
 
 // Forester headers
 #include "compiler.hh"
@@ -77,7 +78,49 @@ public:   // methods
 	 */
 	void loadTypes(const CodeStorage::Storage& stor);
 
-//	void loadBoxes(const std::unordered_map<std::string, std::string>& db);
+	/**
+	 * @brief  Loads boxes from a box database
+	 *
+	 * Loads boxes learnt by earlier analyses from the box database in the file
+	 * @p fileName. The types of the program need to be loaded first by the
+	 * method @p loadTypes.
+	 *
+	 * @param[in]  fileName  The name of the box database file
+	 *
+	 * @returns  The number of loaded boxes
+	 */
+	size_t loadBoxes(const std::string& fileName);
+
+	/**
+	 * @brief  Stores boxes into a box database
+	 *
+	 * Stores all boxes known to the analysis (including those learnt during the
+	 * last run) into the box database in the file @p fileName.
+	 *
+	 * @param[in]  fileName  The name of the box database file
+	 *
+	 * @returns  The number of stored boxes
+	 */
+	size_t saveBoxes(const std::string& fileName) const;
+
+	/**
+	 * @brief  Exports boxes in the Timbuk format
+	 *
+	 * @param[out]  os  The output stream
+	 */
+	void exportBoxes(std::ostream& os) const;
+
+	/**
+	 * @brief  Exports the automata of the fixpoints in the Timbuk format
+	 *
+	 * Writes the automata of all fixpoints (see @p TACorpus) to @p os so that
+	 * they can be used as a corpus for benchmarking the automata kernels.
+	 *
+	 * @param[out]  os  The output stream
+	 *
+	 * @returns  The number of exported automata
+	 */
+	size_t exportAutomata(std::ostream& os) const;
 
 
 	/**
@@ -18,6 +18,9 @@
  */
 
 
+// Boost headers
+#include <boost/functional/hash.hpp>
+
 // Forester headers
 #include "compiler.hh"
 #include "integrity.hh"
@@ -32,7 +35,7 @@ void SymState::init(
 	SymState*                             parent,
 	AbstractInstruction*                  instr,
 	const std::shared_ptr<const FAE>&     fae,
-	const std::shared_ptr<DataArray>&     regs)
+	const RegisterFile&                   regs)
 {
 	// Assertions
 	assert(Integrity(*fae).check());
@@ -41,7 +44,7 @@ void SymState::init(
 	fae_       = fae;
 	regs_      = regs;
 
-	this->setParent(parent);
+	this->link(parent);
 }
 
 
@@ -53,24 +56,26 @@ void SymState::init(
 	regs_  = oldState.regs_;
 
 	this->clearTree();
+	this->link(nullptr);
 }
 
 
 void SymState::init(
 	const SymState&                                oldState,
-	const std::shared_ptr<DataArray>               regs)
+	const RegisterFile&                            regs)
 {
 	instr_ = oldState.instr_;
 	fae_   = oldState.fae_;
 	regs_  = regs;
 
 	this->clearTree();
+	this->link(nullptr);
 }
 
 
 void SymState::init(
 	const SymState&                                oldState,
-	const std::shared_ptr<DataArray>               regs,
+	const RegisterFile&                            regs,
 	AbstractInstruction*                           insn)
 {
 	instr_ = insn;
@@ -78,6 +83,7 @@ void SymState::init(
 	regs_  = regs;
 
 	this->clearTree();
+	this->link(nullptr);
 }
 
 
@@ -93,14 +99,14 @@ void SymState::initChildFrom(
 	fae_    = parent->fae_;
 	regs_   = parent->regs_;
 
-	this->setParent(parent);
+	this->link(parent);
 }
 
 
 void SymState::initChildFrom(
 	SymState*                                      parent,
 	AbstractInstruction*                           instr,
-	const std::shared_ptr<DataArray>               regs)
+	const RegisterFile&                            regs)
 {
 	// Assertions
 	assert(nullptr != parent);
@@ -110,10 +116,72 @@ void SymState::initChildFrom(
 	fae_    = parent->fae_;
 	regs_   = regs;
 
+	this->link(parent);
+}
+
+
+void SymState::link(SymState* parent)
+{
+	depth_      = (nullptr == parent) ? 0 : parent->depth_ + 1;
+	branch_     = (nullptr == parent) ? 0 : parent->successors_++;
+	successors_ = 0;
+
 	this->setParent(parent);
 }
 
 
+size_t SymState::digest(const FAE& fae)
+{
+	size_t seed = 0;
+	boost::hash_combine(seed, fae.GetVariables());
+	for (const std::shared_ptr<TreeAut>& root : fae.getRoots())
+	{
+		if (nullptr == root)
+		{
+			boost::hash_combine(seed, 0);
+			continue;
+		}
+
+		for (size_t state : root->getFinalStates())
+			boost::hash_combine(seed, state);
+
+		for (const TreeAut::Transition& trans : *root)
+		{	// the labels are shared by all automata, they may be hashed as pointers
+			boost::hash_combine(seed, trans.rhs());
+			boost::hash_combine(seed, &*trans.label());
+			boost::hash_combine(seed, trans.lhs());
+		}
+	}
+
+	return seed;
+}
+
+
+void SymState::compact()
+{
+	// Assertions
+	assert(nullptr != fae_);
+
+	digest_ = SymState::digest(*fae_);
+	fae_    = nullptr;
+}
+
+
+bool SymState::restore(const std::shared_ptr<const FAE>& fae)
+{
+	// Assertions
+	assert(nullptr == fae_);
+	assert(nullptr != fae);
+
+	if (SymState::digest(*fae) != digest_)
+		return false;
+
+	fae_ = fae;
+
+	return true;
+}
+
+
 void SymState::recycle(Recycler<SymState>& recycler)
 {
 	if (nullptr != this->GetParent())
@@ -128,8 +196,9 @@ void SymState::recycle(Recycler<SymState>& recycler)
 		SymState* state = stack.back();
 		stack.pop_back();
 
-		assert(state->GetFAE());
+		// the automaton of an inner state may have been dropped by compact()
 		state->fae_ = nullptr;
+		state->regs_.clear();
 
 		for (auto s : state->GetChildren())
 		{
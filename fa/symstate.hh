@@ -32,6 +32,7 @@
 #include "forestautext.hh"
 #include "link_tree.hh"
 #include "recycler.hh"
+#include "registerfile.hh"
 #include "types.hh"
 
 /**
@@ -61,19 +62,50 @@ private:  // data members
 	/// Instruction that the symbolic state corresponds to
 	AbstractInstruction* instr_;
 
-	/// Forest automaton for the symbolic state
+	/// Forest automaton for the symbolic state (dropped by @p compact())
 	std::shared_ptr<const FAE> fae_;
 
 	/// the registers
-	std::shared_ptr<DataArray> regs_;
+	RegisterFile regs_;
+
+	/// the depth of the state in the execution graph
+	size_t depth_;
+
+	/// the index of the state among the successors of its parent
+	size_t branch_;
+
+	/// the number of successors the state has given rise to
+	size_t successors_;
+
+	/// the digest of the forest automaton dropped by @p compact()
+	size_t digest_;
 
 private:  // methods
 
 	SymState(const SymState&);
 	SymState& operator=(const SymState&);
 
+	/**
+	 * @brief  Links the state to its parent in the execution graph
+	 *
+	 * @param[in,out]  parent  The parent state (@p nullptr for a root)
+	 */
+	void link(SymState* parent);
+
 public:   // methods
 
+	/**
+	 * @brief  Computes the digest of a forest automaton
+	 *
+	 * The digest covers the variables of @p fae and the final states and the
+	 * transitions of all its roots.
+	 *
+	 * @param[in]  fae  The forest automaton
+	 *
+	 * @returns  The digest
+	 */
+	static size_t digest(const FAE& fae);
+
 	/**
 	 * @brief  Constructor
 	 *
@@ -82,7 +114,11 @@ public:   // methods
 	SymState() :
 		instr_{},
 		fae_{},
-		regs_(nullptr)
+		regs_{},
+		depth_{},
+		branch_{},
+		successors_{},
+		digest_{}
 	{ }
 
 	/**
@@ -101,12 +137,9 @@ public:   // methods
 		return fae_;
 	}
 
-	const DataArray& GetRegs() const
+	const RegisterFile& GetRegs() const
 	{
-		// Assertions
-		assert(nullptr != regs_);
-
-		return *regs_;
+		return regs_;
 	}
 
 	const Data& GetReg(size_t index) const
@@ -125,15 +158,9 @@ public:   // methods
 	void SetReg(size_t index, const Data& data)
 	{
 		// Assertions
-		assert(nullptr != regs_);
 		assert(index < this->GetRegs().size());
 
-		(*regs_)[index] = data;
-	}
-
-	const std::shared_ptr<DataArray>& GetRegsShPtr() const
-	{
-		return regs_;
+		regs_.set(index, data);
 	}
 
 	const AbstractInstruction* GetInstr() const
@@ -151,6 +178,38 @@ public:   // methods
 		fae_ = fae;
 	}
 
+	size_t GetDepth() const
+	{
+		return depth_;
+	}
+
+	size_t GetBranch() const
+	{
+		return branch_;
+	}
+
+
+	/**
+	 * @brief  Drops the forest automaton of the state
+	 *
+	 * Drops the forest automaton of an executed state to save memory. Only its
+	 * digest is kept so that an automaton recomputed later can be checked by
+	 * @p restore().
+	 */
+	void compact();
+
+
+	/**
+	 * @brief  Restores the forest automaton dropped by @p compact()
+	 *
+	 * @param[in]  fae  The recomputed forest automaton
+	 *
+	 * @returns  @p true if @p fae matches the digest of the dropped automaton
+	 *           (it is then set as the automaton of the state), @p false
+	 *           otherwise
+	 */
+	bool restore(const std::shared_ptr<const FAE>& fae);
+
 
 	/**
 	 * @brief  Initializes the symbolic state
@@ -166,7 +225,7 @@ public:   // methods
 		SymState*                                      parent,
 		AbstractInstruction*                           instr,
 		const std::shared_ptr<const FAE>&              fae,
-		const std::shared_ptr<DataArray>&              regs);
+		const RegisterFile&                            regs);
 
 
 	/**
@@ -191,7 +250,7 @@ public:   // methods
 	 */
 	void init(
 		const SymState&                                oldState,
-		const std::shared_ptr<DataArray>               regs);
+		const RegisterFile&                            regs);
 
 
 	/**
@@ -205,7 +264,7 @@ public:   // methods
 	 */
 	void init(
 		const SymState&                                oldState,
-		const std::shared_ptr<DataArray>               regs,
+		const RegisterFile&                            regs,
 		AbstractInstruction*                           insn);
 
 
@@ -237,7 +296,7 @@ public:   // methods
 	void initChildFrom(
 		SymState*                                      parent,
 		AbstractInstruction*                           instr,
-		const std::shared_ptr<DataArray>               regs);
+		const RegisterFile&                            regs);
 
 	/**
 	 * @brief  Recycles the symbolic state for further use
@@ -304,6 +363,10 @@ public:   // methods
 	 * @param[in]  fwd  The other symbolic state (from the forward run)
 	 *
 	 * @note  This may not compute the most precise intersection!
+	 *
+	 * @note  The intersections are not memoised, since the backward run
+	 *        intersects a freshly computed automaton at every step, so that
+	 *        no pair of automata repeats.
 	 */
 	void Intersect(
 		const SymState&      fwd);
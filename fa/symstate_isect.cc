@@ -24,6 +24,14 @@
  * intersection of a pair of symbolic states.
  */
 
+// Standard library headers
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+// Boost headers
+#include <boost/functional/hash.hpp>
+
 // Forester headers
 #include "streams.hh"
 #include "symstate.hh"
@@ -44,6 +52,11 @@ struct RootState
 		state(pState)
 	{ }
 
+	bool operator==(const RootState& rhs) const
+	{
+		return (root == rhs.root) && (state == rhs.state);
+	}
+
 	bool operator<(const RootState& rhs) const
 	{
 		if (root < rhs.root)
@@ -74,6 +87,22 @@ typedef std::pair<RootState, RootState> ProdState;
 // anonymous namespace
 namespace
 {
+/**
+ * @brief  Hash function of product states
+ */
+struct ProdStateHash
+{
+	size_t operator()(const ProdState& prodState) const
+	{
+		size_t seed = 0;
+		boost::hash_combine(seed, prodState.first.root);
+		boost::hash_combine(seed, prodState.first.state);
+		boost::hash_combine(seed, prodState.second.root);
+		boost::hash_combine(seed, prodState.second.state);
+		return seed;
+	}
+};
+
 /**
  * @brief  Engine for reference substitution
  */
@@ -82,7 +111,7 @@ class SubsRefEngine
 private:  // data members
 
 	/// Keeps product states, e.g. (p,q)
-	std::set<ProdState> processed_;
+	std::unordered_set<ProdState, ProdStateHash> processed_;
 
 	/// The work stack
 	std::vector<ProdState> workstack_;
@@ -158,7 +187,7 @@ public:   // methods
 		return res;
 	}
 
-	const std::set<ProdState>& getProcessed() const
+	const std::unordered_set<ProdState, ProdStateHash>& getProcessed() const
 	{
 		return processed_;
 	}
@@ -175,17 +204,21 @@ private:  // data members
 	FAE& fae_;
 
 	/// Maps product states to states in the new automaton, e.g. (p,q) -> r
-	std::map<ProdState, RootState> processed_;
+	std::unordered_map<ProdState, RootState, ProdStateHash> processed_;
 
 	/// The work stack
 	std::vector<std::pair<ProdState, RootState>> workstack_;
 
 	/// Maps pairs of roots to a root in the new automaton
-	std::map<std::pair<size_t, size_t>, size_t> rootMap_;
+	std::unordered_map<std::pair<size_t, size_t>, size_t,
+		boost::hash<std::pair<size_t, size_t>>> rootMap_;
 
 	/// Maps roots of RHS automaton to roots of the new automaton
 	std::map<size_t, size_t> rhsRootMap_;
 
+	/// The final states of the roots of the new automaton
+	std::vector<size_t> finalStates_;
+
 	/// Counter of roots in the new FAE
 	size_t rootCnt_;
 
@@ -197,6 +230,7 @@ public:   // methods
 		workstack_(),
 		rootMap_(),
 		rhsRootMap_(),
+		finalStates_(),
 		rootCnt_(0)
 	{ }
 
@@ -267,6 +301,7 @@ public:   // methods
 		if (isNewRoot)
 		{	// set final state
 			fae_.getRoot(root)->addFinalState(state);
+			finalStates_.push_back(state);
 		}
 
 		auto itBoolRhsRootMap = rhsRootMap_.insert(std::make_pair(rhsRoot, root));
@@ -314,6 +349,20 @@ public:   // methods
 		return res;
 	}
 
+	/**
+	 * @brief  Determines whether a state is the final state of its root
+	 *
+	 * @param[in]  rootState  The root and the state in the new FAE
+	 *
+	 * @returns  @p true if @p rootState is the final state of its root
+	 */
+	bool isFinal(const RootState& rootState) const
+	{
+		assert(rootState.root < finalStates_.size());
+
+		return finalStates_[rootState.root] == rootState.state;
+	}
+
 	std::vector<size_t> getRootOrderIndexForRHS() const
 	{
 		std::vector<size_t> index(fae_.getRootCount(), static_cast<size_t>(-1));
@@ -509,16 +558,10 @@ void SymState::SubstituteRefs(
 					size_t i;
 					for (i = 0; i < transArity; ++i)
 					{	// for each pair of states that map to each other
-						const Data* srcData = nullptr, *thisData = nullptr;
+						Data srcData, thisData;
 						bool  srcIsData =  srcFAE->isData( srcTrans.lhs()[i],  srcData);
 						bool thisIsData = thisFAE->isData(thisTrans.lhs()[i], thisData);
 
-						//  srcIsData <-> nullptr != srcData
-						assert((!srcIsData || (nullptr != srcData))
-							&& (srcIsData || (nullptr == srcData)));
-						//  thisIsData <-> nullptr != thisData
-						assert((!thisIsData || (nullptr != thisData))
-							&& (thisIsData || (nullptr == thisData)));
 
 						if (!srcIsData && !thisIsData)
 						{	// ************* process internal states *************
@@ -530,17 +573,17 @@ void SymState::SubstituteRefs(
 
 							lhs.push_back(thisTrans.lhs()[i]);
 						}
-						else if (srcIsData && (*srcData == oldValue))
+						else if (srcIsData && (srcData == oldValue))
 						{ // ************* perform substitution of reference *************
-							assert(thisIsData && thisData->isUndef());
+							assert(thisIsData && thisData.isUndef());
 
-							FA_NOTE("Substituting " << *srcData << " for " << newValue);
+							FA_NOTE("Substituting " << srcData << " for " << newValue);
 
 							lhs.push_back(fae->addData(
 								*fae->getRoot(thisRoot).get(), newValue));
 						}
 						else if (srcIsData && thisIsData &&
-							!srcData->isRef() && !thisData->isRef())
+							!srcData.isRef() && !thisData.isRef())
 						{ // ************* process real data states (leaves) *************
 							// This is the second easiest case, when both states are real data
 							// (i.e. no references). In this case, we are simply doing
@@ -548,24 +591,24 @@ void SymState::SubstituteRefs(
 
 							// Ignore if it is not compatible... we will detect it at
 							// intersection
-							//assert(*thisData == *srcData);
+							//assert(thisData == srcData);
 
 							lhs.push_back(fae->addData(
-								*fae->getRoot(thisRoot).get(), *thisData));
+								*fae->getRoot(thisRoot).get(), thisData));
 						}
 						else if (srcIsData && thisIsData &&
-							srcData->isRef() && thisData->isRef())
+							srcData.isRef() && thisData.isRef())
 						{ // ************* process reference states (leaves) *************
 							// This is another quite easy case, when both states are
 							// references to another automata. In this case, we are jumping
 							// from both automata into another product automaton.
-							assert(thisData->d_ref.displ == srcData->d_ref.displ);
-							assert(0 == thisData->d_ref.displ);
+							assert(thisData.d_ref.displ == srcData.d_ref.displ);
+							assert(0 == thisData.d_ref.displ);
 
 							FA_NOTE("Two references");
 
-							const size_t& thisNewRoot = thisData->d_ref.root;
-							const size_t& srcNewRoot  = srcData->d_ref.root;
+							const size_t& thisNewRoot = thisData.d_ref.root;
+							const size_t& srcNewRoot  = srcData.d_ref.root;
 
 							const TreeAut* thisNewTA = thisFAE->getRoot(thisNewRoot).get();
 							const TreeAut* srcNewTA  = srcFAE->getRoot(srcNewRoot).get();
@@ -578,10 +621,10 @@ void SymState::SubstituteRefs(
 							lhs.push_back(fae->addData(*fae->getRoot(thisRoot).get(),
 								Data::createRef(thisNewRoot)));
 						}
-						else if ((srcIsData && !thisIsData && srcData->isNull())
-							|| (!srcIsData && thisIsData && thisData->isNull())
-							|| (srcIsData && thisIsData && srcData->isNull() && thisData->isRef())
-							|| (srcIsData && thisIsData && srcData->isRef() && thisData->isNull()))
+						else if ((srcIsData && !thisIsData && srcData.isNull())
+							|| (!srcIsData && thisIsData && thisData.isNull())
+							|| (srcIsData && thisIsData && srcData.isNull() && thisData.isRef())
+							|| (srcIsData && thisIsData && srcData.isRef() && thisData.isNull()))
 						{ // ************* process NULL pointers *************
 							// This is the case when there is a NULL pointer and either an
 							// internal state or a reference
@@ -589,17 +632,17 @@ void SymState::SubstituteRefs(
 
 							break;   // cut this branch of the product
 						}
-						else if ((srcIsData && !thisIsData && srcData->isRef())
-							|| (!srcIsData && thisIsData && thisData->isRef()))
+						else if ((srcIsData && !thisIsData && srcData.isRef())
+							|| (!srcIsData && thisIsData && thisData.isRef()))
 						{ // ************* process jumps *************
 							// This is the case when one FA jumps to another TA and the other does not
 							FA_NOTE("jump!");
 
 							if (srcIsData)
 							{
-								assert(srcIsData && !thisIsData && srcData->isRef());
+								assert(srcIsData && !thisIsData && srcData.isRef());
 
-								const size_t& srcNewRoot = srcData->d_ref.root;
+								const size_t& srcNewRoot = srcData.d_ref.root;
 								const TreeAut* srcNewTA  = srcFAE->getRoot(srcNewRoot).get();
 								assert(nullptr != srcNewTA);
 
@@ -611,9 +654,9 @@ void SymState::SubstituteRefs(
 							}
 							else
 							{
-								assert(!srcIsData && thisIsData && thisData->isRef());
+								assert(!srcIsData && thisIsData && thisData.isRef());
 
-								const size_t& thisNewRoot = thisData->d_ref.root;
+								const size_t& thisNewRoot = thisData.d_ref.root;
 								const TreeAut* thisNewTA = thisFAE->getRoot(thisNewRoot).get();
 								assert(nullptr != thisNewTA);
 
@@ -665,44 +708,67 @@ void SymState::SubstituteRefs(
 }
 
 
-void SymState::Intersect(
-	const SymState&          fwd)
+namespace
 {
-	const std::shared_ptr<const FAE> thisFAE = this->GetFAE();
-	const std::shared_ptr<const FAE> fwdFAE = fwd.GetFAE();
-	assert((nullptr != thisFAE) && (nullptr != fwdFAE));
+/**
+ * @brief  Creates an empty forest automaton compatible with the given one
+ *
+ * @param[in]  fae  The forest automaton from the backward run
+ *
+ * @returns  An empty forest automaton with the state offset of @p fae
+ */
+std::shared_ptr<FAE> intersectEmpty(
+	const FAE&                   fae)
+{
+	FAE* result = new FAE(fae);
+	result->clear();
+	result->setStateOffset(fae.nextState());
+
+	return std::shared_ptr<FAE>(result);
+}
 
-	FAE* fae = new FAE(*thisFAE);
-	fae->clear();
-	fae->setStateOffset(thisFAE->nextState());
-	this->SetFAE(std::shared_ptr<FAE>(fae));
+
+/**
+ * @brief  Computes the intersection of two forest automata
+ *
+ * The product is built on the fly from the pairs of the roots referenced by
+ * the global variables. As soon as the final state of a root of the product
+ * has no transition, the language of the product is known to be empty and
+ * the construction stops.
+ *
+ * @param[in]  thisFAE  The forest automaton from the backward run
+ * @param[in]  fwdFAE   The forest automaton from the forward run
+ *
+ * @returns  The intersection (possibly empty) of @p thisFAE and @p fwdFAE
+ *
+ * @note  This may not compute the most precise intersection!
+ */
+std::shared_ptr<FAE> intersect(
+	const FAE&                   thisFAE,
+	const FAE&                   fwdFAE)
+{
+	std::shared_ptr<FAE> result = intersectEmpty(thisFAE);
+	FAE* fae = result.get();
 
 	// engine that handles creation of new states etc.
 	IsectEngine engine(*fae);
 
-	if (this->GetRegCount() != fwd.GetRegCount())
-	{	// if the number of local registers does not match
-		FA_LOG("Number of local registers does not match -> creating empty intersection");
-		return;      // empty FA
-	}
-
-	if (thisFAE->GetVarCount() != fwdFAE->GetVarCount())
+	if (thisFAE.GetVarCount() != fwdFAE.GetVarCount())
 	{	// if the number of input ports of the FAE does not match
 		FA_LOG("Number of input ports does not match -> creating empty intersection");
-		return;      // empty FA
+		return result;      // empty FA
 	}
 
-	assert(thisFAE->GetVarCount() == fwdFAE->GetVarCount());
-	for (size_t i = 0; i < thisFAE->GetVarCount(); ++i)
+	for (size_t i = 0; i < thisFAE.GetVarCount(); ++i)
 	{	// check global variables
-		const Data& thisVar = thisFAE->GetVar(i);
-		const Data& fwdVar = fwdFAE->GetVar(i);
+		const Data& thisVar = thisFAE.GetVar(i);
+		const Data& fwdVar = fwdFAE.GetVar(i);
 
 		if (!thisVar.isRef() && !fwdVar.isRef())
 		{	// in case of non-references
 			if (thisVar != fwdVar)
 			{
-				return;   // empty FA
+				return result;   // empty FA
 			}
 		}
 		else
@@ -711,35 +777,10 @@ void SymState::Intersect(
 		}
 	}
 
-	assert(this->GetRegCount() == fwd.GetRegCount());
-	for (size_t i = 0; i < this->GetRegCount(); ++i)
-	{	// check local registers
-
-		// NOTE: this needs to be done in order to also collect temporary TA
-		// references for parts of heap which has not been so far connected so that
-		// they would be reachable from global variables
-
-		const Data& thisVar = this->GetReg(i);
-		const Data& fwdVar = fwd.GetReg(i);
-
-		if (!thisVar.isRef() && !fwdVar.isRef())
-		{	// in case of non-references
-			if (thisVar != fwdVar)
-			{
-				return;   // empty FA
-			}
-		}
-		else
-		{
-			assert(thisVar.isRef() && fwdVar.isRef());
-		}
-	}
-
-	assert(thisFAE->GetVarCount() == fwdFAE->GetVarCount());
-	for (size_t i = 0; i < thisFAE->GetVarCount(); ++i)
+	for (size_t i = 0; i < thisFAE.GetVarCount(); ++i)
 	{	// add processing of all global variables
-		const Data& thisVar = thisFAE->GetVar(i);
-		const Data& fwdVar = fwdFAE->GetVar(i);
+		const Data& thisVar = thisFAE.GetVar(i);
+		const Data& fwdVar = fwdFAE.GetVar(i);
 
 		if (!thisVar.isRef() || !fwdVar.isRef())
 		{	// in case some of them is not a reference
@@ -755,8 +796,8 @@ void SymState::Intersect(
 			const size_t thisRootNum = thisVar.d_ref.root;
 			const size_t fwdRootNum = fwdVar.d_ref.root;
 
-			const TreeAut* thisRoot = thisFAE->getRoot(thisRootNum).get();
-			const TreeAut* fwdRoot  = fwdFAE->getRoot(fwdRootNum).get();
+			const TreeAut* thisRoot = thisFAE.getRoot(thisRootNum).get();
+			const TreeAut* fwdRoot  = fwdFAE.getRoot(fwdRootNum).get();
 			assert((nullptr != thisRoot) && (nullptr != fwdRoot));
 
 			RootState rs = engine.makeProductState(
@@ -780,13 +821,16 @@ void SymState::Intersect(
 		const size_t& thisRoot = curState.first.root;
 		const size_t& fwdRoot = curState.second.root;
 
-		const std::shared_ptr<TreeAut> thisTA = thisFAE->getRoot(thisRoot);
-		const std::shared_ptr<TreeAut> fwdTA = fwdFAE->getRoot(fwdRoot);
+		const std::shared_ptr<TreeAut> thisTA = thisFAE.getRoot(thisRoot);
+		const std::shared_ptr<TreeAut> fwdTA = fwdFAE.getRoot(fwdRoot);
 		assert((nullptr != thisTA) && (nullptr != fwdTA));
 
 		const size_t& thisState = curState.first.state;
 		const size_t& fwdState = curState.second.state;
 
+		// the number of transitions of the product state
+		size_t transCnt = 0;
+
 		TreeAut::iterator thisIt = thisTA->begin(thisState);
 		TreeAut::iterator thisEnd = thisTA->end(thisState, thisIt);
 		TreeAut::iterator fwdIt = fwdTA->begin(fwdState);
@@ -796,8 +840,8 @@ void SymState::Intersect(
 		{
 			for (; fwdIt != fwdEnd; ++fwdIt)
 			{
-				const Transition& thisTrans = *thisIt;
-				const Transition& fwdTrans = *fwdIt;
+				const TreeAut::Transition& thisTrans = *thisIt;
+				const TreeAut::Transition& fwdTrans = *fwdIt;
 
 				// we handle data one level up
 				assert(!thisTrans.label()->isData() && !fwdTrans.label()->isData());
@@ -822,16 +866,14 @@ void SymState::Intersect(
 					size_t i;
 					for (i = 0; i < transArity; ++i)
 					{	// for each pair of states that map to each other
-						const Data* fwdData = nullptr, *thisData = nullptr;
-						bool  fwdIsData =  fwdFAE->isData( fwdTrans.lhs()[i],  fwdData);
-						bool thisIsData = thisFAE->isData(thisTrans.lhs()[i], thisData);
+						Data fwdData, thisData;
+						bool  fwdIsData =  fwdFAE.isData( fwdTrans.lhs()[i],  fwdData);
+						bool thisIsData = thisFAE.isData(thisTrans.lhs()[i], thisData);
 
 						if (!fwdIsData && !thisIsData)
 						{	// ************* process internal states *************
 							// This is the easiest case, when both states in the product are
 							// internal. We do not create any new automaton.
-							assert((nullptr == fwdData) && (nullptr == thisData));
-
 							RootState rootState = engine.makeProductState(
 								thisRoot, thisTrans.lhs()[i],
 								fwdRoot, fwdTrans.lhs()[i]);
@@ -842,15 +884,15 @@ void SymState::Intersect(
 							lhs.push_back(rootState.state);
 						}
 						else if (fwdIsData && thisIsData &&
-							!fwdData->isRef() && !thisData->isRef())
+							!fwdData.isRef() && !thisData.isRef())
 						{ // ************* process real data states (leaves) *************
 							// This is the second easiest case, when both states are real data
 							// (i.e. no references). In this case, we are simply doing
 							// intersection of the data.
-							if (*thisData == *fwdData)
+							if (thisData == fwdData)
 							{	// in case the data match
 								lhs.push_back(fae->addData(
-									*fae->getRoot(curNewState.root).get(), *thisData));
+									*fae->getRoot(curNewState.root).get(), thisData));
 							}
 							else
 							{	// in case the data are different
@@ -858,19 +900,19 @@ void SymState::Intersect(
 							}
 						}
 						else if (fwdIsData && thisIsData &&
-							fwdData->isRef() && thisData->isRef())
+							fwdData.isRef() && thisData.isRef())
 						{ // ************* process reference states (leaves) *************
 							// This is another quite easy case, when both states are
 							// references to another automata. In this case, we are jumping
 							// from both automata into another product automaton.
-							assert(thisData->d_ref.displ == fwdData->d_ref.displ);
-							assert(0 == thisData->d_ref.displ);
+							assert(thisData.d_ref.displ == fwdData.d_ref.displ);
+							assert(0 == thisData.d_ref.displ);
 
-							const size_t& thisNewRoot = thisData->d_ref.root;
-							const size_t& fwdNewRoot  = fwdData->d_ref.root;
+							const size_t& thisNewRoot = thisData.d_ref.root;
+							const size_t& fwdNewRoot  = fwdData.d_ref.root;
 
-							const TreeAut* thisNewTA = thisFAE->getRoot(thisNewRoot).get();
-							const TreeAut* fwdNewTA  = fwdFAE->getRoot(fwdNewRoot).get();
+							const TreeAut* thisNewTA = thisFAE.getRoot(thisNewRoot).get();
+							const TreeAut* fwdNewTA  = fwdFAE.getRoot(fwdNewRoot).get();
 							assert((nullptr != thisNewTA) && (nullptr != fwdNewTA));
 
 							RootState rootState = engine.makeProductState(
@@ -880,17 +922,17 @@ void SymState::Intersect(
 							lhs.push_back(fae->addData(*fae->getRoot(curNewState.root).get(),
 								Data::createRef(rootState.root)));
 						}
-						else if ((fwdIsData && !thisIsData && fwdData->isNull())
-							|| (!fwdIsData && thisIsData && thisData->isNull())
-							|| (fwdIsData && thisIsData && fwdData->isNull() && thisData->isRef())
-							|| (fwdIsData && thisIsData && fwdData->isRef() && thisData->isNull()))
+						else if ((fwdIsData && !thisIsData && fwdData.isNull())
+							|| (!fwdIsData && thisIsData && thisData.isNull())
+							|| (fwdIsData && thisIsData && fwdData.isNull() && thisData.isRef())
+							|| (fwdIsData && thisIsData && fwdData.isRef() && thisData.isNull()))
 						{ // ************* process NULL pointers *************
 							// This is the case when there is a NULL pointer and either an
 							// internal state or a reference
 							break;   // cut this branch of the intersection
 						}
-						else if ((fwdIsData && !thisIsData && fwdData->isRef())
-							|| (!fwdIsData && thisIsData && thisData->isRef()))
+						else if ((fwdIsData && !thisIsData && fwdData.isRef())
+							|| (!fwdIsData && thisIsData && thisData.isRef()))
 						{ // ************* process jumps *************
 							// This is the case when one FA jumps to another TA and the other does not
 							FA_NOTE("jump!");
@@ -898,10 +940,10 @@ void SymState::Intersect(
 							RootState rootState;
 							if (fwdIsData)
 							{
-								assert(fwdIsData && !thisIsData && fwdData->isRef());
+								assert(fwdIsData && !thisIsData && fwdData.isRef());
 
-								const size_t& fwdNewRoot = fwdData->d_ref.root;
-								const TreeAut* fwdNewTA  = fwdFAE->getRoot(fwdNewRoot).get();
+								const size_t& fwdNewRoot = fwdData.d_ref.root;
+								const TreeAut* fwdNewTA  = fwdFAE.getRoot(fwdNewRoot).get();
 								assert(nullptr != fwdNewTA);
 
 								rootState = engine.makeProductState(
@@ -910,10 +952,10 @@ void SymState::Intersect(
 							}
 							else
 							{
-								assert(!fwdIsData && thisIsData && thisData->isRef());
+								assert(!fwdIsData && thisIsData && thisData.isRef());
 
-								const size_t& thisNewRoot = thisData->d_ref.root;
-								const TreeAut* thisNewTA = thisFAE->getRoot(thisNewRoot).get();
+								const size_t& thisNewRoot = thisData.d_ref.root;
+								const TreeAut* thisNewTA = thisFAE.getRoot(thisNewRoot).get();
 								assert(nullptr != thisNewTA);
 
 								rootState = engine.makeProductState(
@@ -947,10 +989,19 @@ void SymState::Intersect(
 
 						fae->getRoot(curNewState.root)->addTransition(
 							lhs, thisTrans.label(), curNewState.state);
+						++transCnt;
 					}
 				}
 			}
 		}
+
+		if ((0 == transCnt) && engine.isFinal(curNewState))
+		{	// in case a root of the product has an empty language
+			FA_NOTE("Empty root " << curNewState.root << " of the intersection");
+
+			fae->clear();   // the language of the FA is empty
+			return result;
+		}
 	}
 
 	FA_NOTE("Result of intersection: " << *fae);
@@ -967,7 +1018,7 @@ void SymState::Intersect(
 		if (ta->getFinalStates().empty())
 		{	// in case the language of an automaton is empty
 			fae->clear();   // the language of the FA is empty
-			return;
+			return result;
 		}
 
 		fae->setRoot(i, pTa);
@@ -986,7 +1037,7 @@ void SymState::Intersect(
 	FA_NOTE("Index: " << os.str());
 
 	std::vector<std::shared_ptr<TreeAut>> newRoots;
-	size_t newRootsSize = std::max(fae->getRootCount(), fwdFAE->getRootCount());
+	size_t newRootsSize = std::max(fae->getRootCount(), fwdFAE.getRootCount());
 	for (size_t i = 0; i < newRootsSize; ++i)
 	{
 		newRoots.push_back(std::shared_ptr<TreeAut>());
@@ -1016,6 +1067,51 @@ void SymState::Intersect(
 //	fae->updateConnectionGraph();
 
 	FA_WARN("Underapproximating intersection");
+
+	return result;
+}
+} // namespace
+
+
+void SymState::Intersect(
+	const SymState&          fwd)
+{
+	const std::shared_ptr<const FAE> thisFAE = this->GetFAE();
+	const std::shared_ptr<const FAE> fwdFAE = fwd.GetFAE();
+	assert((nullptr != thisFAE) && (nullptr != fwdFAE));
+
+	if (this->GetRegCount() != fwd.GetRegCount())
+	{	// if the number of local registers does not match
+		FA_LOG("Number of local registers does not match -> creating empty intersection");
+		this->SetFAE(intersectEmpty(*thisFAE));
+		return;      // empty FA
+	}
+
+	for (size_t i = 0; i < this->GetRegCount(); ++i)
+	{	// check local registers
+
+		// NOTE: this needs to be done in order to also collect temporary TA
+		// references for parts of heap which has not been so far connected so that
+		// they would be reachable from global variables
+
+		const Data& thisVar = this->GetReg(i);
+		const Data& fwdVar = fwd.GetReg(i);
+
+		if (!thisVar.isRef() && !fwdVar.isRef())
+		{	// in case of non-references
+			if (thisVar != fwdVar)
+			{
+				this->SetFAE(intersectEmpty(*thisFAE));
+				return;   // empty FA
+			}
+		}
+		else
+		{
+			assert(thisVar.isRef() && fwdVar.isRef());
+		}
+	}
+
+	this->SetFAE(intersect(*thisFAE, *fwdFAE));
 }
 
 
@@ -1096,16 +1192,10 @@ void FAE::makeProduct(
 
 					for (size_t i = 0; i < lhsTrans.lhs().size(); ++i)
 					{	// for each pair of states that map to each other
-						const Data* lhsData = nullptr, *rhsData = nullptr;
+						Data lhsData, rhsData;
 						bool lhsIsData = lhs.isData(lhsTrans.lhs()[i], lhsData);
 						bool rhsIsData = rhs.isData(rhsTrans.lhs()[i], rhsData);
 
-						//  lhsIsData <-> nullptr != lrcData
-						assert((!lhsIsData || (nullptr != lhsData))
-							&& (lhsIsData || (nullptr == lhsData)));
-						//  rhsIsData <-> nullptr != rhsData
-						assert((!rhsIsData || (nullptr != rhsData))
-							&& (rhsIsData || (nullptr == rhsData)));
 
 						if (!lhsIsData && !rhsIsData)
 						{	// ************* process internal states *************
@@ -1116,29 +1206,29 @@ void FAE::makeProduct(
 								rhsRoot, rhsTrans.lhs()[i]);
 						}
 						else if (lhsIsData && rhsIsData &&
-							!lhsData->isRef() && !rhsData->isRef())
+							!lhsData.isRef() && !rhsData.isRef())
 						{ // ************* process real data states (leaves) *************
 							// This is the second easiest case, when both states are real data
 							// (i.e. no references). In this case, we are simply doing
 							// intersection of the data.
-							if (*lhsData != *rhsData)
+							if (lhsData != rhsData)
 							{	// if data don't match
 								break;        // cut this branch of the product
 							}
 						}
 						else if (lhsIsData && rhsIsData &&
-							lhsData->isRef() && rhsData->isRef())
+							lhsData.isRef() && rhsData.isRef())
 						{ // ************* process reference states (leaves) *************
 							// This is another quite easy case, when both states are
 							// references to another automata. In this case, we are jumping
 							// from both automata into another product automaton.
-							assert(lhsData->d_ref.displ == rhsData->d_ref.displ);
-							assert(0 == lhsData->d_ref.displ);
+							assert(lhsData.d_ref.displ == rhsData.d_ref.displ);
+							assert(0 == lhsData.d_ref.displ);
 
 							FA_NOTE("Two references");
 
-							const size_t& lhsNewRoot = lhsData->d_ref.root;
-							const size_t& rhsNewRoot = rhsData->d_ref.root;
+							const size_t& lhsNewRoot = lhsData.d_ref.root;
+							const size_t& rhsNewRoot = rhsData.d_ref.root;
 
 							const TreeAut* lhsNewTA = lhs.getRoot(lhsNewRoot).get();
 							const TreeAut* rhsNewTA = rhs.getRoot(rhsNewRoot).get();
@@ -1148,10 +1238,10 @@ void FAE::makeProduct(
 								lhsNewRoot, lhsNewTA->getFinalState(),
 								rhsNewRoot, rhsNewTA->getFinalState());
 						}
-						else if ((lhsIsData && !rhsIsData && lhsData->isNull())
-							|| (!lhsIsData && rhsIsData && rhsData->isNull())
-							|| (lhsIsData && rhsIsData && lhsData->isNull() && rhsData->isRef())
-							|| (lhsIsData && rhsIsData && lhsData->isRef()  && rhsData->isNull()))
+						else if ((lhsIsData && !rhsIsData && lhsData.isNull())
+							|| (!lhsIsData && rhsIsData && rhsData.isNull())
+							|| (lhsIsData && rhsIsData && lhsData.isNull() && rhsData.isRef())
+							|| (lhsIsData && rhsIsData && lhsData.isRef()  && rhsData.isNull()))
 						{ // ************* process NULL pointers *************
 							// This is the case when there is a NULL pointer and either an
 							// internal state or a reference
@@ -1159,17 +1249,17 @@ void FAE::makeProduct(
 
 							break;   // cut this branch of the product
 						}
-						else if ((lhsIsData && !rhsIsData && lhsData->isRef())
-							|| (!lhsIsData && rhsIsData && rhsData->isRef()))
+						else if ((lhsIsData && !rhsIsData && lhsData.isRef())
+							|| (!lhsIsData && rhsIsData && rhsData.isRef()))
 						{ // ************* process jumps *************
 							// This is the case when one FA jumps to another TA and the other does not
 							FA_NOTE("jump!");
 
 							if (lhsIsData)
 							{
-								assert(lhsIsData && !rhsIsData && lhsData->isRef());
+								assert(lhsIsData && !rhsIsData && lhsData.isRef());
 
-								const size_t& lhsNewRoot = lhsData->d_ref.root;
+								const size_t& lhsNewRoot = lhsData.d_ref.root;
 								const TreeAut* lhsNewTA  = lhs.getRoot(lhsNewRoot).get();
 								assert(nullptr != lhsNewTA);
 
@@ -1179,9 +1269,9 @@ void FAE::makeProduct(
 							}
 							else
 							{
-								assert(!lhsIsData && rhsIsData && rhsData->isRef());
+								assert(!lhsIsData && rhsIsData && rhsData.isRef());
 
-								const size_t& rhsNewRoot = rhsData->d_ref.root;
+								const size_t& rhsNewRoot = rhsData.d_ref.root;
 								const TreeAut* rhsNewTA  = rhs.getRoot(rhsNewRoot).get();
 								assert(nullptr != rhsNewTA);
 
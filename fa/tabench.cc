@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file tabench.cc
+ * A micro-benchmark of the tree automata kernels
+ *
+ * Usage: fa_tabench [-n <iterations>] <corpus.tim>...
+ *
+ * Reads all automata of the given Timbuk files (see @p TACorpus; a corpus of
+ * the automata of a real analysis is produced by the @p ta-dump:<file> option
+ * of the plug-in, i.e. by fagcc --dump-ta <file>) and runs every kernel on
+ * every automaton the given number of times. The minimisations memoised by
+ * the kernels (see FA_MINIMIZATION_CACHE_BYTES) are forgotten before every
+ * run, so that no run is answered from the cache. For every kernel, the time
+ * of the first run, the mean time of the other runs, the number of
+ * allocations per run and the size of the output are reported.
+ */
+
+// Standard library headers
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Forester headers
+#include "boxman.hh"
+#include "tacorpus.hh"
+#include "treeaut_label.hh"
+#include "utils.hh"
+
+namespace
+{
+/// the number of allocations so far
+std::atomic<size_t> allocCount(0);
+
+/// the number of allocated bytes so far
+std::atomic<size_t> allocBytes(0);
+
+/**
+ * @brief  Statistics of a kernel
+ */
+struct KernelStats
+{
+	/// the name of the kernel
+	std::string name;
+
+	/// the kernel, given an automaton and its minimised form (computed in
+	/// advance), returns the size of its output
+	std::function<size_t(const TreeAut&, const TreeAut&)> run;
+
+	/// the time of the first runs (on all automata)
+	double firstMs;
+
+	/// the total time of the other runs
+	double restMs;
+
+	/// the number of allocations of all runs
+	size_t allocs;
+
+	/// the number of allocated bytes of all runs
+	size_t bytes;
+
+	/// the total size of the outputs of the first runs
+	size_t output;
+
+	KernelStats(
+		const std::string&                                             name,
+		const std::function<size_t(const TreeAut&, const TreeAut&)>&   run) :
+		name(name),
+		run(run),
+		firstMs(0),
+		restMs(0),
+		allocs(0),
+		bytes(0),
+		output(0)
+	{ }
+};
+
+/**
+ * @brief  Runs a kernel on an automaton, updates its statistics
+ */
+void measure(
+	KernelStats&                   stats,
+	const TreeAut&                 ta,
+	const TreeAut&                 min,
+	size_t                         iterations)
+{
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		TreeAut::clearCaches();
+
+		const size_t count = allocCount;
+		const size_t bytes = allocBytes;
+		const auto start = std::chrono::steady_clock::now();
+
+		const size_t output = stats.run(ta, min);
+
+		const std::chrono::duration<double, std::milli> elapsed =
+			std::chrono::steady_clock::now() - start;
+
+		stats.allocs += allocCount - count;
+		stats.bytes += allocBytes - bytes;
+
+		if (0 == i)
+		{
+			stats.firstMs += elapsed.count();
+			stats.output += output;
+		} else
+		{
+			stats.restMs += elapsed.count();
+		}
+	}
+}
+
+int usage(const char* name)
+{
+	std::cerr << "usage: " << name << " [-n <iterations>] <corpus.tim>..."
+		<< std::endl;
+
+	return EXIT_FAILURE;
+}
+} // namespace
+
+void* operator new(size_t size)
+{
+	++allocCount;
+	allocBytes += size;
+
+	void* ptr = std::malloc(size ? size : 1);
+	if (nullptr == ptr)
+		throw std::bad_alloc();
+
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+int main(int argc, char* argv[])
+{
+	size_t iterations = 10;
+	std::vector<std::string> fileNames;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string arg = argv[i];
+		if ("-n" == arg)
+		{
+			if (++i == argc || 0 >= std::atoi(argv[i]))
+				return usage(argv[0]);
+
+			iterations = std::atoi(argv[i]);
+		} else
+		{
+			fileNames.push_back(arg);
+		}
+	}
+
+	if (fileNames.empty())
+		return usage(argv[0]);
+
+	BoxMan boxMan;
+	TreeAut::Backend backend;
+	TACorpus corpus;
+	std::vector<TreeAut> automata;
+	std::vector<std::string> names;
+
+	for (const std::string& fileName : fileNames)
+	{
+		std::ifstream is(fileName.c_str());
+		if (!is.good())
+		{
+			std::cerr << "unable to read " << fileName << std::endl;
+			return EXIT_FAILURE;
+		}
+
+		corpus.read(is, fileName, boxMan, backend, automata, names);
+	}
+
+	if (automata.empty())
+	{
+		std::cerr << "no automata to benchmark" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	size_t transitions = 0;
+	for (const TreeAut& ta : automata)
+		transitions += ta.getTransitions().size();
+
+	std::cout << "automata: " << automata.size() << ", transitions: "
+		<< transitions << ", iterations: " << iterations << std::endl;
+
+	std::vector<TreeAut> minimal;
+	for (const TreeAut& ta : automata)
+	{
+		TreeAut min(backend);
+		ta.minimized(min);
+		minimal.push_back(min);
+	}
+
+	std::vector<KernelStats> kernels;
+
+	kernels.push_back(KernelStats("reduce",
+		[&backend](const TreeAut& ta, const TreeAut&)
+	{
+		Index<size_t> index;
+		TreeAut dst(backend);
+		TreeAut::reduce(dst, ta, index);
+		return dst.getTransitions().size();
+	}));
+
+	kernels.push_back(KernelStats("downward (OLRT)",
+		[](const TreeAut& ta, const TreeAut&)
+	{
+		Index<size_t> stateIndex;
+		ta.buildSortedStateIndex(stateIndex);
+		BitMatrix dwn;
+		ta.downwardSimulation(dwn, stateIndex);
+		return dwn.rows();
+	}));
+
+	kernels.push_back(KernelStats("upward (OLRT)",
+		[](const TreeAut& ta, const TreeAut&)
+	{
+		Index<size_t> stateIndex;
+		ta.buildSortedStateIndex(stateIndex);
+		BitMatrix dwn;
+		ta.downwardSimulation(dwn, stateIndex);
+		BitMatrix up;
+		ta.upwardSimulation(up, stateIndex, dwn);
+		return up.rows();
+	}));
+
+	kernels.push_back(KernelStats("minimized",
+		[&backend](const TreeAut& ta, const TreeAut&)
+	{
+		TreeAut dst(backend);
+		ta.minimized(dst);
+		return dst.getTransitions().size();
+	}));
+
+	kernels.push_back(KernelStats("subseteq (antichain)",
+		[](const TreeAut& ta, const TreeAut& min)
+	{	// both directions of the inclusion with the minimised automaton
+		return static_cast<size_t>(TreeAut::subseteq(ta, min))
+			+ static_cast<size_t>(TreeAut::subseteq(min, ta));
+	}));
+
+	for (KernelStats& stats : kernels)
+	{
+		for (size_t i = 0; i < automata.size(); ++i)
+			measure(stats, automata[i], minimal[i], iterations);
+	}
+
+	const size_t runs = automata.size() * iterations;
+
+	std::cout << std::left << std::setw(24) << "kernel" << std::right
+		<< std::setw(12) << "first[ms]" << std::setw(12) << "mean[ms]"
+		<< std::setw(14) << "allocs/run" << std::setw(14) << "bytes/run"
+		<< std::setw(12) << "output" << std::endl;
+
+	for (const KernelStats& stats : kernels)
+	{
+		const double mean = (1 < iterations)
+			? stats.restMs / (automata.size() * (iterations - 1))
+			: stats.firstMs / automata.size();
+
+		std::cout << std::left << std::setw(24) << stats.name << std::right
+			<< std::fixed << std::setprecision(3)
+			<< std::setw(12) << stats.firstMs << std::setw(12) << mean
+			<< std::setw(14) << (runs ? stats.allocs / runs : 0)
+			<< std::setw(14) << (runs ? stats.bytes / runs : 0)
+			<< std::setw(12) << stats.output << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
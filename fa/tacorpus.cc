@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Standard library headers
+#include <sstream>
+
+// Forester headers
+#include "boxman.hh"
+#include "tacorpus.hh"
+#include "tatimint.hh"
+#include "types.hh"
+
+void TACorpus::add(
+	const TreeAut&                 ta,
+	const std::string&             name)
+{
+	automata_.push_back(std::make_pair(name, TA<std::string>(backend_)));
+	TA<std::string>& named = automata_.back().second;
+
+	for (const TT<label_type>& trans : ta)
+	{
+		auto itBoolPair = names_.insert(std::make_pair(trans.label(), ""));
+		if (itBoolPair.second)
+		{	// a new label
+			std::ostringstream ss;
+			ss << 'l' << names_.size() - 1;
+			itBoolPair.first->second = ss.str();
+			arities_.insert(std::make_pair(ss.str(), trans.lhs().size()));
+		}
+
+		named.addTransition(trans.lhs(), itBoolPair.first->second, trans.rhs());
+	}
+
+	for (size_t state : ta.getFinalStates())
+		named.addFinalState(state);
+}
+
+
+size_t TACorpus::write(
+	std::ostream&                  os) const
+{
+	TAWriter<std::string> writer(os);
+
+	// all automata share the alphabet
+	writer.startAlphabet();
+	for (const auto& nameArityPair : arities_)
+		writer.writeLabel(nameArityPair.first, nameArityPair.second);
+	writer.endl();
+
+	for (const auto& nameTAPair : automata_)
+	{
+		writer.endl();
+		writer.writeModel(nameTAPair.second, nameTAPair.first);
+	}
+
+	return automata_.size();
+}
+
+
+size_t TACorpus::read(
+	std::istream&                  is,
+	const std::string&             fileName,
+	BoxMan&                        boxMan,
+	TreeAut::Backend&              backend,
+	std::vector<TreeAut>&          dst,
+	std::vector<std::string>&      names)
+{
+	TA<std::string>::Backend namedBackend;
+	TAMultiReader reader(namedBackend, is, fileName);
+	reader.read();
+
+	for (size_t i = 0; i < reader.automata.size(); ++i)
+	{
+		dst.push_back(TreeAut(backend));
+		names.push_back(reader.names[i]);
+
+		const TA<std::string>& named = reader.automata[i];
+		for (const TT<std::string>& trans : named)
+		{
+			auto itBoolPair = ids_.insert(
+				std::make_pair(trans.label(), static_cast<int>(ids_.size())));
+
+			const label_type label = boxMan.lookupLabel(trans.lhs().size(),
+				DataArray(1, Data::createInt(itBoolPair.first->second)));
+
+			dst.back().addTransition(trans.lhs(), label, trans.rhs());
+		}
+
+		for (size_t state : named.getFinalStates())
+			dst.back().addFinalState(state);
+	}
+
+	return reader.automata.size();
+}
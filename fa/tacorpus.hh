@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TA_CORPUS_H
+#define TA_CORPUS_H
+
+/**
+ * @file tacorpus.hh
+ * TACorpus - a corpus of tree automata in the Timbuk format
+ */
+
+// Standard library headers
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Forester headers
+#include "treeaut_label.hh"
+
+class BoxMan;
+
+/**
+ * @brief  A corpus of tree automata in the Timbuk format
+ *
+ * The labels of the automata of an analysis (nodes with boxes and selectors,
+ * data) cannot be parsed back from their textual form, therefore the corpus
+ * names every label @p l<n> instead (consistently over all its automata). When
+ * a corpus is read, every label name is interned as a distinct data label of
+ * a @p BoxMan, which is all that the automata kernels (simulations,
+ * minimisation, inclusion) need as they only compare labels.
+ */
+class TACorpus
+{
+private:  // data members
+
+	/// the backend of the named automata
+	TA<std::string>::Backend backend_;
+
+	/// the added automata (with their names) over the label names
+	std::vector<std::pair<std::string, TA<std::string>>> automata_;
+
+	/// the names of the labels of the added automata
+	std::unordered_map<label_type, std::string> names_;
+
+	/// the arities of the label names
+	std::map<std::string, size_t> arities_;
+
+	/// the identifiers of the label names of the read automata
+	std::unordered_map<std::string, int> ids_;
+
+private:  // methods
+
+	TACorpus(const TACorpus&);
+	TACorpus& operator=(const TACorpus&);
+
+public:   // methods
+
+	TACorpus() :
+		backend_{},
+		automata_{},
+		names_{},
+		arities_{},
+		ids_{}
+	{ }
+
+	/**
+	 * @brief  Adds an automaton to the corpus
+	 *
+	 * @param[in]  ta    The automaton to be added
+	 * @param[in]  name  The name of the automaton
+	 */
+	void add(
+		const TreeAut&                 ta,
+		const std::string&             name);
+
+
+	/**
+	 * @brief  Writes all added automata
+	 *
+	 * @param[out]  os  The output stream
+	 *
+	 * @returns  The number of written automata
+	 */
+	size_t write(
+		std::ostream&                  os) const;
+
+
+	/**
+	 * @brief  Reads all automata of a corpus
+	 *
+	 * @param[in]      is        The input stream
+	 * @param[in]      fileName  The name of the input (for error messages)
+	 * @param[in,out]  boxMan    The box manager to intern the labels
+	 * @param[in]      backend   The backend of the read automata
+	 * @param[out]     dst       The read automata (appended)
+	 * @param[out]     names     The names of the read automata (appended)
+	 *
+	 * @returns  The number of read automata
+	 */
+	size_t read(
+		std::istream&                  is,
+		const std::string&             fileName,
+		BoxMan&                        boxMan,
+		TreeAut::Backend&              backend,
+		std::vector<TreeAut>&          dst,
+		std::vector<std::string>&      names);
+};
+
+#endif
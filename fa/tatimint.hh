@@ -216,19 +216,31 @@ public:
 	void writeOne(const TA<T>& aut, const std::string& name = "TreeAutomaton")
 	{
 		std::map<std::string, size_t> labels;
-		std::set<size_t> states;
 		for (typename TA<T>::iterator i = aut.begin(); i != aut.end(); ++i) {
 			std::ostringstream ss;
 			ss << i->label();
 			labels.insert(std::make_pair(ss.str(), i->lhs().size()));
-			states.insert(i->rhs());
-			for (size_t j = 0; j < i->lhs().size(); ++j)
-				states.insert(i->lhs()[j]);
 		}
 		this->startAlphabet();
 		for (std::map<std::string, size_t>::iterator i = labels.begin(); i != labels.end(); ++i)
 			this->writeLabel(i->first, i->second);
 		this->endl();
+		this->writeModel(aut, name);
+	}
+
+	/**
+	 * @brief  Writes an automaton without the alphabet
+	 *
+	 * Allows to write several automata over a common alphabet into one file.
+	 */
+	void writeModel(const TA<T>& aut, const std::string& name = "TreeAutomaton")
+	{
+		std::set<size_t> states;
+		for (typename TA<T>::iterator i = aut.begin(); i != aut.end(); ++i) {
+			states.insert(i->rhs());
+			for (size_t j = 0; j < i->lhs().size(); ++j)
+				states.insert(i->lhs()[j]);
+		}
 		this->newModel(name);
 		this->endl();
 		this->startStates();
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file boundedcache.cc
+ * Checks that BoundedCache drops the least recently used entries only, and
+ * only as many of them as needed to keep their total weight bounded.
+ */
+
+// Standard library headers
+#include <string>
+
+// Forester headers
+#include "../boundedcache.hh"
+#include "testutils.hh"
+
+namespace
+{
+/**
+ * @brief  Weighs an entry by the length of its value
+ */
+struct Length
+{
+	size_t operator()(int, const std::string& value) const
+	{
+		return value.size();
+	}
+};
+} // namespace
+
+int main()
+{
+	BoundedCache<int, std::string> cache(3);
+
+	cache.insert(1, "one");
+	cache.insert(2, "two");
+	cache.insert(3, "three");
+	CHECK(3 == cache.size());
+
+	// 1 becomes the most recently used entry, 2 is dropped then
+	CHECK(cache.find(1) && ("one" == *cache.find(1)));
+	cache.insert(4, "four");
+	CHECK(3 == cache.size());
+	CHECK(!cache.find(2));
+	CHECK(cache.find(1) && cache.find(3) && cache.find(4));
+
+	// replacing a value does not drop anything
+	cache.insert(3, "drei");
+	CHECK(3 == cache.size());
+	CHECK("drei" == *cache.find(3));
+
+	// lookup() creates a default value, which drops the oldest entry (1)
+	CHECK(cache.lookup(5).empty());
+	CHECK(3 == cache.size());
+	CHECK(!cache.find(1));
+
+	// a lot of insertions never exceed the capacity
+	for (int i = 0; i < 1000; ++i)
+		cache.lookup(i % 7) += "x";
+
+	CHECK(3 == cache.size());
+
+	cache.clear();
+	CHECK(0 == cache.size());
+	CHECK(!cache.find(6));
+
+	// at most 10 characters are kept
+	BoundedCache<int, std::string, std::hash<int>, Length> weighted(10);
+	weighted.insert(1, "aaaa");
+	weighted.insert(2, "bbbb");
+	CHECK(8 == weighted.weight());
+
+	// 3 fits exactly, 4 does not and drops 1
+	weighted.insert(3, "cc");
+	CHECK((3 == weighted.size()) && (10 == weighted.weight()));
+	weighted.insert(4, "d");
+	CHECK(!weighted.find(1) && weighted.find(2) && weighted.find(3));
+	CHECK(7 == weighted.weight());
+
+	// a value grown in place drops the least recently used entries (4, 3)
+	weighted.find(2)->append("bbbbb");
+	weighted.reweigh(2);
+	CHECK(1 == weighted.size());
+	CHECK(9 == weighted.weight());
+
+	// an entry heavier than the capacity is kept alone
+	weighted.insert(5, "eeeeeeeeeeee");
+	CHECK(1 == weighted.size());
+	CHECK(weighted.find(5) && (12 == weighted.weight()));
+	weighted.insert(6, "f");
+	CHECK(!weighted.find(5) && (1 == weighted.weight()));
+
+	return EXIT_SUCCESS;
+}
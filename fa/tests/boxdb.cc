@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file boxdb.cc
+ * Checks that boxes stored by BoxDb::save() are loaded back by BoxDb::load()
+ * unchanged, that boxes of types with a different layout are skipped, and
+ * that huge counts in a corrupted database are reported as truncation.
+ */
+
+// Standard library headers
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// POSIX headers
+#include <unistd.h>
+
+// Forester headers
+#include "../boxdb.hh"
+#include "../boxman.hh"
+#include "testutils.hh"
+
+namespace
+{
+const size_t NEXT = 0;
+const size_t PREV = 8;
+
+/**
+ * @brief  Makes @p boxMan learn a box of a list node pointing to a cutpoint
+ *
+ * The box consists of a single node of the type @p D whose @p next selector
+ * refers to the only cutpoint and whose @p prev selector is undefined.
+ */
+void learnBox(BoxMan& boxMan, TreeAut::Backend& backend)
+{
+	const TypeBox* type = boxMan.createTypeInfo("D", {NEXT, PREV});
+	const std::vector<SelData> sels = {
+		SelData(NEXT, 8, 0, "next"),
+		SelData(PREV, 8, 0, "prev")
+	};
+
+	std::shared_ptr<TreeAut> ta(new TreeAut(backend));
+	ta->addTransition(std::vector<size_t>(),
+		boxMan.lookupLabel(Data::createRef(1)), 0);
+	ta->addTransition(std::vector<size_t>(),
+		boxMan.lookupLabel(Data::createUndef()), 1);
+	ta->addTransition(std::vector<size_t>({0, 1}),
+		nodeLabel(boxMan, type, sels), 2);
+	ta->addFinalState(2);
+
+	ConnectionGraph::StateToCutpointSignatureMap stateMap;
+	ConnectionGraph::computeSignatures(stateMap, *ta);
+
+	std::unique_ptr<Box> box(BoxMan::createType1Box(
+		/* root */ 0, ta, stateMap[2], /* inputMap */ {NEXT}, /* index */ {0, 1}));
+	boxMan.loadBox(*box);
+}
+
+std::string readFile(const std::string& fileName)
+{
+	std::ifstream is(fileName.c_str(), std::ios::binary);
+	return std::string(std::istreambuf_iterator<char>(is),
+		std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& fileName, const std::string& contents)
+{
+	std::ofstream os(fileName.c_str(), std::ios::binary | std::ios::trunc);
+	os << contents;
+}
+} // namespace
+
+int main()
+{
+	const std::string fileName =
+		"fa_test_boxdb." + std::to_string(getpid()) + ".db";
+	const std::string copyName = fileName + ".copy";
+
+	TreeAut::Backend backend;
+
+	{
+		BoxMan boxMan;
+		learnBox(boxMan, backend);
+		CHECK(1 == boxMan.boxCount());
+		CHECK(1 == BoxDb::save(fileName, boxMan));
+	}
+
+	{	// the same layout, the box is loaded and stored back unchanged
+		BoxMan boxMan;
+		boxMan.createTypeInfo("D", {NEXT, PREV});
+		CHECK(1 == BoxDb::load(fileName, boxMan, backend));
+		CHECK(1 == boxMan.boxCount());
+		CHECK(1 == BoxDb::save(copyName, boxMan));
+		CHECK(readFile(fileName) == readFile(copyName));
+
+		// loading the same box again does not add anything
+		BoxDb::load(fileName, boxMan, backend);
+		CHECK(1 == boxMan.boxCount());
+	}
+
+	{	// the type has changed its layout, the box is skipped
+		BoxMan boxMan;
+		boxMan.createTypeInfo("D", {NEXT, 16});
+		CHECK(0 == BoxDb::load(fileName, boxMan, backend));
+		CHECK(0 == boxMan.boxCount());
+	}
+
+	{	// the type is not declared at all, the box is skipped
+		BoxMan boxMan;
+		CHECK(0 == BoxDb::load(fileName, boxMan, backend));
+		CHECK(0 == boxMan.boxCount());
+	}
+
+	{	// a huge count of selectors of the type fails as a truncated database
+		std::string contents = readFile(fileName);
+		const std::string name("\x01\0\0\0\0\0\0\0" "D", sizeof(uint64_t) + 1);
+		const size_t pos = contents.find(name);
+		CHECK(std::string::npos != pos);
+		contents.replace(pos + name.size(), sizeof(uint64_t), sizeof(uint64_t), '\x7f');
+		writeFile(copyName, contents);
+
+		BoxMan boxMan;
+		boxMan.createTypeInfo("D", {NEXT, PREV});
+		bool truncated = false;
+		try
+		{
+			BoxDb::load(copyName, boxMan, backend);
+		}
+		catch (const std::runtime_error&)
+		{
+			truncated = true;
+		}
+
+		CHECK(truncated);
+	}
+
+	std::remove(fileName.c_str());
+	std::remove(copyName.c_str());
+
+	{	// a missing file is an empty database
+		BoxMan boxMan;
+		CHECK(0 == BoxDb::load(fileName, boxMan, backend));
+	}
+
+	return EXIT_SUCCESS;
+}
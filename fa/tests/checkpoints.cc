@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file checkpoints.cc
+ * Runs a program that leaks memory with the forest automata dropped from the
+ * states between checkpoints and checks that the automata recomputed for the
+ * trace of the error are the same as the ones the states were executed with.
+ */
+
+// Standard library headers
+#include <cassert>
+#include <unordered_map>
+#include <vector>
+
+// Forester headers
+#include "../programerror.hh"
+#include "listprogram.hh"
+#include "testutils.hh"
+
+namespace
+{
+/**
+ * @brief  The trace of the error found by a single run of the program
+ */
+struct Result
+{
+	/// the digests of the automata of the trace (from the error state) when
+	/// the states were executed
+	std::vector<size_t> executed;
+
+	/// the digests of the automata of the trace after restoring it
+	std::vector<size_t> restored;
+
+	/// the number of the states of the trace that dropped their automata
+	size_t dropped;
+};
+
+/**
+ * @brief  Builds and runs the list program keeping every @p interval-th
+ *         automaton
+ *
+ * After the loop, the program loses the list (head = NULL), so the check for
+ * garbage fails once the list is not empty.
+ */
+Result run(ListContext& ctx, size_t interval)
+{
+	ListProgram prog(ctx);
+
+	// head = NULL after the loop, and the check for garbage
+	prog.build(prog.sequence({
+		new FI_get_greg(nullptr, 1, GLOB_INDEX),
+		new FI_load_cst(nullptr, 2, Data::createInt(0)),
+		new FI_store(nullptr, 1, 2, 0),
+		new FI_load_cst(nullptr, 1, Data::createUndef()),
+		new FI_check(nullptr),
+		new FI_abort(nullptr)
+	}, nullptr));
+
+	// the digests of the automata of the states at the time of their execution
+	std::unordered_map<const SymState*, size_t> executed;
+
+	Result result = { {}, {}, 0 };
+	ExecutionManager execMan;
+	execMan.setCheckpointInterval(interval);
+	try
+	{
+		prog.run(execMan, [&execMan, &executed](SymState& state) {
+			// the states are recycled, the last record of a state is its own
+			executed[&state] = SymState::digest(*state.GetFAE());
+			execMan.execute(state);
+		});
+	}
+	catch (ProgramError& e)
+	{
+		const SymState::Trace trace = e.state()->getTrace();
+		for (const SymState* state : trace)
+			result.dropped += (nullptr == state->GetFAE());
+
+		execMan.restoreTrace(trace);
+		for (const SymState* state : trace)
+		{
+			assert(nullptr != state->GetFAE());
+			result.executed.push_back(executed.at(state));
+			result.restored.push_back(SymState::digest(*state->GetFAE()));
+		}
+	}
+
+	execMan.clear();
+	return result;
+}
+} // namespace
+
+int main()
+{
+	ListContext ctx;
+
+	for (size_t interval : { 0, 1, 2, 3, 5 })
+	{
+		const Result result = run(ctx, interval);
+		CHECK(!result.executed.empty());
+
+		// every state is a checkpoint for the interval of 1
+		CHECK((1 < interval) == (0 < result.dropped));
+		CHECK(result.executed == result.restored);
+	}
+
+	return EXIT_SUCCESS;
+}
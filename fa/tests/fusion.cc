@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file fusion.cc
+ * Runs a sequence of register assignments with and without fusing it and
+ * checks that the fused instruction drops the dead writes only, that it ends
+ * before a jump target, and that the runs end with the same registers.
+ */
+
+// Standard library headers
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+#include "../comparison.hh"
+#include "../compiler.hh"
+#include "../executionmanager.hh"
+#include "../forestautext.hh"
+#include "../microcode.hh"
+#include "../programerror.hh"
+#include "testutils.hh"
+
+namespace
+{
+/// the number of registers of the program
+const size_t REG_COUNT = 9;
+
+/// the register with the branch taken
+const size_t COND_REG = 8;
+
+/**
+ * @brief  The program and the instructions the checks refer to
+ */
+struct Program
+{
+	Compiler::Assembly assembly;
+
+	/// the target of the branch taken, it is not fused
+	AbstractInstruction* entry;
+
+	/// the assignments of the sequence to be fused (in this order)
+	std::vector<AbstractInstruction*> seq;
+
+	/// the jump target that follows the sequence
+	AbstractInstruction* target;
+
+	/// the end of both branches
+	AbstractInstruction* abort;
+};
+
+/**
+ * @brief  Builds the program, the sequence dereferences a valid reference
+ *         if @p validRef is set
+ *
+ *   r0 = unknown; r8 = (r0 == r0); if (r8) {
+ *     r1 = ref or 0;   // the target of the branch taken
+ *     r2 = 5;          // dead, r2 is overwritten before being read
+ *     r3 = 7;          // read before it is overwritten
+ *     r2 = 6;
+ *     r4 = r3;
+ *     r3 = 8;
+ *     r5 = r1 + 8;     // overwritten, but it may fail
+ *     r5 = 1;
+ *   }
+ *   r6 = 9;            // the target of the branch not taken
+ *   r7 = r6;
+ *   abort;
+ */
+void build(Program& prog, bool validRef)
+{
+	Compiler::Assembly::CodeList& code = prog.assembly.code_;
+
+	prog.entry = new FI_load_cst(nullptr, 1,
+		validRef ? Data::createRef(0) : Data::createInt(0));
+
+	prog.seq = {
+		new FI_load_cst(nullptr, 2, Data::createInt(5)),
+		new FI_load_cst(nullptr, 3, Data::createInt(7)),
+		new FI_load_cst(nullptr, 2, Data::createInt(6)),
+		new FI_move_reg(nullptr, 4, 3),
+		new FI_load_cst(nullptr, 3, Data::createInt(8)),
+		new FI_move_reg_offs(nullptr, 5, 1, 8),
+		new FI_load_cst(nullptr, 5, Data::createInt(1))
+	};
+
+	prog.target = new FI_load_cst(nullptr, 6, Data::createInt(9));
+	prog.abort = new FI_abort(nullptr);
+
+	AbstractInstruction* next[2] = { prog.entry, prog.target };
+	code.push_back(new FI_load_cst(nullptr, 0, Data::createUnknw()));
+	code.push_back(new FI_eq(nullptr, COND_REG, 0, 0));
+	code.push_back(new FI_cond(nullptr, COND_REG, next));
+	code.push_back(prog.entry);
+	code.insert(code.end(), prog.seq.begin(), prog.seq.end());
+	code.push_back(prog.target);
+	code.push_back(new FI_move_reg(nullptr, 7, 6));
+	code.push_back(prog.abort);
+
+	const std::unordered_map<const CodeStorage::Block*, AbstractInstruction*>
+		codeIndex;
+	for (auto i = code.cbegin(); i != code.cend(); ++i)
+		(*i)->finalize(codeIndex, i);
+}
+
+/**
+ * @brief  The outcome of a single run of the program
+ */
+struct Result
+{
+	/// the registers at the end of the branch taken and of the one not taken
+	std::vector<Data> regs[2];
+
+	/// the number of the executed states
+	size_t executed;
+};
+
+/**
+ * @brief  Runs the program from its first instruction
+ */
+Result run(const Program& prog, TreeAut::Backend& backend, BoxMan& boxMan)
+{
+	Result result = { {}, 0 };
+	ExecutionManager execMan(1);
+	execMan.schedule(
+		RegisterFile(DataArray(REG_COUNT, Data::createUndef())),
+		std::shared_ptr<FAE>(new FAE(backend, boxMan)),
+		prog.assembly.code_.front());
+
+	execMan.run([&execMan, &prog, &result](SymState& state) {
+		++result.executed;
+		if (state.GetInstr() == prog.abort)
+		{
+			std::vector<Data>& regs = result.regs[!state.GetReg(COND_REG).d_bool];
+			for (size_t i = 0; i < state.GetRegCount(); ++i)
+				regs.push_back(state.GetReg(i));
+		}
+
+		execMan.execute(state);
+	});
+
+	execMan.clear();
+	return result;
+}
+
+/**
+ * @brief  Runs the program and reports whether it failed
+ */
+bool fails(const Program& prog, TreeAut::Backend& backend, BoxMan& boxMan)
+{
+	try
+	{
+		run(prog, backend, boxMan);
+	}
+	catch (ProgramError&)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief  Prints the fused instruction expected for the members of
+ *         @p seq at the indices @p body
+ */
+std::string fusedOf(
+	const std::vector<AbstractInstruction*>&   seq,
+	const std::vector<size_t>&                 body)
+{
+	std::ostringstream os;
+	os << "fused \t{ ";
+	for (size_t i : body)
+	{
+		if (i != body.front())
+			os << "; ";
+
+		os << *seq[i];
+	}
+
+	os << " }";
+	return os.str();
+}
+} // namespace
+
+int main()
+{
+	TreeAut::Backend backend;
+	BoxMan boxMan;
+
+	Program plain, fused;
+	build(plain, true);
+	build(fused, true);
+	Compiler::fuse(fused.assembly);
+
+	// the sequence is the only one fused, its first member stays in the code
+	// for the predecessors that are not redirected
+	std::vector<FI_fused*> fusedInstrs;
+	for (AbstractInstruction* instr : fused.assembly.code_)
+	{
+		if (FI_fused* fusedInstr = dynamic_cast<FI_fused*>(instr))
+			fusedInstrs.push_back(fusedInstr);
+	}
+
+	CHECK(1 == fusedInstrs.size());
+	CHECK(plain.assembly.code_.size() + 1 == fused.assembly.code_.size());
+
+	// the dead write is dropped, the one read before it is overwritten and the
+	// one that may fail are kept
+	std::ostringstream os;
+	os << *fusedInstrs.front();
+	CHECK(fusedOf(fused.seq, {1, 2, 3, 4, 5, 6}) == os.str());
+
+	// the sequence starts after the branch target and ends before the jump
+	// target, its predecessor enters the fused instruction
+	const SequentialInstruction* entry =
+		dynamic_cast<SequentialInstruction*>(fused.entry);
+	CHECK(fusedInstrs.front() == entry->next());
+	CHECK(fused.target == fusedInstrs.front()->next());
+
+	// both runs end with the same registers, the fused run executes a single
+	// state for the sequence
+	const Result plainResult = run(plain, backend, boxMan);
+	const Result fusedResult = run(fused, backend, boxMan);
+	for (size_t i : { 0, 1 })
+	{
+		CHECK(REG_COUNT == plainResult.regs[i].size());
+		CHECK(plainResult.regs[i] == fusedResult.regs[i]);
+	}
+
+	CHECK(plainResult.regs[0][4] == Data::createInt(7));
+	CHECK(plainResult.executed == fusedResult.executed + fused.seq.size() - 1);
+
+	// the failing assignment is not dropped from the fused instruction
+	Program plainFail, fusedFail;
+	build(plainFail, false);
+	build(fusedFail, false);
+	Compiler::fuse(fusedFail.assembly);
+	CHECK(fails(plainFail, backend, boxMan));
+	CHECK(fails(fusedFail, backend, boxMan));
+
+	return EXIT_SUCCESS;
+}
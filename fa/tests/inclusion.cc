@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file inclusion.cc
+ * Checks the language inclusion of tree automata pruned by simulations
+ * against the inclusion decided by the subset construction, on randomly
+ * generated automata.
+ */
+
+// Standard library headers
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+#include "../treeaut.hh"
+#include "testutils.hh"
+
+namespace
+{
+typedef std::set<size_t> StateSet;
+
+/// the states of both automata reached by a single tree
+typedef std::pair<StateSet, StateSet> MacroState;
+
+/**
+ * @brief  The states of @p ta reached by a tree with the given subtrees
+ */
+StateSet post(
+	const TreeAut&                    ta,
+	label_type                        label,
+	const std::vector<StateSet>&      sub)
+{
+	StateSet res;
+	for (const TreeAut::TransIDPair* trans : ta.getTransitions())
+	{
+		if ((trans->first.label() != label) || (trans->first.lhs().size() != sub.size()))
+			continue;
+
+		bool reached = true;
+		for (size_t i = 0; reached && (i < sub.size()); ++i)
+			reached = sub[i].count(trans->first.lhs()[i]);
+
+		if (reached)
+			res.insert(trans->first.rhs());
+	}
+
+	return res;
+}
+
+/**
+ * @brief  Moves to the next tuple of numbers below @p bound
+ *
+ * @returns  @p false once all tuples have been visited
+ */
+bool nextTuple(std::vector<size_t>& tuple, size_t bound)
+{
+	for (size_t& i : tuple)
+	{
+		if (++i < bound)
+			return true;
+
+		i = 0;
+	}
+
+	return false;
+}
+
+bool isAccepting(const TreeAut& ta, const StateSet& states)
+{
+	for (size_t state : states)
+	{
+		if (ta.isFinalState(state))
+			return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief  Decides the inclusion of the languages of @p a in @p b naively
+ *
+ * The pairs of sets of states reached by the same tree in @p a and @p b are
+ * saturated, the languages are included unless some tree is accepted by @p a
+ * only.
+ */
+bool naiveSubseteq(
+	const TreeAut&                                    a,
+	const TreeAut&                                    b,
+	const std::vector<std::pair<label_type, size_t>>& labels)
+{
+	std::set<MacroState> reached;
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		const std::vector<MacroState> known(reached.begin(), reached.end());
+		for (const std::pair<label_type, size_t>& label : labels)
+		{
+			if ((0 < label.second) && known.empty())
+				continue;
+
+			// all tuples of the known pairs of the arity of the label
+			std::vector<size_t> tuple(label.second, 0);
+			do
+			{
+				std::vector<StateSet> subA, subB;
+				for (size_t i : tuple)
+				{
+					subA.push_back(known[i].first);
+					subB.push_back(known[i].second);
+				}
+
+				const MacroState next(post(a, label.first, subA), post(b, label.first, subB));
+				if (next.first.empty())
+					continue;
+
+				if (isAccepting(a, next.first) && !isAccepting(b, next.second))
+					return false;
+
+				changed = reached.insert(next).second || changed;
+			} while (nextTuple(tuple, known.size()));
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief  Generates an automaton over the states @p 0 ... @p states - 1
+ */
+void randomTA(
+	TreeAut&                                          ta,
+	std::mt19937&                                     rng,
+	const std::vector<std::pair<label_type, size_t>>& labels,
+	size_t                                            states)
+{
+	for (const std::pair<label_type, size_t>& label : labels)
+	{
+		std::vector<size_t> lhs(label.second, 0);
+		do
+		{
+			for (size_t rhs = 0; rhs < states; ++rhs)
+			{
+				if (0 == rng() % (2 + 2 * label.second))
+					ta.addTransition(lhs, label.first, rhs);
+			}
+		} while (nextTuple(lhs, states));
+	}
+
+	ta.addFinalState(rng() % states);
+	if (0 == rng() % 2)
+		ta.addFinalState(rng() % states);
+}
+} // namespace
+
+int main()
+{
+	TreeAut::Backend backend;
+	BoxMan boxMan;
+	boxMan.createTypeInfo("T", {0});
+	boxMan.createTypeInfo("U", {0, 8});
+
+	const TypeBox* typeT = boxMan.getTypeInfo("T");
+	const TypeBox* typeU = boxMan.getTypeInfo("U");
+	const SelData next(0, 8, 0, "next");
+	const SelData prev(8, 8, 0, "prev");
+
+	// labels with their arities
+	const std::vector<std::pair<label_type, size_t>> labels = {
+		std::make_pair(boxMan.lookupLabel(Data::createInt(0)), 0),
+		std::make_pair(boxMan.lookupLabel(Data::createInt(1)), 0),
+		std::make_pair(nodeLabel(boxMan, typeT, {next}), 1),
+		std::make_pair(nodeLabel(boxMan, typeU, {next, prev}), 2)
+	};
+
+	{	// the final states of the left-hand side count
+		TreeAut a(backend), b(backend);
+		a.addTransition(std::vector<size_t>(), labels[0].first, 1);
+		a.addFinalState(1);
+		b.addTransition(std::vector<size_t>(), labels[0].first, 1);
+		b.addTransition(std::vector<size_t>(), labels[1].first, 2);
+		b.addFinalState(2);
+		CHECK(!TreeAut::subseteq(a, b));
+		CHECK(TreeAut::subseteq(a, a));
+	}
+
+	std::mt19937 rng(42);
+	size_t included = 0;
+	for (size_t i = 0; i < 300; ++i)
+	{
+		TreeAut rawA(backend), rawB(backend), tmp(backend);
+		randomTA(rawA, rng, labels, 2 + i % 3);
+		randomTA(rawB, rng, labels, 2 + (i / 3) % 3);
+
+		// an inclusion is never reported when it does not hold
+		CHECK(!TreeAut::subseteq(rawA, rawB) || naiveSubseteq(rawA, rawB, labels));
+		CHECK(!TreeAut::subseteq(rawB, rawA) || naiveSubseteq(rawB, rawA, labels));
+
+		// the check gives up on a transition of the left-hand side with no
+		// counterpart on the right one even if it leads nowhere, it is exact on
+		// automata without useless states only
+		TreeAut a(backend), b(backend), renamedA(backend);
+		rawA.uselessFree(tmp).unreachableFree(a);
+		tmp.clear();
+		rawB.uselessFree(tmp).unreachableFree(b);
+
+		const bool expected = naiveSubseteq(a, b, labels);
+		included += expected;
+
+		CHECK(expected == TreeAut::subseteq(a, b));
+		CHECK(naiveSubseteq(b, a, labels) == TreeAut::subseteq(b, a));
+		CHECK(TreeAut::subseteq(a, a));
+
+		// the same right-hand side, and simulations cached for a renamed union
+		std::vector<size_t> lhs;
+		for (const TreeAut::TransIDPair* trans : a.getTransitions())
+		{
+			lhs.clear();
+			for (size_t state : trans->first.lhs())
+				lhs.push_back(state + 7);
+
+			renamedA.addTransition(lhs, trans->first.label(), trans->first.rhs() + 7);
+		}
+
+		for (size_t state : a.getFinalStates())
+			renamedA.addFinalState(state + 7);
+
+		CHECK(expected == TreeAut::subseteq(a, b));
+		CHECK(expected == TreeAut::subseteq(renamedA, b));
+	}
+
+	// both answers have been checked
+	CHECK((0 < included) && (included < 300));
+
+	return EXIT_SUCCESS;
+}
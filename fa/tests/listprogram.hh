@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FA_TESTS_LISTPROGRAM_H
+#define FA_TESTS_LISTPROGRAM_H
+
+/**
+ * @file listprogram.hh
+ * The microcode program building a list in a loop, which is shared by the
+ * unit tests that run whole programs.
+ */
+
+// Standard library headers
+#include <memory>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+#include "../comparison.hh"
+#include "../executionmanager.hh"
+#include "../fixpoint.hh"
+#include "../forestautext.hh"
+#include "../microcode.hh"
+#include "../regdef.hh"
+#include "../restart_request.hh"
+#include "../symctx.hh"
+
+/**
+ * @brief  The data shared by the runs of a program
+ *
+ * The boxes learnt by a run are kept for the next ones.
+ */
+struct ListContext
+{
+	TreeAut::Backend taBackend;
+	TreeAut::Backend fixpointBackend;
+	BoxMan boxMan;
+
+	ListContext() :
+		taBackend{},
+		fixpointBackend{},
+		boxMan{}
+	{
+		boxMan.createTypeInfo(GLOBAL_VARS_BLOCK_STR, {0});
+		boxMan.createTypeInfo("frame", {0});
+		boxMan.createTypeInfo("item", {0});
+	}
+};
+
+/**
+ * @brief  A program that prepends nodes to a list pointed to by a global
+ *         variable while an unknown value says so
+ *
+ *   head = NULL;
+ *   while (*) { n = malloc(); n->next = head; head = n; }
+ *   exit
+ *
+ * The code of the exit is given by the test. It may use the registers @p r1,
+ * @p r2 and @p r4, the register @p r3 holds the unknown value.
+ */
+class ListProgram
+{
+public:   // constants
+
+	/// the number of registers of the program
+	static const size_t REG_COUNT = 7;
+
+private:  // data members
+
+	ListContext& ctx_;
+
+	std::vector<std::unique_ptr<AbstractInstruction>> code_;
+
+	/// the fixpoint at the loop head
+	FI_abs* abs_;
+
+	/// the first instruction of the program
+	AbstractInstruction* entry_;
+
+private:  // methods
+
+	ListProgram(const ListProgram&);
+	ListProgram& operator=(const ListProgram&);
+
+public:   // methods
+
+	explicit ListProgram(ListContext& ctx) :
+		ctx_(ctx),
+		code_{},
+		abs_{},
+		entry_{}
+	{ }
+
+	/**
+	 * @brief  Takes the ownership of @p instr
+	 */
+	AbstractInstruction* own(AbstractInstruction* instr)
+	{
+		code_.push_back(std::unique_ptr<AbstractInstruction>(instr));
+		return instr;
+	}
+
+	/**
+	 * @brief  Links a sequence of instructions followed by @p next
+	 *
+	 * @returns  The first instruction of the sequence
+	 */
+	AbstractInstruction* sequence(
+		const std::vector<SequentialInstruction*>&   instrs,
+		AbstractInstruction*                         next)
+	{
+		for (size_t i = 0; i < instrs.size(); ++i)
+		{
+			own(instrs[i]);
+			instrs[i]->next((i + 1 < instrs.size()) ? instrs[i + 1] : next);
+		}
+
+		return instrs.front();
+	}
+
+	/**
+	 * @brief  Builds the loop and the code before it, the loop is left to
+	 *         @p exit
+	 */
+	void build(AbstractInstruction* exit)
+	{
+		BoxMan& boxMan = ctx_.boxMan;
+
+		const std::vector<SelData> globSels = { SelData(0, 8, 0, "head") };
+		const std::vector<SelData> frameSels = { SelData(0, 8, 0, "ret") };
+		const std::vector<SelData> itemSels = {
+			SelData(0, 8, 0, "next"),
+			SelData(8, 8, 0, "data")
+		};
+
+		// the loop, the body returns to the fixpoint
+		abs_ = new FI_abs(nullptr, ctx_.fixpointBackend, ctx_.taBackend, boxMan);
+		AbstractInstruction* body = sequence({
+			new FI_load_cst(nullptr, 5, Data::createVoidPtr(16)),
+			new FI_node_create(nullptr, 5, 5, 16, boxMan.getTypeInfo("item"), itemSels),
+			new FI_get_greg(nullptr, 1, GLOB_INDEX),
+			new FI_load(nullptr, 6, 1, 0),
+			new FI_store(nullptr, 5, 6, 0),
+			new FI_store(nullptr, 1, 5, 0),
+			new FI_load_cst(nullptr, 1, Data::createUndef()),
+			new FI_load_cst(nullptr, 5, Data::createUndef()),
+			new FI_load_cst(nullptr, 6, Data::createUndef())
+		}, abs_);
+
+		AbstractInstruction* loopNext[2] = { body, exit };
+		sequence({
+			abs_,
+			new FI_eq(nullptr, 4, 3, 3)
+		}, own(new FI_cond(nullptr, 4, loopNext)));
+
+		// the global variables, the frame of the entry function, and head = NULL
+		entry_ = sequence({
+			new FI_load_cst(nullptr, 0, Data::createVoidPtr(8)),
+			new FI_node_create(nullptr, 0, 0, 8,
+				boxMan.getTypeInfo(GLOBAL_VARS_BLOCK_STR), globSels),
+			new FI_push_greg(nullptr, 0),
+			new FI_load_cst(nullptr, 0, Data::createVoidPtr(8)),
+			new FI_node_create(nullptr, 0, 0, 8, boxMan.getTypeInfo("frame"), frameSels),
+			new FI_push_greg(nullptr, 0),
+			new FI_get_greg(nullptr, 1, GLOB_INDEX),
+			new FI_load_cst(nullptr, 2, Data::createInt(0)),
+			new FI_store(nullptr, 1, 2, 0),
+			new FI_load_cst(nullptr, 1, Data::createUndef()),
+			new FI_load_cst(nullptr, 3, Data::createUnknw())
+		}, abs_);
+	}
+
+	/**
+	 * @brief  Gets the fixpoint at the loop head
+	 */
+	const FI_abs& abs() const
+	{
+		return *abs_;
+	}
+
+	/**
+	 * @brief  Runs the built program by @p execMan, which executes the states
+	 *         passed to @p f, until no box is learnt
+	 *
+	 * Errors of the program are left to the caller.
+	 *
+	 * @returns  The number of the runs restarted after learning a box
+	 */
+	template <class F>
+	size_t run(ExecutionManager& execMan, F f)
+	{
+		size_t restarts = 0;
+		while (true)
+		{
+			execMan.schedule(
+				RegisterFile(DataArray(REG_COUNT, Data::createUndef())),
+				std::shared_ptr<FAE>(new FAE(ctx_.taBackend, ctx_.boxMan)),
+				entry_);
+
+			try
+			{
+				execMan.run(f);
+				return restarts;
+			}
+			catch (RestartRequest&)
+			{	// a box has been learnt
+				++restarts;
+				abs_->clear();
+				execMan.clear();
+			}
+		}
+	}
+};
+
+#endif
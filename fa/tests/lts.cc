@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file lts.cc
+ * Checks the CSR tables of LTS and the simulation computed over them against
+ * the dense representation LTS used to have, on randomly generated LTSs.
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <set>
+#include <vector>
+
+// Forester headers
+#include "../bitmatrix.hh"
+#include "../lts.hh"
+#include "../simalg.hh"
+
+namespace
+{
+typedef std::vector<size_t> IdList;
+
+/**
+ * @brief  The dense LTS, as it used to be stored before the CSR tables
+ *
+ * The predecessors are kept in a labels x states array of lists, everything
+ * else is derived from them in the way the former implementation did.
+ */
+class DenseLTS
+{
+private:  // data members
+
+	size_t states_;
+	std::vector<std::vector<IdList>> dataPre_;
+
+public:   // methods
+
+	DenseLTS(size_t labels, size_t states) :
+		states_(states),
+		dataPre_(labels, std::vector<IdList>(states))
+	{ }
+
+	void addTransition(size_t q, size_t a, size_t r)
+	{
+		dataPre_[a][r].push_back(q);
+	}
+
+	IdList pre(size_t r, size_t a) const
+	{
+		IdList res = dataPre_[a][r];
+		std::sort(res.begin(), res.end());
+		return res;
+	}
+
+	IdList post(size_t q, size_t a) const
+	{
+		IdList res;
+		for (size_t r = 0; r < states_; ++r)
+		{
+			for (size_t p : dataPre_[a][r])
+			{
+				if (p == q)
+					res.push_back(r);
+			}
+		}
+
+		return res;
+	}
+
+	IdList lPre(size_t r) const
+	{
+		IdList res;
+		for (size_t a = 0; a < dataPre_.size(); ++a)
+		{
+			if (!dataPre_[a][r].empty())
+				res.push_back(a);
+		}
+
+		return res;
+	}
+
+	IdList sources(size_t a) const
+	{
+		std::set<size_t> res;
+		for (const IdList& preList : dataPre_[a])
+			res.insert(preList.begin(), preList.end());
+
+		return IdList(res.begin(), res.end());
+	}
+
+	/**
+	 * @brief  The greatest simulation computed naively as a fixpoint
+	 *
+	 * [q][r] is set iff every transition q --a--> q' is matched by some
+	 * transition r --a--> r' such that [q'][r'] is set.
+	 */
+	void simulation(BitMatrix& rel) const
+	{
+		rel.assign(states_, true);
+		bool changed = true;
+		while (changed)
+		{
+			changed = false;
+			for (size_t q = 0; q < states_; ++q)
+			{
+				for (size_t r = 0; r < states_; ++r)
+				{
+					if (rel.get(q, r) && !this->matches(rel, q, r))
+					{
+						rel.set(q, r, false);
+						changed = true;
+					}
+				}
+			}
+		}
+	}
+
+private:  // methods
+
+	bool matches(const BitMatrix& rel, size_t q, size_t r) const
+	{
+		for (size_t a = 0; a < dataPre_.size(); ++a)
+		{
+			const IdList rPost = this->post(r, a);
+			for (size_t q1 : this->post(q, a))
+			{
+				bool found = false;
+				for (size_t r1 : rPost)
+					found = found || rel.get(q1, r1);
+
+				if (!found)
+					return false;
+			}
+		}
+
+		return true;
+	}
+};
+
+IdList toList(const LTS::Range& range)
+{
+	return IdList(range.begin(), range.end());
+}
+
+bool checkOne(std::mt19937& rng, size_t labels, size_t states, size_t trans)
+{
+	LTS lts(labels, states);
+	DenseLTS ref(labels, states);
+	for (size_t i = 0; i < trans; ++i)
+	{
+		const size_t q = rng() % states;
+		const size_t a = rng() % labels;
+		const size_t r = rng() % states;
+		lts.addTransition(q, a, r);
+		ref.addTransition(q, a, r);
+	}
+
+	lts.build();
+	if (lts.transitions() != trans)
+		return false;
+
+	for (size_t a = 0; a < labels; ++a)
+	{
+		const IdList src = toList(lts.sources(a));
+		if (src != ref.sources(a))
+			return false;
+
+		for (size_t q : src)
+		{
+			if (src[lts.key(a, q)] != q)
+				return false;
+		}
+
+		for (size_t s = 0; s < states; ++s)
+		{
+			IdList pre = toList(lts.pre(s, a));
+			std::sort(pre.begin(), pre.end());
+			if (pre != ref.pre(s, a))
+				return false;
+
+			IdList post = toList(lts.post(s, a));
+			std::sort(post.begin(), post.end());
+			if (post != ref.post(s, a))
+				return false;
+		}
+	}
+
+	for (size_t s = 0; s < states; ++s)
+	{
+		if (toList(lts.lPre(s)) != ref.lPre(s))
+			return false;
+	}
+
+	OLRTAlgorithm alg(lts);
+	alg.init();
+	alg.run();
+
+	BitMatrix sim, refSim;
+	alg.buildRel(states, sim);
+	ref.simulation(refSim);
+	return sim == refSim;
+}
+} // namespace
+
+int main()
+{
+	std::mt19937 rng(/* fixed seed to make the test reproducible */ 42);
+
+	for (size_t i = 0; i < 500; ++i)
+	{
+		const size_t labels = 1 + rng() % 6;
+		const size_t states = 1 + rng() % 30;
+		const size_t trans = rng() % (3 * states);
+		if (!checkOne(rng, labels, states, trans))
+		{
+			std::cerr << "LTS mismatch in iteration " << i << " (labels: "
+				<< labels << ", states: " << states << ", transitions: "
+				<< trans << ")" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
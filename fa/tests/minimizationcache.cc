@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file minimizationcache.cc
+ * Checks that the minimisations memoised for automata equal up to renaming of
+ * states give the same automata as the minimisations computed afresh, and
+ * that the automata are memoised under the same entry exactly if they are
+ * equal up to renaming.
+ */
+
+// Standard library headers
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+#include "../treeaut.hh"
+#include "testutils.hh"
+
+namespace
+{
+/**
+ * @brief  Moves to the next tuple of numbers below @p bound
+ *
+ * @returns  @p false once all tuples have been visited
+ */
+bool nextTuple(std::vector<size_t>& tuple, size_t bound)
+{
+	for (size_t& i : tuple)
+	{
+		if (++i < bound)
+			return true;
+
+		i = 0;
+	}
+
+	return false;
+}
+
+/**
+ * @brief  Generates an automaton over the states @p 0 ... @p states - 1
+ */
+void randomTA(
+	TreeAut&                                          ta,
+	std::mt19937&                                     rng,
+	const std::vector<std::pair<label_type, size_t>>& labels,
+	size_t                                            states)
+{
+	for (const std::pair<label_type, size_t>& label : labels)
+	{
+		std::vector<size_t> lhs(label.second, 0);
+		do
+		{
+			for (size_t rhs = 0; rhs < states; ++rhs)
+			{
+				if (0 == rng() % (2 + 2 * label.second))
+					ta.addTransition(lhs, label.first, rhs);
+			}
+		} while (nextTuple(lhs, states));
+	}
+
+	ta.addFinalState(rng() % states);
+	if (0 == rng() % 2)
+		ta.addFinalState(rng() % states);
+}
+
+/**
+ * @brief  Copies @p src into @p dst with the state @p q renamed to
+ *         @p renaming[q]
+ */
+void renamed(TreeAut& dst, const TreeAut& src, const std::vector<size_t>& renaming)
+{
+	std::vector<size_t> lhs;
+	for (const TreeAut::TransIDPair* trans : src.getTransitions())
+	{
+		lhs.clear();
+		for (size_t state : trans->first.lhs())
+			lhs.push_back(renaming.at(state));
+
+		dst.addTransition(lhs, trans->first.label(), renaming.at(trans->first.rhs()));
+	}
+
+	for (size_t state : src.getFinalStates())
+		dst.addFinalState(renaming.at(state));
+}
+
+/**
+ * @brief  Checks that two automata (of the same backend) are the same
+ */
+bool same(const TreeAut& a, const TreeAut& b)
+{
+	return (a.getTransitions() == b.getTransitions())
+		&& (a.getFinalStates() == b.getFinalStates());
+}
+} // namespace
+
+int main()
+{
+	TreeAut::Backend backend;
+	BoxMan boxMan;
+	boxMan.createTypeInfo("T", {0});
+	boxMan.createTypeInfo("U", {0, 8});
+
+	const TypeBox* typeT = boxMan.getTypeInfo("T");
+	const TypeBox* typeU = boxMan.getTypeInfo("U");
+	const SelData next(0, 8, 0, "next");
+	const SelData prev(8, 8, 0, "prev");
+
+	// labels with their arities
+	const std::vector<std::pair<label_type, size_t>> labels = {
+		std::make_pair(boxMan.lookupLabel(Data::createInt(0)), 0),
+		std::make_pair(boxMan.lookupLabel(Data::createInt(1)), 0),
+		std::make_pair(nodeLabel(boxMan, typeT, {next}), 1),
+		std::make_pair(nodeLabel(boxMan, typeU, {next, prev}), 2)
+	};
+
+	std::mt19937 rng(42);
+	size_t hits = 0;
+	for (size_t i = 0; i < 300; ++i)
+	{
+		const size_t states = 2 + i % 5;
+		TreeAut a(backend);
+		randomTA(a, rng, labels, states);
+
+		// a renaming of the states to other ones in a different order
+		std::vector<size_t> renaming;
+		for (size_t q = 0; q < states; ++q)
+			renaming.push_back(10 + 3 * q);
+
+		std::shuffle(renaming.begin(), renaming.end(), rng);
+
+		TreeAut b(backend);
+		renamed(b, a, renaming);
+
+		// the minimisation of a is memoised (unless a has no canonical form)
+		TreeAut::clearCaches();
+		TreeAut minA(backend);
+		a.minimized(minA);
+		const size_t entries = TreeAut::minimizationCacheSize();
+		CHECK(entries <= 1);
+
+		// the renamed automaton is answered from the same entry
+		TreeAut cachedB(backend);
+		b.minimized(cachedB);
+		CHECK(entries == TreeAut::minimizationCacheSize());
+		hits += entries;
+
+		// ... which gives the same result as the minimisation computed afresh,
+		// i.e. the result of a renamed (the states that stay are picked by their
+		// names in automata without a canonical form)
+		TreeAut::clearCaches();
+		TreeAut minB(backend), renamedMinA(backend);
+		b.minimized(minB);
+		renamed(renamedMinA, minA, renaming);
+		CHECK(same(cachedB, minB));
+		CHECK((0 == entries) || same(renamedMinA, minB));
+
+		// the language is kept (the inclusion is exact on automata without
+		// useless states only)
+		TreeAut usefulB(backend), tmp(backend);
+		b.uselessFree(tmp).unreachableFree(usefulB);
+		CHECK(TreeAut::subseteq(cachedB, usefulB) && TreeAut::subseteq(usefulB, cachedB));
+
+		// an automaton that differs from a in a single transition is kept apart
+		// from a (if both have a canonical form)
+		TreeAut c(a);
+		c.addTransition(std::vector<size_t>(), labels[1].first, states);
+		TreeAut::clearCaches();
+		tmp.clear();
+		c.minimized(tmp);
+		if ((1 == entries) && (1 == TreeAut::minimizationCacheSize()))
+		{
+			tmp.clear();
+			a.minimized(tmp);
+			CHECK(2 == TreeAut::minimizationCacheSize());
+		}
+	}
+
+	// most of the random automata have a canonical form
+	CHECK(150 < hits);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file signatures.cc
+ * Checks that the signatures of a root updated by ConnectionGraph::
+ * updateSignatures() after a box is folded into it are the same as the ones
+ * computed from scratch by ConnectionGraph::computeSignatures().
+ */
+
+// Standard library headers
+#include <memory>
+#include <set>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+#include "../connection_graph.hh"
+#include "../folding.hh"
+#include "../forestautext.hh"
+#include "../restart_request.hh"
+#include "testutils.hh"
+
+namespace
+{
+/**
+ * @brief  Folding with its signatures of roots exposed
+ */
+class TestFolding : public Folding
+{
+public:
+
+	TestFolding(FAE& fae, BoxMan& boxMan) :
+		Folding(fae, boxMan)
+	{ }
+
+	using Folding::getSignatures;
+};
+
+/**
+ * @brief  Builds a forest automaton with two roots
+ *
+ * The root 0 is a list of @p length nodes of the type @p T, the last of which
+ * refers to the root 1 by both its selectors.  The root 1 is a single node with
+ * undefined selectors.
+ */
+std::shared_ptr<FAE> makeFAE(
+	TreeAut::Backend&                 backend,
+	BoxMan&                           boxMan,
+	size_t                            length)
+{
+	const TypeBox* type = boxMan.getTypeInfo("T");
+	const std::vector<SelData> sels = {
+		SelData(0, 8, 0, "next"),
+		SelData(8, 8, 0, "data")
+	};
+	const label_type node = nodeLabel(boxMan, type, sels);
+
+	TreeAut* ta = new TreeAut(backend);
+	ta->addTransition(std::vector<size_t>(),
+		boxMan.lookupLabel(Data::createUndef()), 0);
+	ta->addTransition(std::vector<size_t>(),
+		boxMan.lookupLabel(Data::createRef(1)), 1);
+	ta->addTransition(std::vector<size_t>({1, 1}), node, 2);
+	for (size_t i = 3; i < length + 2; ++i)
+		ta->addTransition(std::vector<size_t>({i - 1, 0}), node, i);
+	ta->addFinalState(length + 1);
+
+	TreeAut* aux = new TreeAut(backend);
+	aux->addTransition(std::vector<size_t>(),
+		boxMan.lookupLabel(Data::createUndef()), 0);
+	aux->addTransition(std::vector<size_t>({0, 0}), node, 1);
+	aux->addFinalState(1);
+
+	std::shared_ptr<FAE> fae(new FAE(backend, boxMan));
+	fae->appendRoot(ta);
+	fae->connectionGraph.newRoot();
+	fae->appendRoot(aux);
+	fae->connectionGraph.newRoot();
+	fae->updateConnectionGraph();
+	return fae;
+}
+} // namespace
+
+int main()
+{
+	TreeAut::Backend backend;
+	BoxMan boxMan;
+	boxMan.createTypeInfo("T", {0, 8});
+
+	for (size_t length = 1; length < 5; ++length)
+	{
+		try
+		{	// the box is learnt first, which may restart the analysis
+			const std::shared_ptr<FAE> fae = makeFAE(backend, boxMan, length);
+			Folding(*fae, boxMan).discover2(0, std::set<size_t>(), false);
+		}
+		catch (const RestartRequest&)
+		{ }
+
+		const std::shared_ptr<FAE> fae = makeFAE(backend, boxMan, length);
+		TestFolding folding(*fae, boxMan);
+
+		// the signatures of the root are valid before the box is folded
+		folding.getSignatures(0);
+		CHECK(folding.discover2(0, std::set<size_t>(), true));
+
+		ConnectionGraph::StateToCutpointSignatureMap signatures;
+		ConnectionGraph::StateToLinksMap links;
+		ConnectionGraph::computeSignatures(signatures, links, *fae->getRoot(0));
+		CHECK(signatures == folding.getSignatures(0));
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file symstate.cc
+ * Checks that a forest automaton dropped by SymState::compact() is restored
+ * only from an automaton of the same contents.
+ */
+
+// Standard library headers
+#include <memory>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+#include "../forestautext.hh"
+#include "../symstate.hh"
+#include "testutils.hh"
+
+namespace
+{
+/**
+ * @brief  Builds a forest automaton with a single root
+ *
+ * The root has a leaf labelled by @p leaf and a node above it, the final state
+ * is @p final.
+ */
+std::shared_ptr<FAE> makeFAE(
+	TreeAut::Backend&                 backend,
+	BoxMan&                           boxMan,
+	const Data&                       leaf,
+	size_t                            final)
+{
+	const std::vector<SelData> sels = { SelData(0, 8, 0, "next") };
+	const TypeBox* type = boxMan.getTypeInfo("T");
+
+	TreeAut* ta = new TreeAut(backend);
+	ta->addTransition(std::vector<size_t>(), boxMan.lookupLabel(leaf), 1);
+	ta->addTransition(std::vector<size_t>({1}),
+		nodeLabel(boxMan, type, sels), final);
+	ta->addFinalState(final);
+
+	std::shared_ptr<FAE> fae(new FAE(backend, boxMan));
+	fae->appendRoot(ta);
+	return fae;
+}
+} // namespace
+
+int main()
+{
+	TreeAut::Backend backend;
+	BoxMan boxMan;
+	boxMan.createTypeInfo("T", {0});
+
+	const std::shared_ptr<FAE> fae =
+		makeFAE(backend, boxMan, Data::createRef(0), 2);
+
+	SymState state;
+	state.SetFAE(fae);
+	state.compact();
+	CHECK(nullptr == state.GetFAE());
+
+	// the same numbers of transitions and final states, but different contents
+	CHECK(!state.restore(makeFAE(backend, boxMan, Data::createUndef(), 2)));
+	CHECK(!state.restore(makeFAE(backend, boxMan, Data::createRef(0), 3)));
+	CHECK(nullptr == state.GetFAE());
+
+	// an automaton recomputed with the same contents
+	const std::shared_ptr<FAE> same =
+		makeFAE(backend, boxMan, Data::createRef(0), 2);
+	CHECK(state.restore(same));
+	CHECK(same == state.GetFAE());
+
+	state.SetFAE(nullptr);
+	return EXIT_SUCCESS;
+}
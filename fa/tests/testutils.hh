@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FA_TESTS_TESTUTILS_H
+#define FA_TESTS_TESTUTILS_H
+
+/**
+ * @file testutils.hh
+ * The check macro and the fixtures shared by the unit tests of forester.
+ */
+
+// Standard library headers
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Forester headers
+#include "../boxman.hh"
+
+/**
+ * @brief  Makes the test fail, i.e. @p main() return, unless @p cond holds
+ */
+#define CHECK(cond) do {                                                    \
+	if (!(cond)) {                                                          \
+		std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: "      \
+			<< #cond << std::endl;                                          \
+		return EXIT_FAILURE;                                                \
+	}                                                                       \
+} while (0)
+
+/**
+ * @brief  Looks up the label of a node of the type @p type
+ *
+ * The node consists of the type box followed by a selector box for each of
+ * @p sels, which also describe the layout of the node.
+ */
+inline label_type nodeLabel(
+	BoxMan&                           boxMan,
+	const TypeBox*                    type,
+	const std::vector<SelData>&       sels)
+{
+	std::vector<const AbstractBox*> node = { type };
+	for (const SelData& sel : sels)
+		node.push_back(boxMan.getSelector(sel));
+
+	return boxMan.lookupLabel(node, boxMan.LookupTypeDesc(type, sels));
+}
+
+#endif
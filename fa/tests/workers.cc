@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file workers.cc
+ * Runs the same microcode program by a single worker and by several ones and
+ * checks that they compute the same fixpoint and execute the same number of
+ * states and paths.
+ */
+
+// Standard library headers
+#include <memory>
+#include <vector>
+
+// Forester headers
+#include "listprogram.hh"
+#include "testutils.hh"
+
+namespace
+{
+/// the number of nested branches on an unknown value after the loop
+const size_t EXIT_BRANCHES = 5;
+
+/**
+ * @brief  The outcome of a single run of the program
+ */
+struct Result
+{
+	size_t states;
+	size_t paths;
+	size_t restarts;
+	size_t boxes;
+
+	/// the fixpoint at the loop head (in the fixpoint backend of the context)
+	std::shared_ptr<TreeAut> fixpoint;
+};
+
+/**
+ * @brief  Builds and runs the list program by @p workers workers
+ *
+ * After the loop, the program branches @p EXIT_BRANCHES times on an unknown
+ * value before the check for garbage, so that the paths leaving the loop (and
+ * sharing its forest automata) are checked by the workers concurrently.
+ */
+Result run(ListContext& ctx, size_t workers)
+{
+	ListProgram prog(ctx);
+
+	// the check for garbage after the branches leaving the loop, both
+	// successors of a branch continue with the next one
+	AbstractInstruction* exit = prog.sequence({
+		new FI_check(nullptr),
+		new FI_abort(nullptr)
+	}, nullptr);
+
+	for (size_t i = 0; i < EXIT_BRANCHES; ++i)
+	{
+		AbstractInstruction* next[2] = { exit, exit };
+		exit = prog.sequence({ new FI_eq(nullptr, 4, 3, 3) },
+			prog.own(new FI_cond(nullptr, 4, next)));
+	}
+
+	prog.build(exit);
+
+	Result result = { 0, 0, 0, 0, nullptr };
+	ExecutionManager execMan(workers);
+	result.restarts = prog.run(execMan,
+		[&execMan](SymState& state) { execMan.execute(state); });
+
+	result.states = execMan.statesEvaluated();
+	result.paths = execMan.pathsEvaluated();
+	result.boxes = ctx.boxMan.boxDatabase().size();
+	result.fixpoint = std::make_shared<TreeAut>(prog.abs().getFixPoint());
+
+	execMan.clear();
+	return result;
+}
+} // namespace
+
+int main()
+{
+	// the serial run learns the boxes
+	ListContext serialCtx;
+	const Result serial = run(serialCtx, 1);
+	CHECK(0 < serial.states);
+	CHECK(!serial.fixpoint->getTransitions().empty());
+
+	// every iteration of the loop leaves it by all the branches after it
+	CHECK((1 << EXIT_BRANCHES) < serial.paths);
+
+	// the serial run once the boxes are known
+	const Result warm = run(serialCtx, 1);
+	CHECK(0 == warm.restarts);
+
+	for (size_t workers : { 2, 4 })
+	{	// the order of the states differs from run to run
+		for (size_t i = 0; i < 5; ++i)
+		{
+			ListContext ctx;
+			const Result parallel = run(ctx, workers);
+			CHECK(serial.states == parallel.states);
+			CHECK(serial.paths == parallel.paths);
+			CHECK(serial.restarts == parallel.restarts);
+			CHECK(serial.boxes == parallel.boxes);
+
+			// the labels of the fixpoints are comparable in the same context only
+			const Result warmParallel = run(serialCtx, workers);
+			CHECK(warm.states == warmParallel.states);
+			CHECK(warm.paths == warmParallel.paths);
+			CHECK(0 == warmParallel.restarts);
+			CHECK(serial.boxes == warmParallel.boxes);
+			CHECK(TreeAut::subseteq(*serial.fixpoint, *warmParallel.fixpoint));
+			CHECK(TreeAut::subseteq(*warmParallel.fixpoint, *serial.fixpoint));
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -25,10 +25,16 @@
 #include <stdexcept>
 #include <ostream>
 
+// Boost headers
+#include <boost/functional/hash.hpp>
+
 // Forester headers
+#include "boundedcache.hh"
+#include "config.h"
 #include "treeaut.hh"
 #include "simalg.hh"
 #include "antichainext.hh"
+#include "profiler.hh"
 
 struct LhsEnv
 {
@@ -68,7 +74,7 @@ struct LhsEnv
 	static bool sim(
 		const LhsEnv&                              e1,
 		const LhsEnv&                              e2,
-		const std::vector<std::vector<bool>>&      sim)
+		const BitMatrix&                           sim)
 	{
 		if ((e1.index != e2.index) || (e1.data.size() != e2.data.size()))
 			return false;
@@ -85,7 +91,7 @@ struct LhsEnv
 	static bool eq(
 		const LhsEnv&                           e1,
 		const LhsEnv&                           e2,
-		const std::vector<std::vector<bool>>&   sim)
+		const BitMatrix&                        sim)
 	{
 		if ((e1.index != e2.index) || (e1.data.size() != e2.data.size()))
 			return false;
@@ -173,7 +179,7 @@ struct Env
 	static bool sim(
 		const Env&                              e1,
 		const Env&                              e2,
-		const std::vector<std::vector<bool>>&   sim)
+		const BitMatrix&                        sim)
 	{
 		return (e1.label == e2.label) && LhsEnv::sim(*e1.lhs, *e2.lhs, sim);
 	}
@@ -181,7 +187,7 @@ struct Env
 	static bool eq(
 		const Env&                              e1,
 		const Env&                              e2,
-		const std::vector<std::vector<bool>>&   sim)
+		const BitMatrix&                        sim)
 	{
 		return (e1.label == e2.label) && LhsEnv::eq(*e1.lhs, *e2.lhs, sim);
 	}
@@ -227,12 +233,14 @@ void TA<T>::downwardTranslation(
 			labelIndex[ptrTransIDPair->first.label()],
 			stateIndex.size() + lhs[&(ptrTransIDPair->first.lhs())]);
 	}
+
+	lts.build();
 }
 
 
 template <class T>
 void TA<T>::downwardSimulation(
-	std::vector<std::vector<bool>>&   rel,
+	BitMatrix&                        rel,
 	const Index<size_t>&              stateIndex) const
 {
 	LTS lts;
@@ -249,10 +257,10 @@ template <class T>
 void TA<T>::upwardTranslation(
 	LTS&                                    lts,
 	std::vector<std::vector<size_t>>&       part,
-	std::vector<std::vector<bool>>&         rel,
+	BitMatrix&                              rel,
 	const Index<size_t>&                    stateIndex,
 	const Index<T>&                         labelIndex,
-	const std::vector<std::vector<bool>>&   sim) const
+	const BitMatrix&                        sim) const
 {
 	std::set<LhsEnv> lhsEnvSet;
 	std::map<Env, size_t> envMap;
@@ -293,7 +301,10 @@ void TA<T>::upwardTranslation(
 		}
 	}
 
-	lts = LTS(labelIndex.size() + 1, stateIndex.size() + envMap.size());
+	// two isolated states (a non-accepting and an accepting one) follow the
+	// environments, they keep the blocks 0 and 1 non-empty so that the splits
+	// number the blocks the way the initial relation below expects
+	lts = LTS(labelIndex.size() + 1, stateIndex.size() + envMap.size() + 2);
 	for (const TransIDPair* ptrTransIDPair : this->transitions)
 	{
 		std::vector<size_t> lhs;
@@ -305,13 +316,15 @@ void TA<T>::upwardTranslation(
 			// find particular env
 			std::map<Env, size_t>::iterator env =
 				Env::find(LhsEnv::find(lhs, j, lhsEnvSet), label, rhs, envMap);
-			lts.addTransition(lhs[j], labelIndex.size(), env->second);
-			lts.addTransition(env->second, label, rhs);
+			// the environments follow the states in the LTS
+			lts.addTransition(lhs[j], labelIndex.size(), env->second + stateIndex.size());
+			lts.addTransition(env->second + stateIndex.size(), label, rhs);
 		}
 	}
 
-	rel = std::vector<std::vector<bool>>(
-		part.size() + 2, std::vector<bool>(part.size() + 2, false));
+	lts.build();
+
+	rel.assign(part.size() + 2, false);
 
 	// 0 non-accepting, 1 accepting, 2 .. environments
 	rel[0][0] = true;
@@ -329,20 +342,21 @@ void TA<T>::upwardTranslation(
 
 template <class T>
 void TA<T>::upwardSimulation(
-	std::vector<std::vector<bool>>&         rel,
+	BitMatrix&                              rel,
 	const Index<size_t>&                    stateIndex,
-	const std::vector<std::vector<bool>>&   param) const
+	const BitMatrix&                        param) const
 {
 	LTS lts;
 	Index<T> labelIndex;
 	this->buildLabelIndex(labelIndex);
 	std::vector<std::vector<size_t>> part;
-	std::vector<std::vector<bool>> initRel;
+	BitMatrix initRel;
 	this->upwardTranslation(lts, part, initRel, stateIndex, labelIndex, param);
 	OLRTAlgorithm alg(lts);
 	// accepting states to block 1
 	std::vector<size_t> finalStates;
 	stateIndex.translate(finalStates, std::vector<size_t>(finalStates_.begin(), finalStates_.end()));
+	finalStates.push_back(lts.states() - 1);
 	alg.fakeSplit(finalStates);
 	// environments to blocks 2, 3, ...
 	for (size_t i = 0; i < part.size(); ++i)
@@ -355,24 +369,19 @@ void TA<T>::upwardSimulation(
 
 template <class T>
 void TA<T>::combinedSimulation(
-	std::vector<std::vector<bool>>&           dst,
-	const std::vector<std::vector<bool>>&     dwn,
-	const std::vector<std::vector<bool>>&     up)
+	BitMatrix&                                dst,
+	const BitMatrix&                          dwn,
+	const BitMatrix&                          up)
 {
 	size_t size = dwn.size();
-	std::vector<std::vector<bool> > dut(size, std::vector<bool>(size, false));
+	BitMatrix dut(size, false);
 	for (size_t i = 0; i < size; ++i)
 	{
 		for (size_t j = 0; j < size; ++j)
 		{
-			for (size_t k = 0; k < size; ++k)
-			{
-				if (dwn[i][k] && up[j][k])
-				{
-					dut[i][j] = true;
-					break;
-				}
-			}
+			// is there k such that dwn[i][k] && up[j][k]?
+			if (dwn.rowsIntersect(i, up, j))
+				dut.set(i, j);
 		}
 	}
 	dst = dut;
@@ -380,25 +389,761 @@ void TA<T>::combinedSimulation(
 	{
 		for (size_t j = 0; j < size; ++j)
 		{
-			if (!dst[i][j])
+			if (!dst.get(i, j))
 				continue;
 
-			for (size_t k = 0; k < size; ++k)
+			// does dwn[j][k] imply dut[i][k] for all k?
+			if (!dwn.rowSubsetOf(j, dut, i))
+				dst.set(i, j, false);
+		}
+	}
+}
+
+namespace
+{
+/**
+ * @brief  A numbering of states of a TA that does not depend on their names
+ *
+ * The states are coloured by iterated hashing of their neighbourhoods (colour
+ * refinement) until the colouring stabilises.  If all states end up with
+ * distinct colours, ordering the states by their colours gives a canonical
+ * numbering, i.e. automata equal up to renaming of states get equal keys.
+ * Automata where some states cannot be distinguished this way (typically due
+ * to symmetries) are left without a canonical form.
+ */
+template <class T>
+class CanonicalTA
+{
+public:   // data types
+
+	typedef std::pair<std::pair<size_t, T>, std::vector<size_t>> trans_type;
+
+	/**
+	 * @brief  An automaton over canonical state numbers
+	 */
+	struct Key
+	{
+		size_t stateCount;
+		std::vector<size_t> finalStates;
+		std::vector<trans_type> transitions;
+		size_t hash;
+
+		Key() :
+			stateCount(0),
+			finalStates{},
+			transitions{},
+			hash(0)
+		{ }
+
+		/**
+		 * @brief  The number of bytes the key takes on the heap
+		 */
+		size_t bytes() const
+		{
+			size_t bytes = finalStates.capacity() * sizeof(size_t)
+				+ transitions.capacity() * sizeof(trans_type);
+
+			for (const trans_type& trans : transitions)
+				bytes += trans.second.capacity() * sizeof(size_t);
+
+			return bytes;
+		}
+
+		bool operator==(const Key& rhs) const
+		{
+			return (this->hash == rhs.hash)
+				&& (this->stateCount == rhs.stateCount)
+				&& (this->finalStates == rhs.finalStates)
+				&& (this->transitions == rhs.transitions);
+		}
+	};
+
+	struct KeyHash
+	{
+		size_t operator()(const Key& key) const
+		{
+			return key.hash;
+		}
+	};
+
+private:  // data members
+
+	const Index<size_t>& stateIndex_;
+
+	/// the canonical number of the state at the given position in the index
+	std::vector<size_t> canon_;
+
+	/// the state with the given canonical number
+	std::vector<size_t> states_;
+
+	bool valid_;
+	Key key_;
+
+private:  // methods
+
+	/**
+	 * @brief  Builds the key of @p ta with the state @p q renamed to @p f(q)
+	 */
+	template <class F>
+	static void buildKey(Key& dst, const TA<T>& ta, size_t stateCount, F f)
+	{
+		dst.stateCount = stateCount;
+		for (size_t state : ta.getFinalStates())
+			dst.finalStates.push_back(f(state));
+
+		std::sort(dst.finalStates.begin(), dst.finalStates.end());
+
+		for (const typename TA<T>::TransIDPair* trans : ta.transitions)
+		{
+			std::vector<size_t> lhs;
+			for (size_t state : trans->first.lhs())
+				lhs.push_back(f(state));
+
+			dst.transitions.push_back(trans_type(std::make_pair(
+				f(trans->first.rhs()), trans->first.label()), lhs));
+		}
+
+		std::sort(dst.transitions.begin(), dst.transitions.end());
+
+		dst.hash = dst.stateCount;
+		boost::hash_combine(dst.hash, dst.finalStates);
+		for (const trans_type& trans : dst.transitions)
+		{
+			boost::hash_combine(dst.hash, trans.first.first);
+			boost::hash_combine(dst.hash, trans.first.second);
+			boost::hash_combine(dst.hash, trans.second);
+		}
+	}
+
+	static size_t countColours(const std::vector<size_t>& colours)
+	{
+		std::vector<size_t> tmp(colours);
+		std::sort(tmp.begin(), tmp.end());
+		return std::unique(tmp.begin(), tmp.end()) - tmp.begin();
+	}
+
+public:   // methods
+
+	/**
+	 * @param[in]  ta          The automaton
+	 * @param[in]  stateIndex  An index of all states of @p ta
+	 */
+	CanonicalTA(
+		const TA<T>&                   ta,
+		const Index<size_t>&           stateIndex) :
+		stateIndex_(stateIndex),
+		canon_(stateIndex.size()),
+		states_(stateIndex.size()),
+		valid_(false),
+		key_{}
+	{
+		const size_t n = stateIndex.size();
+
+		std::vector<size_t> colours(n, 0);
+		for (const std::pair<const size_t, size_t>& state : stateIndex)
+		{
+			if (ta.isFinalState(state.first))
+				colours[state.second] = 1;
+		}
+
+		// the transitions over positions in the index
+		std::vector<std::pair<size_t, std::vector<size_t>>> trans;
+		std::vector<size_t> labels;
+		for (const typename TA<T>::TransIDPair* t : ta.transitions)
+		{
+			trans.push_back(std::make_pair(stateIndex[t->first.rhs()], std::vector<size_t>()));
+			stateIndex.translate(trans.back().second, t->first.lhs());
+			labels.push_back(boost::hash<T>()(t->first.label()));
+		}
+
+		size_t classes = countColours(colours);
+		std::vector<std::vector<size_t>> sigs(n);
+		std::vector<size_t> next(n);
+		while (classes < n)
+		{
+			for (std::vector<size_t>& sig : sigs)
+				sig.clear();
+
+			for (size_t i = 0; i < trans.size(); ++i)
 			{
-				if (dwn[j][k] && !dut[i][k])
+				const std::vector<size_t>& lhs = trans[i].second;
+				const size_t rhs = trans[i].first;
+
+				size_t base = labels[i];
+				for (size_t state : lhs)
+					boost::hash_combine(base, colours[state]);
+
+				// the transition as seen from its right-hand side
+				size_t h = base;
+				boost::hash_combine(h, 0);
+				sigs[rhs].push_back(h);
+
+				// the transition as seen from the states of its left-hand side
+				for (size_t j = 0; j < lhs.size(); ++j)
 				{
-					dst[i][j] = false;
+					h = base;
+					boost::hash_combine(h, j + 1);
+					boost::hash_combine(h, colours[rhs]);
+					sigs[lhs[j]].push_back(h);
+				}
+			}
+
+			for (size_t q = 0; q < n; ++q)
+			{
+				std::sort(sigs[q].begin(), sigs[q].end());
+				next[q] = colours[q];
+				boost::hash_combine(next[q], sigs[q]);
+			}
+
+			colours.swap(next);
+
+			const size_t refined = countColours(colours);
+			if (refined <= classes)
+				// stable colouring
+				break;
+
+			classes = refined;
+		}
+
+		if (classes < n)
+			return;
+
+		std::vector<std::pair<size_t, size_t>> order;
+		for (size_t q = 0; q < n; ++q)
+			order.push_back(std::make_pair(colours[q], q));
+
+		std::sort(order.begin(), order.end());
+
+		for (const std::pair<const size_t, size_t>& state : stateIndex)
+			states_[state.second] = state.first;
+
+		std::vector<size_t> byPos(states_);
+		for (size_t i = 0; i < n; ++i)
+		{
+			canon_[order[i].second] = i;
+			states_[i] = byPos[order[i].second];
+		}
+
+		buildKey(key_, ta, n, [this](size_t state) {
+			return canon_[stateIndex_[state]];
+		});
+
+		valid_ = true;
+	}
+
+	bool valid() const
+	{
+		return valid_;
+	}
+
+	const Key& key() const
+	{
+		return key_;
+	}
+
+	/**
+	 * @brief  Builds the automaton over the canonical states of a key
+	 */
+	static void build(TA<T>& dst, const Key& src)
+	{
+		for (size_t state : src.finalStates)
+			dst.addFinalState(state);
+
+		for (const trans_type& trans : src.transitions)
+			dst.addTransition(trans.second, trans.first.second, trans.first.first);
+	}
+
+	/**
+	 * @brief  Translates an automaton over (a subset of) the canonical states
+	 *         to a key
+	 */
+	void store(Key& dst, const TA<T>& ta) const
+	{
+		assert(valid_);
+		buildKey(dst, ta, canon_.size(), [](size_t state) { return state; });
+	}
+
+	/**
+	 * @brief  Translates a key back to an automaton over the original states
+	 */
+	void restore(TA<T>& dst, const Key& src) const
+	{
+		assert(valid_);
+		for (size_t state : src.finalStates)
+			dst.addFinalState(states_[state]);
+
+		for (const trans_type& trans : src.transitions)
+		{
+			std::vector<size_t> lhs;
+			for (size_t state : trans.second)
+				lhs.push_back(states_[state]);
+
+			dst.addTransition(lhs, trans.first.second, states_[trans.first.first]);
+		}
+	}
+
+	/**
+	 * @brief  Translates a relation indexed by @p stateIndex to the canonical one
+	 */
+	void storeRel(BitMatrix& dst, const BitMatrix& rel) const
+	{
+		const size_t n = canon_.size();
+		dst.assign(n, false);
+		for (size_t i = 0; i < n; ++i)
+		{
+			rel.forEachInRow(i, [this, &dst, i](size_t j) {
+				dst.set(canon_[i], canon_[j]);
+			});
+		}
+	}
+
+	/**
+	 * @brief  Translates a canonical relation to the one indexed by @p stateIndex
+	 */
+	void restoreRel(BitMatrix& dst, const BitMatrix& rel) const
+	{
+		const size_t n = canon_.size();
+		dst.assign(n, false);
+		for (size_t i = 0; i < n; ++i)
+		{
+			for (size_t j = 0; j < n; ++j)
+				dst.set(i, j, rel.get(canon_[i], canon_[j]));
+		}
+	}
+};
+
+/**
+ * @brief  Memoised minimisation results and simulations
+ *
+ * The entries are keyed by the canonical form of the automaton, its contents
+ * rather than its identity, hence nothing in the cache depends on whether the
+ * automaton is modified or released later on.
+ */
+template <class T>
+struct MinimizationCache
+{
+	typedef typename CanonicalTA<T>::Key key_type;
+
+	struct Entry
+	{
+		bool hasDwn;
+		BitMatrix dwn;
+		bool hasMinimized;
+		key_type minimized;
+		bool hasUp;
+		BitMatrix up;
+		BitMatrix upDwn;
+
+		Entry() :
+			hasDwn(false),
+			dwn{},
+			hasMinimized(false),
+			minimized{},
+			hasUp(false),
+			up{},
+			upDwn{}
+		{ }
+	};
+
+	/**
+	 * @brief  The number of bytes an entry takes (up to the overhead of the
+	 *         cache itself)
+	 */
+	struct EntryBytes
+	{
+		size_t operator()(const key_type& key, const Entry& entry) const
+		{
+			return sizeof(key_type) + key.bytes() + sizeof(Entry)
+				+ entry.dwn.bytes() + entry.minimized.bytes()
+				+ entry.up.bytes() + entry.upDwn.bytes();
+		}
+	};
+
+	typedef BoundedCache<key_type, Entry,
+		typename CanonicalTA<T>::KeyHash, EntryBytes> cache_type;
+
+	/**
+	 * @brief  Returns the cache of the current worker
+	 */
+	static cache_type& get()
+	{
+		// every worker keeps its own cache
+		static thread_local cache_type cache(FA_MINIMIZATION_CACHE_BYTES);
+		return cache;
+	}
+
+	/**
+	 * @brief  Returns the entry of the given automaton, creates it if needed
+	 */
+	static Entry& lookup(const key_type& key)
+	{
+		return get().lookup(key);
+	}
+
+	/**
+	 * @brief  Accounts for the changes of the entry of the given automaton
+	 *
+	 * The entry is changed in place by the one who looked it up, this may drop
+	 * the least recently used entries to keep the cache within its bounds.
+	 */
+	static void updated(const key_type& key)
+	{
+		get().reweigh(key);
+	}
+};
+
+/**
+ * @brief  Computes the downward simulation, or takes it from the cache
+ */
+template <class T>
+void cachedDownwardSimulation(
+	BitMatrix&                              dwn,
+	const TA<T>&                            ta,
+	const Index<size_t>&                    stateIndex,
+	const CanonicalTA<T>&                   canon)
+{
+	if (!FA_MINIMIZATION_CACHE_BYTES || !canon.valid())
+	{
+		ta.downwardSimulation(dwn, stateIndex);
+		return;
+	}
+
+	typename MinimizationCache<T>::Entry& entry =
+		MinimizationCache<T>::lookup(canon.key());
+
+	if (entry.hasDwn)
+	{
+		canon.restoreRel(dwn, entry.dwn);
+		return;
+	}
+
+	ta.downwardSimulation(dwn, stateIndex);
+	canon.storeRel(entry.dwn, dwn);
+	entry.hasDwn = true;
+	MinimizationCache<T>::updated(canon.key());
+}
+
+/**
+ * @brief  Computes the upward simulations induced by the identity and by @p dwn
+ */
+template <class T>
+void upwardSimulations(
+	BitMatrix&                              up,
+	BitMatrix&                              upDwn,
+	const TA<T>&                            ta,
+	const Index<size_t>&                    stateIndex,
+	const BitMatrix&                        dwn)
+{
+	BitMatrix id(stateIndex.size(), false);
+	for (size_t i = 0; i < stateIndex.size(); ++i)
+		id.set(i, i);
+
+	ta.upwardSimulation(up, stateIndex, id);
+	ta.upwardSimulation(upDwn, stateIndex, dwn);
+}
+
+/**
+ * @brief  Computes the simulations for inclusion checking, or takes them from
+ *         the cache
+ *
+ * @param[out]  dwn    The downward simulation of @p ta
+ * @param[out]  up     The upward simulation of @p ta induced by the identity
+ * @param[out]  upDwn  The upward simulation of @p ta induced by @p dwn
+ */
+template <class T>
+void cachedInclusionSimulations(
+	BitMatrix&                              dwn,
+	BitMatrix&                              up,
+	BitMatrix&                              upDwn,
+	const TA<T>&                            ta,
+	const Index<size_t>&                    stateIndex,
+	const CanonicalTA<T>&                   canon)
+{
+	cachedDownwardSimulation(dwn, ta, stateIndex, canon);
+	if (!FA_MINIMIZATION_CACHE_BYTES || !canon.valid())
+	{
+		upwardSimulations(up, upDwn, ta, stateIndex, dwn);
+		return;
+	}
+
+	typename MinimizationCache<T>::Entry& entry =
+		MinimizationCache<T>::lookup(canon.key());
+
+	if (entry.hasUp)
+	{
+		canon.restoreRel(up, entry.up);
+		canon.restoreRel(upDwn, entry.upDwn);
+		return;
+	}
+
+	upwardSimulations(up, upDwn, ta, stateIndex, dwn);
+	canon.storeRel(entry.up, up);
+	canon.storeRel(entry.upDwn, upDwn);
+	entry.hasUp = true;
+	MinimizationCache<T>::updated(canon.key());
+}
+
+/**
+ * @brief  The right-hand side of the last inclusion check of a worker
+ *
+ * The fixpoints and the folding loop check many automata against the same
+ * right-hand side.  Its renamed copy (the states @p 0 ... @p size() - 1 of the
+ * union) is therefore kept in a backend of its own until the right-hand side
+ * changes, and the unions are built on top of it.  The copy is compared by the
+ * labels of transitions, so it lives as long as the minimisation cache (see
+ * TA::clearCaches()).
+ */
+template <class T>
+class InclusionRhs
+{
+	typename TA<T>::Backend backend_;
+
+	/// the renamed copy of the right-hand side
+	TA<T> rhs_;
+
+	/// the renaming of the states of the right-hand side
+	Index<size_t> index_;
+
+private:  // methods
+
+	InclusionRhs(const InclusionRhs&);
+	InclusionRhs& operator=(const InclusionRhs&);
+
+	/**
+	 * @brief  Checks whether @p b is the automaton the copy was made from
+	 *
+	 * The renaming is injective and the copy has as many transitions and final
+	 * states as @p b, so it is enough that the copy contains the renamed ones.
+	 */
+	bool matches(const TA<T>& b) const
+	{
+		if ((b.getTransitions().size() != rhs_.getTransitions().size())
+			|| (b.getFinalStates().size() != rhs_.getFinalStates().size()))
+		{
+			return false;
+		}
+
+		for (size_t state : b.getFinalStates())
+		{
+			const std::pair<size_t, bool> renamed = index_.find(state);
+			if (!renamed.second || !rhs_.isFinalState(renamed.first))
+				return false;
+		}
+
+		std::vector<size_t> lhs;
+		for (const typename TA<T>::TransIDPair* trans : b.getTransitions())
+		{
+			const std::pair<size_t, bool> rhs = index_.find(trans->first.rhs());
+			if (!rhs.second)
+				return false;
+
+			lhs.clear();
+			for (size_t state : trans->first.lhs())
+			{
+				const std::pair<size_t, bool> renamed = index_.find(state);
+				if (!renamed.second)
+					return false;
+
+				lhs.push_back(renamed.first);
+			}
+
+			bool found = false;
+			for (typename TA<T>::trans_set_type::const_iterator i = rhs_._lookup(rhs.first);
+				(i != rhs_.getTransitions().end()) && ((*i)->first.rhs() == rhs.first); ++i)
+			{
+				if (((*i)->first.label() == trans->first.label()) && ((*i)->first.lhs() == lhs))
+				{
+					found = true;
 					break;
 				}
 			}
+
+			if (!found)
+				return false;
+		}
+
+		return true;
+	}
+
+public:   // methods
+
+	InclusionRhs() :
+		backend_{},
+		rhs_(backend_),
+		index_{}
+	{ }
+
+	/**
+	 * @brief  Returns the context of the current worker
+	 */
+	static InclusionRhs& get()
+	{
+		// every worker keeps its own right-hand side
+		static thread_local InclusionRhs rhs;
+		return rhs;
+	}
+
+	/**
+	 * @brief  Builds the union of the renamed right-hand side @p b and @p a
+	 *
+	 * @param[out]  dst  The union, an empty automaton in the backend of the
+	 *                   context (see @p backend())
+	 * @param[in]   a    The left-hand side
+	 * @param[in]   b    The right-hand side
+	 *
+	 * @returns  The number of states of @p b
+	 */
+	size_t unite(TA<T>& dst, const TA<T>& a, const TA<T>& b)
+	{
+		if (!this->matches(b))
+		{
+			rhs_.clear();
+			index_.clear();
+			TA<T>::reduce(rhs_, b, index_);
 		}
+
+		for (const typename TA<T>::TransIDPair* trans : rhs_.getTransitions())
+			dst.addTransition(trans);
+
+		dst.addFinalStates(rhs_.getFinalStates());
+
+		// the final states of the left-hand side are needed too, they are the
+		// accepting states of the counterexamples
+		Index<size_t> index;
+		TA<T>::reduce(dst, a, index, index_.size());
+
+		return index_.size();
 	}
+
+	typename TA<T>::Backend& backend()
+	{
+		return backend_;
+	}
+
+	/**
+	 * @brief  Forgets the right-hand side
+	 */
+	void clear()
+	{
+		rhs_.clear();
+		index_.clear();
+	}
+};
+} // namespace
+
+template <class T>
+TA<T>& TA<T>::minimizedCombo(TA<T>& dst) const
+{
+	Profiler::PhaseScope phase(Profiler::phase_e::minimization);
+
+	Index<size_t> stateIndex;
+	this->buildSortedStateIndex(stateIndex);
+	const CanonicalTA<T> canon(*this, stateIndex);
+	typename TA<T>::Backend backend;
+	BitMatrix dwn;
+	cachedDownwardSimulation(dwn, *this, stateIndex, canon);
+	BitMatrix up;
+	this->upwardSimulation(up, stateIndex, dwn);
+	BitMatrix rel;
+	TA<T>::combinedSimulation(rel, dwn, up);
+	TA<T> tmp(backend);
+	return this->collapsed(tmp, rel, stateIndex).minimized(dst);
+}
+
+template <class T>
+TA<T>& TA<T>::minimized(TA<T>& dst) const
+{
+	Profiler::PhaseScope phase(Profiler::phase_e::minimization);
+
+	Index<size_t> stateIndex;
+	this->buildSortedStateIndex(stateIndex);
+
+	if (!FA_MINIMIZATION_CACHE_BYTES)
+	{
+		BitMatrix dwn;
+		this->downwardSimulation(dwn, stateIndex);
+		return this->minimizedBy(dst, dwn, stateIndex);
+	}
+
+	const CanonicalTA<T> canon(*this, stateIndex);
+	if (!canon.valid())
+	{
+		BitMatrix dwn;
+		this->downwardSimulation(dwn, stateIndex);
+		return this->minimizedBy(dst, dwn, stateIndex);
+	}
+
+	typename MinimizationCache<T>::Entry& entry =
+		MinimizationCache<T>::lookup(canon.key());
+
+	if (!entry.hasMinimized)
+	{	// the minimisation picks the states that stay by their names, hence it is
+		// computed over the canonical states so that the memoised result is the
+		// same as the one of any renamed automaton
+		typename TA<T>::Backend backend;
+		TA<T> canonical(backend), tmp(backend);
+		CanonicalTA<T>::build(canonical, canon.key());
+
+		// the canonical states are the positions in the index
+		Index<size_t> canonicalIndex;
+		canonical.buildSortedStateIndex(canonicalIndex);
+
+		if (!entry.hasDwn)
+		{
+			canonical.downwardSimulation(entry.dwn, canonicalIndex);
+			entry.hasDwn = true;
+		}
+
+		canonical.minimizedBy(tmp, entry.dwn, canonicalIndex);
+		canon.store(entry.minimized, tmp);
+		entry.hasMinimized = true;
+		MinimizationCache<T>::updated(canon.key());
+	}
+
+	canon.restore(dst, entry.minimized);
+	return dst;
+}
+
+template <class T>
+void TA<T>::clearCaches()
+{
+	MinimizationCache<T>::get().clear();
+	InclusionRhs<T>::get().clear();
+}
+
+template <class T>
+size_t TA<T>::minimizationCacheSize()
+{
+	return MinimizationCache<T>::get().size();
 }
 
 template <class T>
 bool TA<T>::subseteq(const TA<T>& a, const TA<T>& b)
 {
-	return AntichainExt<T>::subseteq(a, b);
+	Profiler::PhaseScope phase(Profiler::phase_e::inclusion);
+
+	// the simulations of an empty union cannot be computed
+	if (a.getTransitions().empty())
+		return true;
+
+	InclusionRhs<T>& rhs = InclusionRhs<T>::get();
+	TA<T> c(rhs.backend());
+	const size_t countB = rhs.unite(c, a, b);
+
+	// the states of the union are numbered densely
+	Index<size_t> stateIndex;
+	c.buildStateIndex(stateIndex);
+	const size_t cSize = stateIndex.size();
+	stateIndex.clear();
+	for (size_t i = 0; i < cSize; ++i)
+		stateIndex.add(i);
+
+	// repeated checks of the same pair of automata reuse the simulations
+	const CanonicalTA<T> canon(c, stateIndex);
+	BitMatrix dwn, up, upDwn;
+	cachedInclusionSimulations(dwn, up, upDwn, c, stateIndex, canon);
+
+	return AntichainExt<T>::subseteq(c, countB, cSize, dwn, up, upDwn);
 }
 
 // this is really sad :-(
@@ -27,6 +27,11 @@
 #include <algorithm>
 #include <cassert>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+// Boost headers
+#include <boost/functional/hash.hpp>
 
 // Forester headers
 #include "cache.hh"
@@ -210,7 +215,7 @@ public:   // methods
 
 	bool llhsLessThan(
 		const TT&                                 rhs,
-		const std::vector<std::vector<bool>>&     cons,
+		const BitMatrix&                          cons,
 		const Index<size_t>&                      stateIndex) const
 	{
 		if (this->label() != rhs.label())
@@ -269,7 +274,82 @@ public:   // data types
 		}
 	};
 
-	typedef std::set<TransIDPair*, CmpF> trans_set_type;
+	/**
+	 * @brief  The set of transitions of an automaton
+	 *
+	 * The transitions are kept in a vector of pointers into the transition cache
+	 * sorted by @p CmpF, i.e. by the right-hand side first. Transitions with the
+	 * same right-hand side therefore form a contiguous range which can be found
+	 * by a binary search.
+	 */
+	class TransitionSet
+	{
+	private:  // data members
+
+		std::vector<TransIDPair*> items_;
+
+	public:   // data types
+
+		typedef typename std::vector<TransIDPair*>::const_iterator const_iterator;
+		typedef const_iterator iterator;
+
+	public:   // methods
+
+		TransitionSet() :
+			items_{}
+		{ }
+
+		const_iterator begin() const { return items_.begin(); }
+
+		const_iterator end() const { return items_.end(); }
+
+		size_t size() const { return items_.size(); }
+
+		bool empty() const { return items_.empty(); }
+
+		void clear() { items_.clear(); }
+
+		std::pair<const_iterator, bool> insert(TransIDPair* x)
+		{
+			typename std::vector<TransIDPair*>::iterator i;
+			if (items_.empty() || CmpF()(items_.back(), x))
+			{	// transitions are mostly added in order
+				i = items_.end();
+			} else
+			{
+				i = std::lower_bound(items_.begin(), items_.end(), x, CmpF());
+				if (!CmpF()(x, *i))
+					return std::make_pair(const_iterator(i), false);
+			}
+
+			return std::make_pair(const_iterator(items_.insert(i, x)), true);
+		}
+
+		/**
+		 * @brief  Finds the first transition with the given right-hand side
+		 */
+		const_iterator lowerBound(size_t rhs) const
+		{
+			return std::lower_bound(items_.begin(), items_.end(), rhs,
+				[](const TransIDPair* trans, size_t state){ return trans->first.rhs() < state; });
+		}
+
+		/**
+		 * @brief  Finds the first transition past the given right-hand side
+		 */
+		const_iterator upperBound(size_t rhs) const
+		{
+			return std::upper_bound(items_.begin(), items_.end(), rhs,
+				[](size_t state, const TransIDPair* trans){ return state < trans->first.rhs(); });
+		}
+
+		bool operator==(const TransitionSet& rhs) const
+		{
+			return items_ == rhs.items_;
+		}
+	};
+
+	typedef TransitionSet trans_set_type;
 
 	/**
 	 * @brief  Iterator over transitions
@@ -297,7 +377,147 @@ public:   // data types
 		bool operator!=(const Iterator& rhs) const { return this->_i != rhs._i; }
 	};
 
-	typedef typename std::unordered_map<size_t, std::vector<const Transition*>> td_cache_type;
+	/**
+	 * @brief  An index of transitions grouped by a key
+	 *
+	 * All transitions are stored in a single vector where transitions with the
+	 * same key form a contiguous range; the ranges are kept in a vector sorted
+	 * by the key and looked up by a binary search. The index refers to its own
+	 * storage and can therefore be moved but not copied.
+	 */
+	template <class K>
+	class TransitionIndex
+	{
+	public:   // data types
+
+		/**
+		 * @brief  A range of transitions sharing the same key
+		 */
+		class Range
+		{
+		private:  // data members
+
+			const Transition* const* begin_;
+			const Transition* const* end_;
+
+		public:   // data types
+
+			typedef const Transition* const* const_iterator;
+			typedef const_iterator iterator;
+
+		public:   // methods
+
+			Range(
+				const Transition* const*     begin = nullptr,
+				const Transition* const*     end = nullptr) :
+				begin_(begin),
+				end_(end)
+			{ }
+
+			const_iterator begin() const { return begin_; }
+
+			const_iterator end() const { return end_; }
+
+			const Transition* front() const
+			{
+				assert(begin_ != end_);
+				return *begin_;
+			}
+
+			size_t size() const { return end_ - begin_; }
+
+			bool empty() const { return begin_ == end_; }
+		};
+
+		typedef std::pair<K, Range> value_type;
+
+		typedef typename std::vector<value_type>::const_iterator const_iterator;
+		typedef const_iterator iterator;
+
+	private:  // data members
+
+		std::vector<const Transition*> items_;
+		std::vector<value_type> groups_;
+
+		static bool lessKey(const value_type& group, const K& key)
+		{
+			return group.first < key;
+		}
+
+	public:   // methods
+
+		TransitionIndex() :
+			items_{},
+			groups_{}
+		{ }
+
+		TransitionIndex(const TransitionIndex&) = delete;
+		TransitionIndex& operator=(const TransitionIndex&) = delete;
+
+		TransitionIndex(TransitionIndex&&) = default;
+		TransitionIndex& operator=(TransitionIndex&&) = default;
+
+		/**
+		 * @brief  Builds the index from a list of (key, transition) pairs
+		 *
+		 * The relative order of transitions with the same key is preserved.
+		 *
+		 * @param[in,out]  entries  The pairs to be indexed (sorted in place)
+		 */
+		void build(std::vector<std::pair<K, const Transition*>>& entries)
+		{
+			std::stable_sort(entries.begin(), entries.end(),
+				[](const std::pair<K, const Transition*>& lhs,
+					const std::pair<K, const Transition*>& rhs){ return lhs.first < rhs.first; });
+
+			items_.clear();
+			groups_.clear();
+			items_.reserve(entries.size());
+			for (const std::pair<K, const Transition*>& entry : entries)
+				items_.push_back(entry.second);
+
+			const Transition* const* base = items_.data();
+			for (size_t i = 0; i < entries.size(); )
+			{	// split the transitions into ranges of the same key
+				size_t j = i + 1;
+				while ((j < entries.size()) && !(entries[i].first < entries[j].first))
+					++j;
+				groups_.push_back(value_type(entries[i].first, Range(base + i, base + j)));
+				i = j;
+			}
+		}
+
+		const_iterator begin() const { return groups_.begin(); }
+
+		const_iterator end() const { return groups_.end(); }
+
+		size_t size() const { return groups_.size(); }
+
+		bool empty() const { return groups_.empty(); }
+
+		const_iterator find(const K& key) const
+		{
+			const_iterator i = std::lower_bound(groups_.begin(), groups_.end(), key,
+				&TransitionIndex::lessKey);
+			if ((i == groups_.end()) || (key < i->first))
+				return groups_.end();
+
+			return i;
+		}
+
+		/**
+		 * @brief  Retrieves the transitions with the given key
+		 *
+		 * @returns  The range of transitions (empty if there are none)
+		 */
+		Range group(const K& key) const
+		{
+			const_iterator i = this->find(key);
+			return (i == groups_.end())? Range() : i->second;
+		}
+	};
+
+	typedef TransitionIndex<size_t> td_cache_type;
 
 	class TDIterator
 	{
@@ -307,8 +527,8 @@ public:   // data types
 		std::set<size_t> visited_;
 		std::vector<
 			std::pair<
-				typename std::vector<const Transition*>::const_iterator,
-				typename std::vector<const Transition*>::const_iterator
+				typename td_cache_type::Range::const_iterator,
+				typename td_cache_type::Range::const_iterator
 			>
 		> stack_;
 
@@ -365,9 +585,9 @@ public:   // data types
 
 	};
 
-	typedef std::unordered_map<size_t, std::vector<const Transition*>> bu_cache_type;
+	typedef TransitionIndex<size_t> bu_cache_type;
 
-	typedef std::unordered_map<T, std::vector<const Transition*>> lt_cache_type;
+	typedef TransitionIndex<T> lt_cache_type;
 
 	typedef Iterator iterator;
 	typedef TDIterator td_iterator;
@@ -482,12 +702,7 @@ public:
 
 	typename trans_set_type::const_iterator _lookup(size_t rhs) const
 	{
-		char buffer[sizeof(std::pair<const Transition, size_t>)];
-		std::pair<const Transition, size_t>* tPtr = reinterpret_cast<std::pair<const Transition, size_t>*>(buffer);
-		new (reinterpret_cast<TTBase<T>*>(const_cast<Transition*>(&tPtr->first))) TTBase<T>(nullptr, T(), rhs);
-		typename trans_set_type::const_iterator i = this->transitions.lower_bound(tPtr);
-		(reinterpret_cast<TTBase<T>*>(const_cast<Transition*>(&tPtr->first)))->~TTBase();
-		return i;
+		return this->transitions.lowerBound(rhs);
 	}
 
 	typename TA<T>::Iterator begin(size_t rhs) const
@@ -497,9 +712,7 @@ public:
 
 	typename TA<T>::Iterator end(size_t rhs) const
 	{
-		typename TA<T>::Iterator i = this->begin(rhs);
-		for (; i != this->end() && i->rhs() == rhs; ++i);
-		return Iterator(i);
+		return Iterator(this->transitions.upperBound(rhs));
 	}
 
 	typename TA<T>::Iterator end(size_t rhs, typename TA<T>::Iterator i) const
@@ -656,40 +869,47 @@ public:
 	 */
 	td_cache_type buildTDCache() const
 	{
-		td_cache_type cache;
+		// the transitions are already sorted by their right-hand sides
+		std::vector<std::pair<size_t, const Transition*>> entries;
+		entries.reserve(this->transitions.size());
 		for (const TransIDPair* trans : this->transitions)
 		{	// insert all transitions
-			std::vector<const Transition*>& vec = cache.insert(std::make_pair(
-				trans->first.rhs(),
-				std::vector<const Transition*>())).first->second;
-			vec.push_back(&trans->first);
+			entries.push_back(std::make_pair(trans->first.rhs(), &trans->first));
 		}
 
+		td_cache_type cache;
+		cache.build(entries);
 		return cache;
 	}
 
 	void buildBUCache(bu_cache_type& cache) const
 	{
-		std::unordered_set<size_t> s;
+		std::vector<std::pair<size_t, const Transition*>> entries;
+		std::vector<size_t> s;
 		for (const TransIDPair* trans : this->transitions)
 		{
-			s.clear();
-			for (size_t state : trans->first.lhs())
+			s = trans->first.lhs();
+			std::sort(s.begin(), s.end());
+			s.erase(std::unique(s.begin(), s.end()), s.end());
+			for (size_t state : s)
 			{
-				if (s.insert(state).second)
-				{
-					cache.insert(std::make_pair(state, std::vector<const Transition*>())).first->second.push_back(&trans->first);
-				}
+				entries.push_back(std::make_pair(state, &trans->first));
 			}
 		}
+
+		cache.build(entries);
 	}
 
 	void buildLTCache(lt_cache_type& cache) const
 	{
+		std::vector<std::pair<T, const Transition*>> entries;
+		entries.reserve(this->transitions.size());
 		for (const TransIDPair* trans : this->transitions)
 		{
-			cache.insert(std::make_pair(trans->first.label(), std::vector<const Transition*>())).first->second.push_back(&trans->first);
+			entries.push_back(std::make_pair(trans->first.label(), &trans->first));
 		}
+
+		cache.build(entries);
 	}
 
 	const TransIDPair* addTransition(
@@ -814,26 +1034,26 @@ public:
 		const Index<T>&                           labelIndex) const;
 
 	void downwardSimulation(
-		std::vector<std::vector<bool>>&           rel,
+		BitMatrix&                                rel,
 		const Index<size_t>&                      stateIndex) const;
 
 	void upwardTranslation(
 		LTS&                                      lts,
 		std::vector<std::vector<size_t>>&         part,
-		std::vector<std::vector<bool>>&           rel,
+		BitMatrix&                                rel,
 		const Index<size_t>&                      stateIndex,
 		const Index<T>&                           labelIndex,
-		const std::vector<std::vector<bool>>&     sim) const;
+		const BitMatrix&                          sim) const;
 
 	void upwardSimulation(
-		std::vector<std::vector<bool>>&           rel,
+		BitMatrix&                                rel,
 		const Index<size_t>&                      stateIndex,
-		const std::vector<std::vector<bool>>&     param) const;
+		const BitMatrix&                          param) const;
 
 	static void combinedSimulation(
-		std::vector<std::vector<bool>>&           dst,
-		const std::vector<std::vector<bool>>&     dwn,
-		const std::vector<std::vector<bool>>&     up);
+		BitMatrix&                                dst,
+		const BitMatrix&                          dwn,
+		const BitMatrix&                          up);
 
 	template <class F>
 	static size_t buProduct(
@@ -852,9 +1072,9 @@ public:
 			if (j == cache2.end())
 				continue;
 
-			for (typename std::vector<const Transition*>::const_iterator k = i->second.begin(); k != i->second.end(); ++k)
+			for (typename lt_cache_type::Range::const_iterator k = i->second.begin(); k != i->second.end(); ++k)
 			{
-				for (typename std::vector<const Transition*>::const_iterator l = j->second.begin(); l != j->second.end(); ++l)
+				for (typename lt_cache_type::Range::const_iterator l = j->second.begin(); l != j->second.end(); ++l)
 				{
 					std::pair<std::unordered_map<std::pair<size_t, size_t>, size_t, boost::hash<std::pair<size_t, size_t>>>::iterator, bool> p =
 						product.insert(std::make_pair(std::make_pair((*k)->rhs(), (*l)->rhs()), product.size() + stateOffset));
@@ -873,9 +1093,9 @@ public:
 				typename lt_cache_type::const_iterator j = cache2.find(i->first);
 				if (j == cache2.end())
 					continue;
-				for (typename std::vector<const Transition*>::const_iterator k = i->second.begin(); k != i->second.end(); ++k)
+				for (typename lt_cache_type::Range::const_iterator k = i->second.begin(); k != i->second.end(); ++k)
 				{
-					for (typename std::vector<const Transition*>::const_iterator l = j->second.begin(); l != j->second.end(); ++l)
+					for (typename lt_cache_type::Range::const_iterator l = j->second.begin(); l != j->second.end(); ++l)
 					{
 						assert((*k)->lhs().size() == (*l)->lhs().size());
 						std::vector<size_t> lhs;
@@ -977,105 +1197,94 @@ public:
 
 
 	/**
-	 * @brief  Determines whether two transitions match
+	 * @brief  Computes the classes of states of finite height abstraction
+	 *
+	 * This method refines the partition @p classes of states (indexed by @p
+	 * stateIndex) so that two states end up in the same class iff they are
+	 * indistinguishable up to @p height, i.e. all transitions leading to any of
+	 * them have the same key given by the functor @p f and lead from states that
+	 * are in the same classes up to @p height - 1. A state with transitions of
+	 * different keys therefore forms a class of its own. The partition is
+	 * refined one level at a time, each level costing a single pass over the
+	 * transitions, and the refinement stops early once a level does not split
+	 * any class.
 	 *
-	 * This function determines whether two transitions match (and can therefore
-	 * e.g. be merged during abstraction). First, the @p funcMatch functor is used
-	 * to determine whether the transitions are to be checked at all.
+	 * @param[in,out]  classes     The class of each state (by its index)
+	 * @param[in]      height      The height of the abstraction
+	 * @param[in]      f           Functor giving the key of a transition
+	 * @param[in]      stateIndex  The index of states
 	 */
 	template <class F>
-	static bool transMatch(
-		const Transition*                         t1,
-		const Transition*                         t2,
-		F                                         funcMatch,
-		const std::vector<std::vector<bool>>&     mat,
-		const Index<size_t>&                      stateIndex)
-	{
-		// Preconditions
-		assert((nullptr != t1) && (nullptr != t2));
-
-		if (!funcMatch(*t1, *t2))
-			return false;
-
-		if (t1->lhs().size() != t2->lhs().size())
-			return false;
-
-		for (size_t m = 0; m < t1->lhs().size(); ++m)
-		{
-			if (!mat[stateIndex[t1->lhs()[m]]][stateIndex[t2->lhs()[m]]])
-			{
-				return false;
-			}
-		}
-
-		return true;
-	}
-
-
-	// currently erases '1' from the relation
-	template <class F>
 	void heightAbstraction(
-		std::vector<std::vector<bool>>&            result,
+		std::vector<size_t>&                       classes,
 		size_t                                     height,
 		F                                          f,
 		const Index<size_t>&                       stateIndex) const
 	{
+		// Assertions
+		assert(classes.size() == stateIndex.size());
+
 		td_cache_type cache = this->buildTDCache();
 
-		std::vector<std::vector<bool>> tmp;
+		typedef std::unordered_map<std::vector<size_t>, size_t,
+			boost::hash<std::vector<size_t>>> key_map_type;
+
+		key_map_type keys;
+		std::vector<size_t> tmp(classes.size());
+		std::vector<size_t> key, transKey;
+		size_t classCount = std::set<size_t>(classes.begin(), classes.end()).size();
 
 		while (height--)
 		{
-			tmp = result;
+			keys.clear();
+			size_t fresh = 0;
 
 			for (Index<size_t>::iterator i = stateIndex.begin(); i != stateIndex.end(); ++i)
 			{
-				const size_t& state1 = i->second;
-				typename td_cache_type::iterator j = cache.insert(
-					std::make_pair(i->first, std::vector<const Transition*>())
-				).first;
-				for (Index<size_t>::iterator k = stateIndex.begin(); k != stateIndex.end(); ++k)
+				key.assign(1, classes[i->second]);
+				bool uniform = true;
+				for (const Transition* trans : cache.group(i->first))
 				{
-					const size_t& state2 = k->second;
-					if ((state1 == state2) || !tmp[state1][state2])
-						continue;
-					typename td_cache_type::iterator l = cache.insert(
-						std::make_pair(k->first, std::vector<const Transition*>())
-					).first;
-					bool match = true;
-					for (const Transition* trans1 : j->second)
+					transKey.assign(1, f(*trans));
+					for (size_t state : trans->lhs())
+						transKey.push_back(classes[stateIndex[state]]);
+
+					if (1 == key.size())
 					{
-						for (const Transition* trans2 : l->second)
-						{
-							if (!TA<T>::transMatch(trans1, trans2, f, tmp, stateIndex))
-							{
-								match = false;
-								break;
-							}
-						}
-						if (!match)
-							break;
+						key.insert(key.end(), transKey.begin(), transKey.end());
+					}
+					else if ((transKey.size() + 1 != key.size())
+						|| !std::equal(transKey.begin(), transKey.end(), key.begin() + 1))
+					{
+						uniform = false;
+						break;
 					}
-					if (!match)
-						result[state1][state2] = false;
 				}
-			}
-		}
 
-		for (size_t i = 0; i < result.size(); ++i)
-		{
-			for (size_t j = 0; j < i; ++j)
-			{
-				if (!result[i][j])
-					result[j][i] = false;
-				if (!result[j][i])
-					result[i][j] = false;
+				if (uniform)
+				{
+					tmp[i->second] = keys.insert(
+						std::make_pair(key, keys.size())
+					).first->second;
+				}
+				else
+				{	// the state is distinguished from all other states
+					tmp[i->second] = static_cast<size_t>(-1) - fresh++;
+				}
 			}
+
+			classes.swap(tmp);
+
+			// classes are only split, hence the same count means the same partition
+			if (keys.size() + fresh == classCount)
+				break;
+
+			classCount = keys.size() + fresh;
 		}
 	}
 
 	void predicateAbstraction(
-		std::vector<std::vector<bool>>&      result,
+		BitMatrix&                           result,
 		const TA<T>&                         predicate,
 		const Index<size_t>&                 stateIndex) const
 	{
@@ -1104,15 +1313,21 @@ public:
 	// collapses states according to a given relation
 	TA<T>& collapsed(
 		TA<T>&                                   dst,
-		const std::vector<std::vector<bool>>&    rel,
+		const BitMatrix&                         rel,
 		const Index<size_t>&                     stateIndex) const
 	{
 		std::vector<size_t> headIndex;
 		utils::relBuildClasses(rel, headIndex);
 
-		std::ostringstream os;
-		utils::printCont(os, headIndex);
+		return this->collapsed(dst, std::move(headIndex), stateIndex);
+	}
 
+	// collapses every state (by its index) into the head of its class
+	TA<T>& collapsed(
+		TA<T>&                                   dst,
+		std::vector<size_t>                      headIndex,
+		const Index<size_t>&                     stateIndex) const
+	{
 		// TODO: perhaps improve indexing
 		std::vector<size_t> invStateIndex(stateIndex.size());
 		for (Index<size_t>::iterator i = stateIndex.begin(); i != stateIndex.end(); ++i)
@@ -1288,7 +1503,7 @@ public:
 
 	TA<T>& downwardSieve(
 		TA<T>&                                    dst,
-		const std::vector<std::vector<bool>>&     cons,
+		const BitMatrix&                          cons,
 		const Index<size_t>&                      stateIndex) const
 	{
 		td_cache_type cache = this->buildTDCache();
@@ -1296,10 +1511,10 @@ public:
 		for (size_t state : finalStates_)
 			dst.addFinalState(state);
 
-		for (typename td_cache_type::iterator i = cache.begin(); i != cache.end(); ++i)
+		for (typename td_cache_type::const_iterator i = cache.begin(); i != cache.end(); ++i)
 		{
 			std::list<const Transition*> tmp;
-			for (typename std::vector<const Transition*>::iterator j = i->second.begin(); j != i->second.end(); ++j)
+			for (typename td_cache_type::Range::const_iterator j = i->second.begin(); j != i->second.end(); ++j)
 			{
 				bool noskip = true;
 				for (typename std::list<const Transition*>::iterator k = tmp.begin(); k != tmp.end(); )
@@ -1324,41 +1539,55 @@ public:
 		return dst;
 	}
 
-	TA<T>& minimized(
+	/**
+	 * @brief  Minimises the automaton using the given downward simulation
+	 */
+	TA<T>& minimizedBy(
 		TA<T>&                                   dst,
-		const std::vector<std::vector<bool>>&    cons,
+		const BitMatrix&                         dwn,
 		const Index<size_t>&                     stateIndex) const
 	{
 		typename TA<T>::Backend backend;
-		std::vector<std::vector<bool>> dwn;
-		this->downwardSimulation(dwn, stateIndex);
-		utils::relAnd(dwn, cons, dwn);
 		TA<T> tmp1(backend), tmp2(backend), tmp3(backend);
 		return this->collapsed(tmp1, dwn, stateIndex).uselessFree(tmp2).downwardSieve(tmp3, dwn, stateIndex).unreachableFree(dst);
 	}
 
-	TA<T>& minimizedCombo(TA<T>& dst) const
+	TA<T>& minimized(
+		TA<T>&                                   dst,
+		const BitMatrix&                         cons,
+		const Index<size_t>&                     stateIndex) const
 	{
-		Index<size_t> stateIndex;
-		this->buildSortedStateIndex(stateIndex);
-		typename TA<T>::Backend backend;
-		std::vector<std::vector<bool> > dwn;
+		BitMatrix dwn;
 		this->downwardSimulation(dwn, stateIndex);
-		std::vector<std::vector<bool> > up;
-		this->upwardSimulation(up, stateIndex, dwn);
-		std::vector<std::vector<bool> > rel;
-		TA<T>::combinedSimulation(rel, dwn, up);
-		TA<T> tmp(backend);
-		return this->collapsed(tmp, rel, stateIndex).minimized(dst);
+		utils::relAnd(dwn, cons, dwn);
+		return this->minimizedBy(dst, dwn, stateIndex);
 	}
 
-	TA<T>& minimized(TA<T>& dst) const
-	{
-		Index<size_t> stateIndex;
-		this->buildSortedStateIndex(stateIndex);
-		std::vector<std::vector<bool> > cons(stateIndex.size(), std::vector<bool>(stateIndex.size(), true));
-		return this->minimized(dst, cons, stateIndex);
-	}
+	TA<T>& minimizedCombo(TA<T>& dst) const;
+
+	/**
+	 * @brief  Minimises the automaton
+	 *
+	 * The results (and the downward simulations) are memoised for automata
+	 * that are equal up to renaming of states, see FA_MINIMIZATION_CACHE_BYTES.
+	 */
+	TA<T>& minimized(TA<T>& dst) const;
+
+	/**
+	 * @brief  Forgets the minimisations, the simulations and the right-hand
+	 *         side of the last inclusion check memoised by the current thread
+	 *
+	 * The memoised automata refer to the labels of the box manager they were
+	 * built with, hence the caches need to be cleared before the box manager
+	 * is destroyed (the caches of a worker are destroyed with its thread).
+	 */
+	static void clearCaches();
+
+	/**
+	 * @brief  The number of automata (up to renaming of states) memoised by
+	 *         the current thread
+	 */
+	static size_t minimizationCacheSize();
 
 	static bool subseteq(const TA<T>& a, const TA<T>& b);
 
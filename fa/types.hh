@@ -21,6 +21,7 @@
 #define TYPES_H
 
 // Standard library headers
+#include <atomic>
 #include <string>
 #include <ostream>
 #include <cassert>
@@ -196,6 +197,33 @@ struct Data
 	 */
 	typedef std::pair<size_t /* offset */, Data> item_info;
 
+	/**
+	 * @brief  Nested data of a structure
+	 *
+	 * The nested data are immutable and shared (with reference counting) by all
+	 * copies of a structure value, so that a structure is copied and hashed in
+	 * constant time.
+	 */
+	struct StructItems
+	{
+		/// the number of values sharing the nested data
+		std::atomic<size_t> refCnt;
+
+		/// the hash of the nested data
+		const size_t hash;
+
+		/// the nested data
+		const std::vector<item_info> items;
+
+		StructItems(
+			const std::vector<item_info>&      items,
+			size_t                             hash) :
+			refCnt(1),
+			hash(hash),
+			items(items)
+		{ }
+	};
+
 	/// The type of the data
 	data_type_e type;
 
@@ -216,7 +244,7 @@ struct Data
 
 		int		d_int;                        ///< value of represented integer
 		bool	d_bool;                       ///< value of represented Boolean
-		std::vector<item_info>* d_struct;   ///< nested data types for structure
+		StructItems* d_struct;              ///< nested data types for structure
 	};
 
 	/**
@@ -259,7 +287,8 @@ struct Data
 			case data_type_e::t_bool:
 				this->d_bool = data.d_bool; break;
 			case data_type_e::t_struct:
-				this->d_struct = new std::vector<item_info>(*data.d_struct); break;
+				this->d_struct = data.d_struct;
+				++this->d_struct->refCnt; break;
 			default: break;
 		}
 	}
@@ -284,6 +313,11 @@ struct Data
 	{
 		if (this == &rhs) { return *this; }
 
+		if (data_type_e::t_struct == rhs.type)
+		{	// the nested data may be released by clear() otherwise
+			++rhs.d_struct->refCnt;
+		}
+
 		this->clear();
 		this->type = rhs.type;
 		this->size = rhs.size;
@@ -304,7 +338,7 @@ struct Data
 			case data_type_e::t_bool:
 				this->d_bool = rhs.d_bool; break;
 			case data_type_e::t_struct:
-				this->d_struct = new std::vector<item_info>(*rhs.d_struct); break;
+				this->d_struct = rhs.d_struct; break;
 			default: break;
 		}
 
@@ -378,7 +412,8 @@ struct Data
 		const std::vector<item_info>&      items = std::vector<item_info>())
 	{
 		Data data(data_type_e::t_struct);
-		data.d_struct = new std::vector<item_info>(items);
+		data.d_struct = new StructItems(
+			items, boost::hash_range(items.begin(), items.end()));
 		return data;
 	}
 
@@ -487,7 +522,9 @@ struct Data
 	{
 		if (this->type == data_type_e::t_struct)
 		{
-			delete this->d_struct;
+			if (0 == --this->d_struct->refCnt)
+				delete this->d_struct;
+
 			this->d_struct = nullptr;
 		}
 
@@ -638,12 +675,12 @@ struct Data
 	 *
 	 * @returns  Selectors of the structure
 	 */
-	std::vector<item_info>& GetStruct() const
+	const std::vector<item_info>& GetStruct() const
 	{
 		// Assertions
 		assert(data_type_e::t_struct == this->type);
 		assert(nullptr != this->d_struct);
-		return *this->d_struct;
+		return this->d_struct->items;
 	}
 
 	/**
@@ -682,7 +719,7 @@ struct Data
 				boost::hash_combine(seed, v.d_bool);
 				break;
 			case data_type_e::t_struct:
-				boost::hash_combine(seed, *v.d_struct);
+				boost::hash_combine(seed, v.d_struct->hash);
 				break;
 			case data_type_e::t_other:
 				boost::hash_combine(seed, v.d_void_ptr_size);
@@ -727,7 +764,9 @@ struct Data
 			case data_type_e::t_bool:
 				return this->d_bool == rhs.d_bool;
 			case data_type_e::t_struct:
-				return *this->d_struct == *rhs.d_struct;
+				return (this->d_struct == rhs.d_struct)
+					|| ((this->d_struct->hash == rhs.d_struct->hash)
+						&& (this->d_struct->items == rhs.d_struct->items));
 			default:
 				return false;
 		}
@@ -779,7 +818,7 @@ struct Data
 				os << "(bool)" << x.d_bool; break;
 			case data_type_e::t_struct:
 				os << "{ ";
-				for (auto i = x.d_struct->begin(); i != x.d_struct->end(); ++i) {
+				for (auto i = x.d_struct->items.begin(); i != x.d_struct->items.end(); ++i) {
 					os << '+' << i->first << ':' << i->second << ' ';
 				}
 				os << "}";
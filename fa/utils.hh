@@ -28,6 +28,9 @@
 #include <unordered_set>
 #include <vector>
 
+// Forester headers
+#include "bitmatrix.hh"
+
 template <class T>
 struct Index
 {
@@ -313,7 +316,7 @@ public:
 	 *                        with the index of the first equivalent element
 	 */
 	static void relBuildClasses(
-		const std::vector<std::vector<bool>>&        rel,
+		const BitMatrix&                             rel,
 		std::vector<size_t>&                         headIndex)
 	{
 		headIndex.resize(rel.size());
@@ -323,7 +326,7 @@ public:
 			bool found = false;
 			for (size_t j = 0; j < head.size(); ++j)
 			{
-				if (rel[i][head[j]] && rel[head[j]][i])
+				if (rel.get(i, head[j]) && rel.get(head[j], i))
 				{
 					headIndex[i] = head[j];
 					found = true;
@@ -341,7 +344,7 @@ public:
 #if 0
 	// build equivalence classes
 	static void relBuildClasses(
-		const std::vector<std::vector<bool>>&  rel,
+		const BitMatrix&                       rel,
 		std::vector<size_t>&                   index,
 		std::vector<size_t>&                   head)
 	{
@@ -369,32 +372,24 @@ public:
 #endif
 
 	// and composition
-	static void relAnd(std::vector<std::vector<bool> >& dst, const std::vector<std::vector<bool> >& src1, const std::vector<std::vector<bool> >& src2) {
-		dst.resize(src1.size(), std::vector<bool>(src1.size()));
-		for (size_t i = 0; i < src1.size(); ++i) {
-			for (size_t j = 0; j < src1.size(); ++j)
-				dst[i][j] = src1[i][j] && src2[i][j];
+	static void relAnd(BitMatrix& dst, const BitMatrix& src1, const BitMatrix& src2) {
+		if (&dst == &src2) {
+			dst &= src1;
+			return;
 		}
+		if (&dst != &src1)
+			dst = src1;
+		dst &= src2;
 	}
 
 	// transposition
-	static void relInv(std::vector<std::vector<bool> >& dst, const std::vector<std::vector<bool> >& src) {
-		dst.resize(src.size(), std::vector<bool>(src.size()));
-		for (size_t i = 0; i < src.size(); ++i) {
-			for (size_t j = 0; j < src.size(); ++j)
-				dst[j][i] = src[i][j];
-		}
+	static void relInv(BitMatrix& dst, const BitMatrix& src) {
+		src.transpose(dst);
 	}
 
 	// relation index
-	static void relIndex(std::vector<std::vector<size_t> >& dst, const std::vector<std::vector<bool> >& src) {
-		dst.resize(src.size());
-		for (size_t i = 0; i < src.size(); ++i) {
-			for (size_t j = 0; j < src.size(); ++j) {
-				if (src[i][j])
-					dst[i].push_back(j);
-			}
-		}
+	static void relIndex(std::vector<std::vector<size_t> >& dst, const BitMatrix& src) {
+		src.buildIndex(dst);
 	}
 
 	// intersection	
@@ -473,13 +468,8 @@ public:
 	}
 
 	// print
-	static std::ostream& relPrint(std::ostream& os, const std::vector<std::vector<bool> >& src) {
-		for (size_t i = 0; i < src.size(); ++i) {
-			for (size_t j = 0; j < src.size(); ++j)
-				os << src[i][j];
-			os << std::endl;
-		}
-		return os;
+	static std::ostream& relPrint(std::ostream& os, const BitMatrix& src) {
+		return os << src;
 	}
 
 	template <class T>
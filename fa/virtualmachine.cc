@@ -26,7 +26,7 @@ void VirtualMachine::transitionLookup(
 	const std::vector<size_t>&     offsets,
 	Data&                          data) const
 {
-	data = Data::createStruct();
+	std::vector<Data::item_info> items;
 
 	// for every offset, add an item
 	for (size_t off : offsets)
@@ -35,15 +35,17 @@ void VirtualMachine::transitionLookup(
 		// Assertions
 		assert(VirtualMachine::isSelectorWithOffset(ni.aBox, off + base));
 
-		const Data* tmp = nullptr;
+		Data tmp;
 		if (!fae_.isData(transition.lhs()[ni.offset], tmp))
 		{
 			throw std::runtime_error("transitionLookup(): destination is not a leaf!");
 		}
-		data.d_struct->push_back(Data::item_info(off, *tmp));
+		items.push_back(Data::item_info(off, tmp));
 		VirtualMachine::displToData(VirtualMachine::readSelector(ni.aBox),
-			data.d_struct->back().second);
+			items.back().second);
 	}
+
+	data = Data::createStruct(items);
 }
 
 
@@ -57,13 +59,13 @@ void VirtualMachine::transitionLookup(
 	// Assertions
 	assert(VirtualMachine::isSelectorWithOffset(ni.aBox, offset));
 
-	const Data* tmp = nullptr;
+	Data tmp;
 	if (!fae_.isData(transition.lhs()[ni.offset], tmp))
 	{
 		throw std::runtime_error("transitionLookup(): destination is not a leaf!");
 	}
 
-	data = *tmp;
+	data = tmp;
 	VirtualMachine::displToData(VirtualMachine::readSelector(ni.aBox), data);
 }
 
@@ -87,13 +89,13 @@ void VirtualMachine::transitionModify(
 	// Assertions
 	assert(VirtualMachine::isSelectorWithOffset(ni.aBox, offset));
 
-	const Data* tmp = nullptr;
+	Data tmp;
 	if (!fae_.isData(transition.lhs()[ni.offset], tmp))
 	{
 		throw std::runtime_error("transitionModify(): destination is not a leaf!");
 	}
 
-	out = *tmp;
+	out = tmp;
 	SelData s = VirtualMachine::readSelector(ni.aBox);
 	VirtualMachine::displToData(s, out);
 	Data d = in;
@@ -121,7 +123,7 @@ void VirtualMachine::transitionModify(
 	// Get the label
 	std::vector<const AbstractBox*> label = transition.label()->getNode();
 
-	out = Data::createStruct();
+	std::vector<Data::item_info> items;
 	for (const std::pair<size_t, Data>& sel : in)
 	{
 		// Retrieve the item with the given offset
@@ -129,21 +131,23 @@ void VirtualMachine::transitionModify(
 		// Assertions
 		assert(VirtualMachine::isSelectorWithOffset(ni.aBox, sel.first + base));
 
-		const Data* tmp = nullptr;
+		Data tmp;
 		if (!fae_.isData(transition.lhs()[ni.offset], tmp))
 		{
 			throw std::runtime_error("transitionModify(): destination is not a leaf!");
 		}
 
-		out.d_struct->push_back(Data::item_info(sel.first, *tmp));
+		items.push_back(Data::item_info(sel.first, tmp));
 		SelData s = VirtualMachine::readSelector(ni.aBox);
-		VirtualMachine::displToData(s, out.d_struct->back().second);
+		VirtualMachine::displToData(s, items.back().second);
 		Data d = sel.second;
 		VirtualMachine::displToSel(s, d);
 		lhs[ni.offset] = fae_.addData(dst, d);
 		label[ni.index] = fae_.boxMan->getSelector(s);
 	}
 
+	out = Data::createStruct(items);
+
 	FAE::reorderBoxes(label, lhs);
 	dst.addTransition(lhs, fae_.boxMan->lookupLabel(label), state);
 }
@@ -265,7 +269,7 @@ void VirtualMachine::nodeModifyMultiple(
 
 	TreeAut ta(*fae_.backend);
 	this->transitionModify(ta, fae_.getRoot(root)->getAcceptingTransition(),
-		offset, *in.d_struct, out);
+		offset, in.GetStruct(), out);
 	fae_.getRoot(root)->copyTransitions(ta);
 	TreeAut* tmp = fae_.allocTA();
 	ta.unreachableFree(*tmp);
@@ -285,9 +289,9 @@ void VirtualMachine::getNearbyReferences(
 	const Transition& t = fae_.getRoot(root)->getAcceptingTransition();
 	for (size_t state : t.lhs())
 	{
-		const Data* data = nullptr;
-		if (fae_.isData(state, data) && data->isRef())
-			out.insert(data->d_ref.root);
+		Data data;
+		if (fae_.isData(state, data) && data.isRef())
+			out.insert(data.d_ref.root);
 	}
 }
 
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of forester.
+ *
+ * forester is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * forester is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with forester.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WORKER_MUTEX_H
+#define WORKER_MUTEX_H
+
+/**
+ * @file workermutex.hh
+ * WorkerMutex - a mutex guarding data shared by the workers of the analysis
+ */
+
+// Standard library headers
+#include <mutex>
+
+/**
+ * @brief  A mutex guarding data shared by the workers of the analysis
+ *
+ * The mutex is recursive as the guarded structures call back into themselves
+ * (e.g. the listeners of a @p Cache).  It is locked only while several workers
+ * are running (see @p setConcurrent()), a single worker needs no locking.
+ */
+class WorkerMutex
+{
+	std::recursive_mutex mutex_;
+
+	static bool& concurrent()
+	{
+		static bool concurrent = false;
+		return concurrent;
+	}
+
+public:   // methods
+
+	WorkerMutex() :
+		mutex_{}
+	{ }
+
+	WorkerMutex(const WorkerMutex&) = delete;
+	WorkerMutex& operator=(const WorkerMutex&) = delete;
+
+	/**
+	 * @brief  Switches the locking of all worker mutexes on or off
+	 *
+	 * It is to be called by the thread that runs the workers, before it starts
+	 * the other workers and after it has joined them, i.e. while no mutex is
+	 * locked.
+	 *
+	 * @param[in]  concurrent  Are several workers going to run?
+	 */
+	static void setConcurrent(bool concurrent)
+	{
+		WorkerMutex::concurrent() = concurrent;
+	}
+
+	void lock()
+	{
+		if (concurrent())
+			mutex_.lock();
+	}
+
+	void unlock()
+	{
+		if (concurrent())
+			mutex_.unlock();
+	}
+};
+
+/**
+ * @brief  A scoped lock of a @p WorkerMutex
+ */
+typedef std::lock_guard<WorkerMutex> WorkerLock;
+
+#endif
@@ -27,6 +27,7 @@
 
 #include "fixed_point_proxy.hh"
 #include "glconf.hh"
+#include "plotwriter.hh"
 #include "symbt.hh"
 #include "symdump.hh"
 #include "symexec.hh"
@@ -206,5 +207,8 @@ void clEasyRun(const CodeStorage::Storage &stor, const char *configString)
         printMemUsage("Trace::Globals::cleanup");
     }
 
+    // wait for the plots being written in background (if any)
+    PlotWriter::cleanup();
+
     printPeakMemUsage();
 }
@@ -93,6 +93,15 @@
  */
 #define SE_ABSTRACT_ON_LOOP_EDGES_ONLY      1
 
+/**
+ * adaptive join/abstraction policy driven by the growth of per-block states
+ * - 0 ... disabled, the policy is fixed by SE_JOIN_ON_LOOP_EDGES_ONLY etc.
+ * - N ... once a block holds N heaps (or has been updated 4*N times), join and
+ *         abstract on all edges entering the block; on reaching 2*N heaps (or
+ *         8*N updates), use SE_COST0_LEN_THR for abstraction paths of any cost
+ */
+#define SE_ADAPTIVE_POLICY_THR              0
+
 /**
  * if 1, allow to replace already referenced trace graph nodes (creates cycles)
  */
@@ -225,6 +234,13 @@
  */
 #define SE_INT_ARITHMETIC_LIMIT             10
 
+/**
+ * - 0 ... widen integral ranges up to the limits allowed by SE_ALLOW_INT_RANGES
+ * - 1 ... on loop-closing edges, widen integral ranges to the nearest constant
+ *         found in the conditions of the loop instead [experimental]
+ */
+#define SE_INT_RANGE_WIDENING               0
+
 /**
  * - 0 ... join states on each basic block entry
  * - 1 ... join only when traversing a loop-closing edge, entailment otherwise
@@ -258,6 +274,11 @@
  */
 #define SE_RESTRICT_SLS_MINLEN              2
 
+/**
+ * if 1, SymHeapUnion skips heaps with a different canonical hash on lookup
+ */
+#define SE_STATE_HASHING                    1
+
 /**
  * - 0 ... do not try to optimize the order of heaps in SymState containers
  * - 1 ... reorder heaps in SymStateWithJoin based on hit ratio
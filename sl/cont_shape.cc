@@ -454,7 +454,7 @@ void detectImpliedShapes(DetectionCtx &ctx)
     ImpliedShapeDetector shapeDetector(/* useHeadChk */ anyVars);
 
     for (unsigned i = 0U; i < ctx.cntHeaps; ++i) {
-        SymHeap &sh = const_cast<SymHeap &>(ctx.srcState[i]);
+        SymHeap &sh = ctx.srcState.writable(i);
         const TShapeList &apparentShapes = ctx.dstArray[i];
 
         BOOST_FOREACH(const Shape &shape, apparentShapes)
@@ -462,7 +462,7 @@ void detectImpliedShapes(DetectionCtx &ctx)
     }
 
     for (unsigned i = 0U; i < ctx.cntHeaps; ++i) {
-        SymHeap &sh = const_cast<SymHeap &>(ctx.srcState[i]);
+        SymHeap &sh = ctx.srcState.writable(i);
         shapeDetector.appendImpliedShapes(&ctx.dstArray[i], sh);
     }
 }
@@ -484,7 +484,7 @@ void detectLocalContShapes(TShapeListByHeapIdx *pDst, const SymState &state)
     bool foundApparentShape = false;
     for (unsigned i = 0U; i < cnt; ++i) {
         TShapeList &dst = ctx.dstArray[i];
-        SymHeap &src = const_cast<SymHeap &>(state[i]);
+        SymHeap &src = state.writable(i);
 
         detectApparentShapes(dst, src);
         if (dst.empty())
@@ -25,15 +25,16 @@
 #include "adt_op_match.hh"
 #include "cont_shape_seq.hh"
 #include "fixed_point.hh"
+#include "plotwriter.hh"
 #include "symplot.hh"
 
 #include <cl/cl_msg.hh>
 #include <cl/cldebug.hh>
 #include <cl/storage.hh>
 
-#include <fstream>
 #include <iomanip>
 #include <map>
+#include <sstream>
 
 #include <boost/foreach.hpp>
 
@@ -269,13 +270,9 @@ void plotFnc(const TFnc fnc, StateByInsn::TStateMap &stateByInsn)
     std::string plotName("fp-");
     plotName += fncName;
 
-    // create a dot file
+    // render the graph in memory, PlotWriter takes care of the file I/O
     const std::string fileName(plotName + ".dot");
-    std::fstream out(fileName.c_str(), std::ios::out);
-    if (!out) {
-        CL_ERROR("unable to create file '" << fileName << "'");
-        return;
-    }
+    std::ostringstream out;
 
     // open graph
     out << "digraph " << QUOT(plotName)
@@ -290,9 +287,9 @@ void plotFnc(const TFnc fnc, StateByInsn::TStateMap &stateByInsn)
 
     // close graph
     out << "}\n";
-    if (!out)
-        CL_ERROR("unable to write file '" << fileName << "'");
-    out.close();
+
+    std::string contents(out.str());
+    PlotWriter::instance()->write(fileName, contents);
 }
 
 void StateByInsn::plotAll()
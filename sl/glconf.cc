@@ -100,6 +100,22 @@ void handleOOM(const string &name, const string &value)
     data.oomSimulation = true;
 }
 
+void handlePlotArchive(const string &name, const string &value)
+{
+    if (value.empty()) {
+        CL_WARN("ignoring option \"" << name << "\" without a valid value");
+        return;
+    }
+
+    data.plotArchive = value;
+}
+
+void handlePlotAsync(const string &name, const string &value)
+{
+    assumeNoValue(name, value);
+    data.asyncPlots = true;
+}
+
 void handleTrackUninit(const string &name, const string &value)
 {
     assumeNoValue(name, value);
@@ -114,6 +130,8 @@ ConfigStringParser::ConfigStringParser()
     tbl_["no_error_recovery"]       = handleNoErrorRecovery;
     tbl_["no_plot"]                 = handleNoPlot;
     tbl_["oom"]                     = handleOOM;
+    tbl_["plot_archive"]            = handlePlotArchive;
+    tbl_["plot_async"]              = handlePlotAsync;
     tbl_["track_uninit"]            = handleTrackUninit;
 }
 
@@ -35,6 +35,8 @@ struct Options {
     bool oomSimulation;     ///< enable/disable @b oom @b simulation mode
     bool memLeakIsError;    ///< treat memory leak as an error
     bool skipUserPlots;     ///< ignore all ___sl_plot*() calls
+    bool asyncPlots;        ///< write plots by a background thread
+    std::string plotArchive;///< if not empty, bundle all plots into this file
     int errorRecoveryMode;  ///< @copydoc config.h::SE_ERROR_RECOVERY_MODE
     std::string errLabel;   ///< if not empty, treat reaching the label as error
     FixedPoint::StateByInsn *fixedPoint;  ///< fixed-point plotter (0 if unused)
@@ -44,6 +46,7 @@ struct Options {
         oomSimulation(false),
         memLeakIsError(false),
         skipUserPlots(false),
+        asyncPlots(false),
         errorRecoveryMode(SE_ERROR_RECOVERY_MODE),
         fixedPoint(0)
     {
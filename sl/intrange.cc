@@ -165,6 +165,27 @@ TUInt widthOf(const Range &range)
     return /* closed interval */ 1UL + range.hi - range.lo;
 }
 
+TInt thresholdAbove(const TIntSet &thrs, const TInt num)
+{
+    const TIntSet::const_iterator it = thrs.lower_bound(num);
+    if (thrs.end() == it)
+        return IntMax;
+
+    CL_BREAK_IF(RZ_CORRUPTION(*it));
+    return *it;
+}
+
+TInt thresholdBelow(const TIntSet &thrs, const TInt num)
+{
+    TIntSet::const_iterator it = thrs.upper_bound(num);
+    if (thrs.begin() == it)
+        return IntMin;
+
+    --it;
+    CL_BREAK_IF(RZ_CORRUPTION(*it));
+    return *it;
+}
+
 TInt invertInt(const TInt num)
 {
     CL_BREAK_IF(RZ_CORRUPTION(num));
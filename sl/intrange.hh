@@ -22,6 +22,8 @@
 
 #include "config.h"
 
+#include <set>
+
 namespace IR {
 
 #ifdef USE_LONG_LONG
@@ -166,6 +168,15 @@ void adjustAlignment(Range *);
 /// return the count of integral numbers that the given range represents
 TUInt widthOf(const Range &);
 
+/// set of integral numbers, used as thresholds for widening of ranges
+typedef std::set<TInt>              TIntSet;
+
+/// return the least threshold not below num, IntMax if there is no such one
+TInt thresholdAbove(const TIntSet &thrs, TInt num);
+
+/// return the greatest threshold not above num, IntMin if there is no such one
+TInt thresholdBelow(const TIntSet &thrs, TInt num);
+
 } // namespace IR
 
 #endif /* H_GUARD_INTRANGE_H */
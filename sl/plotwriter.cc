@@ -0,0 +1,432 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "plotwriter.hh"
+
+#include <cl/cl_msg.hh>
+
+#include "glconf.hh"
+
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/foreach.hpp>
+
+#ifndef HAVE_ZLIB
+#   define HAVE_ZLIB 0
+#endif
+
+#if HAVE_ZLIB
+#   include <zlib.h>
+#endif
+
+/// the amount of rendered plots in bytes we allow to wait for being written
+#define PLOT_WRITER_QUEUE_LIMIT             (0x4000000UL)
+
+// /////////////////////////////////////////////////////////////////////////////
+// implementation of TarArchive
+class TarArchive {
+    public:
+        TarArchive():
+#if HAVE_ZLIB
+            gz_(0)
+#else
+            fp_(0)
+#endif
+        {
+        }
+
+        ~TarArchive() {
+            this->close();
+        }
+
+        bool open(const std::string &fileName);
+        bool append(const std::string &name, const std::string &contents);
+        bool close();
+
+    private:
+        // not implemented
+        TarArchive(const TarArchive &);
+        TarArchive& operator=(const TarArchive &);
+
+        bool writeRaw(const char *buf, size_t len);
+        bool writePadded(const char *buf, size_t len);
+        bool writeHeader(const std::string &name, size_t size, char type);
+
+#if HAVE_ZLIB
+        gzFile      gz_;
+#else
+        FILE       *fp_;
+#endif
+};
+
+bool TarArchive::open(const std::string &fileName)
+{
+#if HAVE_ZLIB
+    gz_ = gzopen(fileName.c_str(), "wb");
+    return !!gz_;
+#else
+    fp_ = fopen(fileName.c_str(), "wb");
+    return !!fp_;
+#endif
+}
+
+bool TarArchive::writeRaw(const char *buf, const size_t len)
+{
+#if HAVE_ZLIB
+    const int cnt = gzwrite(gz_, buf, len);
+    return (static_cast<size_t>(cnt) == len);
+#else
+    return (len == fwrite(buf, 1, len, fp_));
+#endif
+}
+
+bool TarArchive::writePadded(const char *buf, const size_t len)
+{
+    static const char zeros[/* tar block size */ 0x200] = { 0 };
+    const size_t tail = len % sizeof zeros;
+
+    return this->writeRaw(buf, len)
+        && (!tail || this->writeRaw(zeros, sizeof zeros - tail));
+}
+
+bool TarArchive::writeHeader(
+        const std::string          &name,
+        const size_t                size,
+        const char                  type)
+{
+    char hdr[/* tar block size */ 0x200];
+    memset(hdr, 0, sizeof hdr);
+
+    // the name is truncated if too long, see the GNU long name entry below
+    strncpy(hdr, name.c_str(), /* name */ 99);
+    sprintf(hdr + /* mode  */ 100, "%07o", 0644);
+    sprintf(hdr + /* uid   */ 108, "%07o", 0);
+    sprintf(hdr + /* gid   */ 116, "%07o", 0);
+    sprintf(hdr + /* size  */ 124, "%011lo", static_cast<unsigned long>(size));
+    sprintf(hdr + /* mtime */ 136, "%011lo", 0UL);
+    hdr[/* type */ 156] = type;
+    memcpy(hdr + /* magic + version */ 257, "ustar  ", 8);
+
+    // compute the checksum with the chksum field filled by spaces
+    memset(hdr + /* chksum */ 148, ' ', 8);
+    unsigned sum = 0U;
+    for (unsigned i = 0U; i < sizeof hdr; ++i)
+        sum += static_cast<unsigned char>(hdr[i]);
+    sprintf(hdr + /* chksum */ 148, "%06o", sum);
+
+    return this->writeRaw(hdr, sizeof hdr);
+}
+
+bool TarArchive::append(const std::string &name, const std::string &contents)
+{
+    if (99 < name.size()) {
+        // GNU extension for file names that do not fit into the header
+        const size_t len = name.size() + /* NUL */ 1;
+        if (!this->writeHeader("././@LongLink", len, 'L')
+                || !this->writePadded(name.c_str(), len))
+            return false;
+    }
+
+    return this->writeHeader(name, contents.size(), /* regular file */ '0')
+        && this->writePadded(contents.data(), contents.size());
+}
+
+bool TarArchive::close()
+{
+    bool ok = true;
+
+#if HAVE_ZLIB
+    if (!gz_)
+        return ok;
+#else
+    if (!fp_)
+        return ok;
+#endif
+
+    // end of archive is marked by two empty blocks
+    static const char zeros[/* 2x tar block size */ 0x400] = { 0 };
+    if (!this->writeRaw(zeros, sizeof zeros))
+        ok = false;
+
+#if HAVE_ZLIB
+    if (Z_OK != gzclose(gz_))
+        ok = false;
+    gz_ = 0;
+#else
+    if (fclose(fp_))
+        ok = false;
+    fp_ = 0;
+#endif
+    return ok;
+}
+
+// /////////////////////////////////////////////////////////////////////////////
+// implementation of PlotWriter
+PlotWriter *PlotWriter::inst_ = 0;
+
+struct PlotWriter::Private {
+    struct TItem {
+        std::string                 fileName;
+        std::string                 contents;
+        std::string                 what;       ///< to be noted once written
+    };
+
+    typedef std::deque<TItem>                                           TQueue;
+    typedef std::vector<std::string>                                    TNames;
+
+    bool                            async;
+    TarArchive                     *archive;
+    std::string                     archiveName;
+
+    // the following members are shared with the background thread
+    std::thread                     worker;
+    std::mutex                      mutex;
+    std::condition_variable         cvWork;
+    std::condition_variable         cvDone;
+    TQueue                          queue;
+    size_t                          queuedBytes;
+    bool                            busy;
+    bool                            shutdown;
+    TNames                          failures;
+    TNames                          notes;
+
+    Private():
+        async(false),
+        archive(0),
+        queuedBytes(0UL),
+        busy(false),
+        shutdown(false)
+    {
+    }
+
+    bool store(const std::string &fileName, const std::string &contents);
+    void run();
+    bool reportStatus();
+};
+
+/// the note to be printed once the plot has been successfully written
+static std::string noteOf(const std::string &what, const std::string &fileName)
+{
+    return what + " dumped to '" + fileName + "'";
+}
+
+bool PlotWriter::Private::store(
+        const std::string          &fileName,
+        const std::string          &contents)
+{
+    if (this->archive)
+        return this->archive->append(fileName, contents);
+
+    std::fstream out(fileName.c_str(), std::ios::out);
+    if (!out)
+        return false;
+
+    // the file is written successfully only if it is also closed successfully
+    out << contents;
+    out.close();
+    return !out.fail();
+}
+
+void PlotWriter::Private::run()
+{
+    TQueue batch;
+    TNames failed;
+    TNames written;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            while (this->queue.empty() && !this->shutdown)
+                this->cvWork.wait(lock);
+
+            if (this->queue.empty())
+                // shutdown requested and nothing left to write
+                return;
+
+            // take all the pending plots at once
+            batch.swap(this->queue);
+            this->queuedBytes = 0UL;
+            this->busy = true;
+        }
+
+        // let the analysis continue while we are writing the batch
+        this->cvDone.notify_all();
+
+        BOOST_FOREACH(const TItem &item, batch) {
+            if (!this->store(item.fileName, item.contents))
+                failed.push_back(item.fileName);
+            else if (!item.what.empty())
+                written.push_back(noteOf(item.what, item.fileName));
+        }
+
+        batch.clear();
+
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->failures.insert(this->failures.end(),
+                    failed.begin(), failed.end());
+            this->notes.insert(this->notes.end(),
+                    written.begin(), written.end());
+            this->busy = false;
+        }
+
+        failed.clear();
+        written.clear();
+        this->cvDone.notify_all();
+    }
+}
+
+/// @note to be called on the analysis thread only, with no lock being held
+bool PlotWriter::Private::reportStatus()
+{
+    TNames failed;
+    TNames written;
+    {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        failed.swap(this->failures);
+        written.swap(this->notes);
+    }
+
+    BOOST_FOREACH(const std::string &note, written)
+        CL_NOTE(note);
+
+    BOOST_FOREACH(const std::string &fileName, failed)
+        CL_ERROR("unable to write file '" << fileName << "'");
+
+    return failed.empty();
+}
+
+PlotWriter::PlotWriter():
+    d(new Private)
+{
+    d->async = GlConf::data.asyncPlots;
+
+    const std::string &archiveName = GlConf::data.plotArchive;
+    if (archiveName.empty())
+        return;
+
+    d->archive = new TarArchive;
+    if (d->archive->open(archiveName)) {
+        d->archiveName = archiveName;
+        return;
+    }
+
+    CL_ERROR("unable to create file '" << archiveName
+            << "', plots will be written to separate files");
+
+    delete d->archive;
+    d->archive = 0;
+}
+
+PlotWriter::~PlotWriter()
+{
+    if (d->worker.joinable()) {
+        {
+            std::unique_lock<std::mutex> lock(d->mutex);
+            d->shutdown = true;
+        }
+
+        d->cvWork.notify_all();
+        d->worker.join();
+    }
+
+    d->reportStatus();
+
+    if (d->archive) {
+        if (d->archive->close())
+            CL_NOTE("plots archived to '" << d->archiveName << "'");
+        else
+            CL_ERROR("unable to write file '" << d->archiveName << "'");
+
+        delete d->archive;
+    }
+
+    delete d;
+}
+
+bool PlotWriter::write(
+        const std::string          &fileName,
+        std::string                &contents,
+        const std::string          &what)
+{
+    if (!d->async) {
+        if (d->store(fileName, contents)) {
+            contents.clear();
+            if (!what.empty())
+                CL_NOTE(noteOf(what, fileName));
+
+            return true;
+        }
+
+        CL_ERROR("unable to write file '" << fileName << "'");
+        return false;
+    }
+
+    if (!d->worker.joinable())
+        // start the background thread on the first use
+        d->worker = std::thread(&Private::run, d);
+
+    {
+        std::unique_lock<std::mutex> lock(d->mutex);
+
+        // do not let the rendered plots eat up all the memory
+        while (PLOT_WRITER_QUEUE_LIMIT < d->queuedBytes)
+            d->cvDone.wait(lock);
+
+        d->queuedBytes += contents.size();
+        d->queue.push_back(Private::TItem());
+        Private::TItem &item = d->queue.back();
+        item.fileName = fileName;
+        item.contents.swap(contents);
+        item.what = what;
+    }
+
+    d->cvWork.notify_one();
+    return d->reportStatus();
+}
+
+bool PlotWriter::flush()
+{
+    if (d->worker.joinable()) {
+        std::unique_lock<std::mutex> lock(d->mutex);
+        while (!d->queue.empty() || d->busy)
+            d->cvDone.wait(lock);
+    }
+
+    return d->reportStatus();
+}
+
+bool PlotWriter::cleanup()
+{
+    if (!inst_)
+        return true;
+
+    const bool ok = inst_->flush();
+    delete inst_;
+    inst_ = 0;
+    return ok;
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is part of predator.
+ *
+ * predator is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * predator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with predator.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef H_GUARD_PLOT_WRITER_H
+#define H_GUARD_PLOT_WRITER_H
+
+/**
+ * @file plotwriter.hh
+ * PlotWriter - stores the already rendered graphs, possibly in background
+ */
+
+#include <string>
+
+/**
+ * singleton that takes care of writing the rendered plots to disk
+ *
+ * By default, each plot is written synchronously to a file of its own.  If
+ * asked to do so (see GlConf::Options), the plots are handed over to a
+ * background thread, which writes them in batches so that the analysis does
+ * not need to wait for the file I/O.  Optionally, all the plots can be bundled
+ * into a single (compressed, if available) tar archive.
+ *
+ * The heaps are still rendered on the analysis thread because SymHeap (and
+ * the trace graph it refers to) is not safe to be accessed concurrently.
+ */
+class PlotWriter {
+    public:
+        static PlotWriter* instance() {
+            return (inst_)
+                ? (inst_)
+                : (inst_ = new PlotWriter);
+        }
+
+        /// wait for all pending plots to be written, then destroy the instance
+        static bool cleanup();
+
+        /**
+         * store the given contents to a file named fileName
+         * @param contents the contents to write, cleared (swapped) by the call
+         * @param what if not empty, a note "<what> dumped to '<fileName>'" is
+         * printed as soon as the file has been successfully written
+         * @return false if the file has been written synchronously and failed,
+         * or if any of the plots written in background failed so far
+         */
+        bool write(
+                const std::string          &fileName,
+                std::string                &contents,
+                const std::string          &what = std::string());
+
+        /// block until all pending plots are written, report their status
+        bool flush();
+
+    private:
+        static PlotWriter *inst_;
+        PlotWriter();
+        ~PlotWriter();
+
+        // not implemented
+        PlotWriter(const PlotWriter &);
+        PlotWriter& operator=(const PlotWriter &);
+
+    private:
+        struct Private;
+        Private *d;
+};
+
+#endif /* H_GUARD_PLOT_WRITER_H */
@@ -450,13 +450,13 @@ TMinLen spliceOutSegmentIfNeeded(
     return 0;
 }
 
-void abstractIfNeeded(SymHeap &sh)
+void abstractIfNeeded(SymHeap &sh, const bool eager)
 {
 #if SE_DISABLE_SLS && SE_DISABLE_DLS
     return;
 #endif
     Shape shape;
-    while (discoverBestAbstraction(&shape, sh)) {
+    while (discoverBestAbstraction(&shape, sh, eager)) {
         if (!applyAbstraction(sh, shape))
             // the best abstraction given is unfortunately not good enough
             break;
@@ -67,8 +67,9 @@ void dlSegReplaceByConcrete(SymHeap &sh, TObjId seg);
  * analyze the given symbolic heap and consider abstraction of some shapes that
  * we know ho to rewrite to their more abstract way of existence
  * @param sh an instance of symbolic heap, used in read/write mode
+ * @param eager if true, abstract also the paths that are too short otherwise
  */
-void abstractIfNeeded(SymHeap &sh);
+void abstractIfNeeded(SymHeap &sh, bool eager = false);
 
 /// enable/disable debugging of symabstract
 void debugSymAbstract(bool enable);
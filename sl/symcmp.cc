@@ -27,6 +27,9 @@
 #include "util.hh"
 #include "worklist.hh"
 
+#include <map>
+#include <queue>
+
 #include <boost/foreach.hpp>
 #include <boost/tuple/tuple.hpp>
 
@@ -346,3 +349,171 @@ bool areEqual(
     return sh1.matchPreds(sh2, vMap[0])
         && sh2.matchPreds(sh1, vMap[1]);
 }
+
+// /////////////////////////////////////////////////////////////////////////////
+// implementation of canonHash()
+class CanonHashBuilder {
+    private:
+        typedef std::map<TValId /* root */, int /* canonical ID */> TRootMap;
+        typedef std::pair<TOffset, TValId>                          TPtrField;
+        typedef std::vector<TPtrField>                              TPtrList;
+
+        SymHeap                &sh_;
+        TRootMap                rootMap_;
+        TObjSet                 seen_;
+        std::queue<TObjId>      sched_;
+        TCanonHash              hash_;
+        bool                    ambiguous_;
+
+    public:
+        CanonHashBuilder(SymHeap &sh):
+            sh_(sh),
+            hash_(/* FNV-1a offset basis */ 0xcbf29ce484222325ULL),
+            ambiguous_(false)
+        {
+        }
+
+        TCanonHash run();
+
+    private:
+        void append(long num);
+        void appendRoot(TObjId obj);
+        void appendPtr(TOffset off, TValId val);
+        void schedule(TObjId obj);
+        void digFields(TObjId obj);
+};
+
+void CanonHashBuilder::append(const long num)
+{
+    TCanonHash word = static_cast<TCanonHash>(num);
+
+    // FNV-1a, byte by byte
+    for (unsigned i = 0U; i < sizeof word; ++i, word >>= 8) {
+        hash_ ^= (word & 0xFFULL);
+        hash_ *= /* FNV prime */ 0x100000001b3ULL;
+    }
+}
+
+void CanonHashBuilder::schedule(const TObjId obj)
+{
+    if (insertOnce(seen_, obj))
+        sched_.push(obj);
+}
+
+/// the properties checked by matchRoots() except for uniform blocks
+void CanonHashBuilder::appendRoot(const TObjId obj)
+{
+    const TSizeRange size = sh_.objSize(obj);
+    this->append(size.lo);
+    this->append(size.hi);
+    this->append(sh_.objProtoLevel(obj));
+
+    const EObjKind kind = sh_.objKind(obj);
+    this->append(kind);
+    if (OK_REGION == kind)
+        return;
+
+    this->append(sh_.segMinLength(obj));
+    if (OK_OBJ_OR_NULL == kind)
+        return;
+
+    const BindingOff &bf = sh_.segBinding(obj);
+    this->append(bf.head);
+    this->append(bf.next);
+    this->append(bf.prev);
+}
+
+void CanonHashBuilder::appendPtr(const TOffset off, const TValId val)
+{
+    this->append(off);
+    this->append(sh_.targetSpec(val));
+    this->append(sh_.valOffset(val));
+
+    // renumber the roots in the order we see them (as mapBidir() does)
+    const TValId root = sh_.valRoot(val);
+    const int id = rootMap_.size();
+    const std::pair<TRootMap::iterator, bool> ret =
+        rootMap_.insert(std::make_pair(root, id));
+
+    this->append(ret.first->second);
+    if (!ret.second)
+        // already seen
+        return;
+
+    const TObjId obj = sh_.objByAddr(val);
+    this->appendRoot(obj);
+    this->schedule(obj);
+}
+
+void CanonHashBuilder::digFields(const TObjId obj)
+{
+    FldTable tab;
+    sh_.gatherLiveFields(tab, obj);
+
+    // we are interested in valid pointers only, see the dox of canonHash()
+    TPtrList ptrs;
+    for (unsigned i = 0U; i < tab.size(); ++i) {
+        const TValId val = tab.flds[i].value();
+        if (0 < val && isPossibleToDeref(sh_, val))
+            ptrs.push_back(TPtrField(tab.offs[i], val));
+    }
+
+    // the table is sorted by offsets already
+    const unsigned cnt = ptrs.size();
+    for (unsigned i = 0U; i < cnt; ++i) {
+        const TOffset off = ptrs[i].first;
+        if (i && off == ptrs[i - 1U].first) {
+            // multiple pointers at the same offset, their order would depend
+            // on value IDs, which would break the canonical form
+            ambiguous_ = true;
+            return;
+        }
+
+        this->appendPtr(off, ptrs[i].second);
+    }
+
+    // delimit the fields of this object from the fields of the next one
+    this->append(-1L);
+}
+
+TCanonHash CanonHashBuilder::run()
+{
+    // start with program variables (std::set keeps them sorted by IDs)
+    TCVarSet vars;
+    gatherProgramVars(vars, sh_);
+    BOOST_FOREACH(const CVar &cv, vars) {
+        this->append(cv.uid);
+        this->append(cv.inst);
+
+        const TObjId reg = sh_.regionByVar(cv, /* createIfNeeded */ false);
+        this->schedule(reg);
+    }
+
+    // OBJ_RETURN is left out on purpose, areEqual() compares it as soon as
+    // any of the two heaps has it, so it may be missing in one of equal heaps
+
+    // BFS through the objects reachable from the program variables
+    while (!ambiguous_ && !sched_.empty()) {
+        const TObjId obj = sched_.front();
+        sched_.pop();
+        this->digFields(obj);
+    }
+
+    if (ambiguous_)
+        return CanonHashAny;
+
+    if (CanonHashAny == hash_ || CanonHashUnknown == hash_)
+        // keep the reserved values reserved
+        hash_ += 2ULL;
+
+    return hash_;
+}
+
+TCanonHash canonHash(const SymHeap &sh)
+{
+    // regionByVar() is not available for const heaps
+    SymHeap &shWritable = const_cast<SymHeap &>(sh);
+
+    CanonHashBuilder builder(shWritable);
+    return builder.run();
+}
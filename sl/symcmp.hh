@@ -37,6 +37,41 @@ bool areEqual(
         const SymHeap           &sh1,
         const SymHeap           &sh2);
 
+/// hash of the canonical form of a symbolic heap, see canonHash()
+typedef unsigned long long                                  TCanonHash;
+
+/// hash of a heap with ambiguous canonical form, it is compatible with any hash
+const TCanonHash CanonHashAny                             = 0ULL;
+
+/// canonHash() never returns this value, it can be used to mark a missing hash
+const TCanonHash CanonHashUnknown                         = 1ULL;
+
+/**
+ * compute a hash of the given heap that does not depend on the IDs of objects
+ * and values in the heap
+ *
+ * The heap is traversed in a deterministic order, starting from the program
+ * variables sorted by their IDs, and the objects are renumbered in the order
+ * they are first reached.  Only the shape of the heap (objects reachable via
+ * valid pointers and their properties) is hashed.  The object holding the
+ * return value is not taken as a starting point.  Integral values, uniform
+ * blocks, and predicates are left out because areEqual() does not require
+ * them to be represented the same way in both heaps.  Hence areEqual() implies
+ * matching hashes but not vice versa, so the hash can be used only to rule out
+ * heaps that cannot be equal.
+ *
+ * @return CanonHashAny if the canonical order is ambiguous for the given heap
+ */
+TCanonHash canonHash(const SymHeap &sh);
+
+/// return false if the heaps of the given hashes cannot be equal to each other
+inline bool matchCanonHashes(const TCanonHash h1, const TCanonHash h2)
+{
+    return (h1 == h2)
+        || (CanonHashAny == h1)
+        || (CanonHashAny == h2);
+}
+
 inline bool checkNonPosValues(int a, int b)
 {
     if (0 < a && 0 < b)
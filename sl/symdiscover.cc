@@ -606,7 +606,8 @@ typedef std::vector<SegCandidate> TSegCandidateList;
 bool selectBestAbstraction(
         Shape                      *pDst,
         SymHeap                    &sh,
-        const TSegCandidateList    &candidates)
+        const TSegCandidateList    &candidates,
+        const bool                  eager)
 {
     const unsigned cnt = candidates.size();
     if (!cnt)
@@ -642,7 +643,7 @@ bool selectBestAbstraction(
                     cost += (SE_COST_OF_SEG_INTRODUCTION);
 #endif
 
-                if (len < minLengthByCost(cost))
+                if (len < minLengthByCost((eager) ? /* cost */ 0 : cost))
                     // too short path at this cost level
                     continue;
 
@@ -675,7 +676,7 @@ bool selectBestAbstraction(
     return true;
 }
 
-bool discoverBestAbstraction(Shape *pDst, SymHeap &sh)
+bool discoverBestAbstraction(Shape *pDst, SymHeap &sh, const bool eager)
 {
     TSegCandidateList candidates;
 
@@ -695,5 +696,5 @@ bool discoverBestAbstraction(Shape *pDst, SymHeap &sh)
         candidates.push_back(segc);
     }
 
-    return selectBestAbstraction(pDst, sh, candidates);
+    return selectBestAbstraction(pDst, sh, candidates, eager);
 }
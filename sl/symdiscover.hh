@@ -44,8 +44,9 @@ bool canMergeObjWithNextObj(
 /**
  * Take the given symbolic heap and look for the best possible abstraction in
  * there.  If nothing is found, zero is returned.  Otherwise it returns total
- * length of the best possible abstraction.
+ * length of the best possible abstraction.  If eager is true, the length
+ * threshold for paths with zero cost is used for paths of any cost.
  */
-bool discoverBestAbstraction(Shape *pDst, SymHeap &sh);
+bool discoverBestAbstraction(Shape *pDst, SymHeap &sh, bool eager = false);
 
 #endif /* H_GUARD_SYMDISCOVER_H */
@@ -38,6 +38,7 @@
 #include "symtrace.hh"
 #include "util.hh"
 
+#include <map>
 #include <queue>
 #include <set>
 #include <sstream>
@@ -156,6 +157,22 @@ class SymExecEngine: public IStatsProvider {
         SymHeapList                     nextLocalState_;
         SymHeapList                     callResults_;
         const struct cl_loc             *lw_;
+        IR::TIntSet                     loopThresholds_;
+
+        /// state of the adaptive join/abstraction policy for a basic block
+        struct BlockPolicy {
+            int                         level;
+            unsigned                    cntUpdates;
+
+            BlockPolicy():
+                level(0),
+                cntUpdates(0U)
+            {
+            }
+        };
+
+        typedef std::map<const CodeStorage::Block *, BlockPolicy> TPolicyMap;
+        TPolicyMap                      policyMap_;
 
     private:
         void initEngine(const SymHeap &init);
@@ -164,6 +181,8 @@ class SymExecEngine: public IStatsProvider {
 
         void updateState(SymHeap &sh, const CodeStorage::Block *ofBlock);
 
+        void updatePolicy(const CodeStorage::Block *bb, bool changed);
+
         void updateStateInBranch(
                 SymHeap                             sh,
                 const bool                          branch,
@@ -197,6 +216,62 @@ class SymExecEngine: public IStatsProvider {
 
 // /////////////////////////////////////////////////////////////////////////////
 // SymExecEngine implementation
+#if SE_INT_RANGE_WIDENING
+/**
+ * gather the integral constants that the comparisons in bb compare against,
+ * together with their neighbors (the bound of a strict and a non-strict
+ * comparison differs by one), the neighbors are omitted on overflow
+ */
+static void collectCmpThresholds(
+        IR::TIntSet                     &dst,
+        const CodeStorage::Block        *bb)
+{
+    BOOST_FOREACH(const CodeStorage::Insn *insn, *bb) {
+        if (CL_INSN_BINOP != insn->code)
+            continue;
+
+        CmpOpTraits cTraits;
+        const enum cl_binop_e code = static_cast<enum cl_binop_e>(insn->subCode);
+        if (!describeCmpOp(&cTraits, code))
+            // not a comparison
+            continue;
+
+        for (unsigned idx = /* src1 */ 1; idx <= /* src2 */ 2; ++idx) {
+            const struct cl_operand &op = insn->operands[idx];
+            if (CL_OPERAND_CST != op.code || CL_TYPE_INT != op.data.cst.code)
+                continue;
+
+            // the bound itself and its neighbors (strict/non-strict compare)
+            const IR::TInt num = intCstFromOperand(&op);
+            if (IR::IntMin < num)
+                dst.insert(num - IR::Int1);
+
+            dst.insert(num);
+
+            if (num < IR::IntMax)
+                dst.insert(num + IR::Int1);
+        }
+    }
+}
+
+/// gather integral constants used in conditions of the loops of the function
+static void collectLoopThresholds(
+        IR::TIntSet                     &dst,
+        const CodeStorage::Fnc          &fnc)
+{
+    BOOST_FOREACH(const CodeStorage::Block *bb, fnc.cfg) {
+        const CodeStorage::Insn *term = bb->back();
+        if (term->loopClosingTargets.empty())
+            continue;
+
+        // the block closing the loop and the blocks the loop starts with
+        collectCmpThresholds(dst, bb);
+        BOOST_FOREACH(const unsigned idxTarget, term->loopClosingTargets)
+            collectCmpThresholds(dst, term->targets[idxTarget]);
+    }
+}
+#endif
+
 void SymExecEngine::initEngine(const SymHeap &init)
 {
     // look for fnc name
@@ -209,6 +284,10 @@ void SymExecEngine::initEngine(const SymHeap &init)
     CL_BREAK_IF(CL_TYPE_FNC != fncType->code || fncType->item_cnt < 1);
     fncReturnType_ = fncType->items[/* ret */ 0].type;
 
+#if SE_INT_RANGE_WIDENING
+    collectLoopThresholds(loopThresholds_, fnc);
+#endif
+
     // look for the entry block
     const CodeStorage::Block *entry = fnc.cfg.entry();
     if (!entry) {
@@ -290,6 +369,34 @@ bool isLoopClosingEdge(
     return false;
 }
 
+void SymExecEngine::updatePolicy(
+        const CodeStorage::Block            *bb,
+        const bool                          changed)
+{
+    BlockPolicy &bp = policyMap_[bb];
+    if (changed)
+        ++bp.cntUpdates;
+
+    const unsigned thr = (SE_ADAPTIVE_POLICY_THR);
+    const unsigned cntHeaps = stateMap_[bb].size();
+
+    int level = 0;
+    if (2 * thr <= cntHeaps || 8 * thr <= bp.cntUpdates)
+        level = 2;
+    else if (thr <= cntHeaps || 4 * thr <= bp.cntUpdates)
+        level = 1;
+
+    if (level <= bp.level)
+        // we never switch back to a more precise policy
+        return;
+
+    bp.level = level;
+    CL_DEBUG_MSG(&bb->front()->loc, "-A- block " << bb->name()
+            << " escalated to join/abstraction policy level " << level
+            << ", " << cntHeaps << " heap(s) total"
+            << ", " << bp.cntUpdates << " update(s)");
+}
+
 void SymExecEngine::updateState(SymHeap &sh, const CodeStorage::Block *ofBlock)
 {
     const std::string &name = ofBlock->name();
@@ -298,18 +405,40 @@ void SymExecEngine::updateState(SymHeap &sh, const CodeStorage::Block *ofBlock)
     if (closingLoop)
         CL_DEBUG_MSG(lw_, "-L- traversing a loop-closing edge");
 
+#if SE_INT_RANGE_WIDENING
+    // widen integral ranges by thresholds only when closing a loop
+    const IR::TIntSet *thresholds = (closingLoop)
+        ? &loopThresholds_
+        : /* no widening by thresholds */ 0;
+#else
+    const IR::TIntSet *thresholds = 0;
+#endif
+
+#if SE_ADAPTIVE_POLICY_THR
+    // treat all edges entering a block with exploding state as loop-closing
+    const int level = policyMap_[ofBlock].level;
+    if (level)
+        closingLoop = true;
+#else
+    const int level = 0;
+#endif
+
     // time to consider abstraction
 #if SE_ABSTRACT_ON_LOOP_EDGES_ONLY
     if (closingLoop)
 #endif
-        abstractIfNeeded(sh);
+        abstractIfNeeded(sh, /* eager */ (1 < level));
 
 #if !SE_JOIN_ON_LOOP_EDGES_ONLY
     closingLoop = true;
 #endif
 
     // update _target_ state and check if anything has changed
-    if (stateMap_.insert(ofBlock, sh, closingLoop)) {
+    const bool changed = stateMap_.insert(ofBlock, sh, closingLoop, thresholds);
+#if SE_ADAPTIVE_POLICY_THR
+    this->updatePolicy(ofBlock, changed);
+#endif
+    if (changed) {
         const SymStateMarked &target = stateMap_[ofBlock];
 
         // schedule for next wheel (if not already)
@@ -874,6 +1003,19 @@ void SymExecEngine::printStats() const
         this->printStatsHelper(bb);
     }
 
+    // print the decisions taken by the adaptive join/abstraction policy
+    BOOST_FOREACH(TPolicyMap::const_reference item, policyMap_) {
+        const BlockPolicy &bp = item.second;
+        if (!bp.level)
+            continue;
+
+        const CodeStorage::Block *bb = item.first;
+        CL_NOTE_MSG(&bb->front()->loc,
+                "___ block " << bb->name()
+                << " uses join/abstraction policy level " << bp.level
+                << ", " << bp.cntUpdates << " update(s) so far");
+    }
+
     // TODO: a separate compile-time option for this?
 #if DEBUG_SE_END_NOT_REACHED
     // finally print the statistics provided by BlockScheduler
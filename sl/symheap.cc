@@ -1798,6 +1798,66 @@ void SymHeapCore::gatherLiveFields(FldList &dst, TObjId obj) const
     }
 }
 
+void SymHeapCore::gatherLiveFields(FldTable &dst, TObjId obj) const
+{
+    CL_BREAK_IF(dst.size());
+
+    const Region *regData;
+    d->ents.getEntRO(&regData, obj);
+
+    // read offset and type of each field directly from its entity
+    typedef std::pair<TOffset, TObjType>            TKey;
+    typedef std::pair<TKey, TFldId>                 TItem;
+    std::vector<TItem> items;
+    items.reserve(regData->liveFields.size());
+    BOOST_FOREACH(TLiveObjs::const_reference item, regData->liveFields) {
+        const EBlockKind code = item.second;
+
+        switch (code) {
+            case BK_UNIFORM:
+                continue;
+
+            case BK_FIELD:
+                break;
+
+            case BK_INVALID:
+            default:
+                CL_BREAK_IF("gatherLiveFields sees something special");
+        }
+
+        const TFldId fld = item.first;
+        const FieldOfObj *fldData;
+        d->ents.getEntRO(&fldData, fld);
+        items.push_back(TItem(TKey(fldData->off, fldData->clt), fld));
+    }
+
+    std::sort(items.begin(), items.end());
+
+    // export the sorted fields as parallel arrays
+    const unsigned cnt = items.size();
+    dst.offs.reserve(cnt);
+    dst.types.reserve(cnt);
+    dst.flds.reserve(cnt);
+
+    SymHeapCore &writable = *const_cast<SymHeapCore *>(this);
+    BOOST_FOREACH(const TItem &item, items) {
+        dst.offs.push_back(item.first.first);
+        dst.types.push_back(item.first.second);
+        dst.flds.push_back(FldHandle(writable, item.second));
+    }
+}
+
+bool SymHeapCore::isLiveField(TFldId fld) const
+{
+    const FieldOfObj *fldData;
+    d->ents.getEntRO(&fldData, fld);
+
+    const Region *regData;
+    d->ents.getEntRO(&regData, fldData->obj);
+    return regData->isValid
+        && hasKey(regData->liveFields, fld);
+}
+
 bool SymHeapCore::findCoveringUniBlocks(
         TUniBlockMap               *pCovered,
         const TObjId                obj,
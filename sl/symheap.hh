@@ -334,6 +334,7 @@ inline bool operator<(const CVar &a, const CVar &b)
 }
 
 class FldList;
+struct FldTable;
 class SymHeap;
 
 /// SymHeapCore - the elementary representation of the state of program memory
@@ -492,6 +493,12 @@ class SymHeapCore {
         /// list of live fields (including ptrs) inside the given object
         void gatherLiveFields(FldList &dst, TObjId) const;
 
+        /// table of live fields inside the given object, sorted by offsets
+        void gatherLiveFields(FldTable &dst, TObjId) const;
+
+        /// true if the given field is (still) one of the live fields of its obj
+        bool isLiveField(TFldId) const;
+
         /// list of uninitialized and nullified uniform blocks of the given obj
         void gatherUniformBlocks(TUniBlockMap &dst, TObjId) const;
 
@@ -732,6 +739,17 @@ class PtrHandle: public FldHandle {
 /// ugly, but typedefs do not support partial declarations
 class FldList: public std::vector<FldHandle> { };
 
+/// live fields of an object in parallel arrays, sorted by (offset, type)
+struct FldTable {
+    TOffList                    offs;       ///< offsets of the fields
+    std::vector<TObjType>       types;      ///< types of the fields
+    FldList                     flds;       ///< handles of the fields
+
+    unsigned size() const {
+        return flds.size();
+    }
+};
+
 /// set of object handles
 typedef std::set<FldHandle>                             TFldSet;
 
@@ -137,6 +137,7 @@ struct SymJoinCtx {
     EJoinStatus                 status;
     bool                        forceThreeWay;
     bool                        allowThreeWay;
+    const IR::TIntSet          *thresholds;
 
     std::set<TObjId /* dst */>  protos;
 
@@ -160,7 +161,7 @@ struct SymJoinCtx {
 
     /// constructor used by joinSymHeaps()
     SymJoinCtx(SymHeap &dst_, SymHeap &sh1_, SymHeap &sh2_,
-            const bool allowThreeWay_):
+            const bool allowThreeWay_, const IR::TIntSet *thresholds_):
         dst(dst_),
         sh1(sh1_),
         sh2(sh2_),
@@ -168,7 +169,8 @@ struct SymJoinCtx {
         l2Drift(0),
         status(JS_USE_ANY),
         forceThreeWay(false),
-        allowThreeWay((1 < (SE_ALLOW_THREE_WAY_JOIN)) && allowThreeWay_)
+        allowThreeWay((1 < (SE_ALLOW_THREE_WAY_JOIN)) && allowThreeWay_),
+        thresholds(thresholds_)
     {
         initValMaps();
     }
@@ -182,7 +184,8 @@ struct SymJoinCtx {
         l2Drift(l2Drift_),
         status(JS_USE_ANY),
         forceThreeWay(false),
-        allowThreeWay(0 < (SE_ALLOW_THREE_WAY_JOIN))
+        allowThreeWay(0 < (SE_ALLOW_THREE_WAY_JOIN)),
+        thresholds(0)
     {
         initValMaps();
     }
@@ -547,6 +550,35 @@ bool handleUnknownValues(
         && writeJoinedValue(ctx, item.fldDst, vDst, v1, v2);
 }
 
+/// widen the bounds that grow from rng1 (old) to rng2 (new) up to a threshold
+void widenRangeByThresholds(
+        IR::Range               *pRng,
+        const IR::Range         &rng1,
+        const IR::Range         &rng2,
+        const IR::TIntSet       &thrs)
+{
+    IR::Range &rng = *pRng;
+
+    if (rng1.hi < rng2.hi) {
+        const IR::TInt hi = IR::thresholdAbove(thrs, rng.hi);
+#if !(SE_ALLOW_INT_RANGES & 0x2)
+        if (IR::IntMax != hi)
+#endif
+            rng.hi = hi;
+    }
+
+    if (rng2.lo < rng1.lo) {
+        const IR::TInt lo = IR::thresholdBelow(thrs, rng.lo);
+#if !(SE_ALLOW_INT_RANGES & 0x4)
+        if (IR::IntMin != lo)
+#endif
+            rng.lo = lo;
+    }
+
+    SJ_DEBUG("widenRangeByThresholds() yields [" << rng.lo << ", " << rng.hi
+            << "]");
+}
+
 bool joinCustomValues(
         SymJoinCtx              &ctx,
         const SchedItem         &item)
@@ -607,8 +639,12 @@ bool joinCustomValues(
     }
 #endif
 
-    // [experimental] widening on intervals
-    if (!isSingular(rng1) && !isSingular(rng2)) {
+    if (ctx.thresholds) {
+        // widen the growing bounds up to the nearest threshold (loop edges)
+        widenRangeByThresholds(&rng, rng1, rng2, *ctx.thresholds);
+    }
+    else if (!isSingular(rng1) && !isSingular(rng2)) {
+        // [experimental] widening on intervals
 #if (SE_ALLOW_INT_RANGES & 0x2)
         if (rng.lo == rng1.lo || rng.lo == rng2.lo)
             rng.hi = IR::IntMax;
@@ -2519,7 +2555,8 @@ bool joinSymHeaps(
         SymHeap                 *pDst,
         SymHeap                  sh1,
         SymHeap                  sh2,
-        const bool               allowThreeWay)
+        const bool               allowThreeWay,
+        const IR::TIntSet       *thresholds)
 {
     SJ_DEBUG("--> joinSymHeaps()");
     TStorRef stor = sh1.stor();
@@ -2531,7 +2568,7 @@ bool joinSymHeaps(
     *pDst = SymHeap(stor, new Trace::TransientNode("joinSymHeaps()"));
 
     // initialize symbolic join ctx
-    SymJoinCtx ctx(*pDst, sh1, sh2, allowThreeWay);
+    SymJoinCtx ctx(*pDst, sh1, sh2, allowThreeWay, thresholds);
 
     CL_BREAK_IF(!protoCheckConsistency(ctx.sh1));
     CL_BREAK_IF(!protoCheckConsistency(ctx.sh2));
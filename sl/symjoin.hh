@@ -25,6 +25,7 @@
  * @todo some dox
  */
 
+#include "intrange.hh"
 #include "join_status.hh"
 #include "symheap.hh"
 #include "symtrace.hh"              // for Trace::TIdMapper
@@ -42,13 +43,18 @@ bool joinData(
         EJoinStatus             *pStatus         = 0,
         Trace::TIdMapper        *pIdMapper       = 0);
 
-/// @todo some dox
+/**
+ * @todo some dox
+ * @param thresholds if not null, the integral ranges growing from sh1 to sh2
+ * are widened up to the nearest threshold (see SE_INT_RANGE_WIDENING)
+ */
 bool joinSymHeaps(
         EJoinStatus             *pStatus,
         SymHeap                 *dst,
         SymHeap                  sh1,
         SymHeap                  sh2,
-        bool                     allowThreeWay = true);
+        bool                     allowThreeWay = true,
+        const IR::TIntSet       *thresholds    = 0);
 
 /// enable/disable debugging of symjoin
 void debugSymJoin(bool enable);
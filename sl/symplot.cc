@@ -25,6 +25,7 @@
 #include <cl/storage.hh>
 
 #include "plotenum.hh"
+#include "plotwriter.hh"
 #include "symheap.hh"
 #include "sympred.hh"
 #include "symseg.hh"
@@ -32,10 +33,10 @@
 #include "worklist.hh"
 
 #include <cctype>
-#include <fstream>
 #include <iomanip>
 #include <map>
 #include <set>
+#include <sstream>
 #include <string>
 
 #include <boost/foreach.hpp>
@@ -1275,30 +1276,19 @@ bool plotHeapCore(
         // propagate the resulting name back to the caller
         *pName = plotName;
 
-    // create a dot file
-    std::fstream out(fileName.c_str(), std::ios::out);
-    if (!out) {
-        CL_ERROR("unable to create file '" << fileName << "'");
-        return false;
-    }
+    if (loc)
+        CL_NOTE_MSG(loc, "writing heap graph to '" << fileName << "'...");
+    else
+        CL_DEBUG("writing heap graph to '" << fileName << "'...");
+
+    // render the graph in memory, PlotWriter takes care of the file I/O
+    std::ostringstream out;
 
     // open graph
     out << "digraph " << SL_QUOTE(plotName)
         << " {\n\tlabel=<<FONT POINT-SIZE=\"18\">" << plotName
         << "</FONT>>;\n\tclusterrank=local;\n\tlabelloc=t;\n";
 
-    // check whether we can write to stream
-    if (!out.flush()) {
-        CL_ERROR("unable to write file '" << fileName << "'");
-        out.close();
-        return false;
-    }
-
-    if (loc)
-        CL_NOTE_MSG(loc, "writing heap graph to '" << fileName << "'...");
-    else
-        CL_DEBUG("writing heap graph to '" << fileName << "'...");
-
     // initialize an instance of PlotData
     PlotData plot(sh, out, objs, vals, pHighlight);
 
@@ -1307,9 +1297,9 @@ bool plotHeapCore(
 
     // close graph
     out << "}\n";
-    const bool ok = !!out;
-    out.close();
-    return ok;
+
+    std::string contents(out.str());
+    return PlotWriter::instance()->write(fileName, contents);
 }
 
 // /////////////////////////////////////////////////////////////////////////////
@@ -339,7 +339,7 @@ void SymProc::varInit(TObjId obj)
             CL_BREAK_IF("varInit() malfunction");
 
         CL_BREAK_IF(1 != dst.size());
-        SymHeap &result = const_cast<SymHeap &>(dst[/* the only result */ 0]);
+        SymHeap &result = dst.writable(/* the only result */ 0);
         sh_.swap(result);
     }
 }
@@ -71,6 +71,7 @@ void SymState::clear()
         delete sh;
 
     heaps_.clear();
+    hashes_.clear();
 }
 
 SymState::~SymState()
@@ -87,6 +88,9 @@ SymState& SymState::operator=(const SymState &ref)
     BOOST_FOREACH(const SymHeap *sh, ref.heaps_)
         heaps_.push_back(new SymHeap(*sh));
 
+    // the hashes do not change by cloning the heaps
+    hashes_ = ref.hashes_;
+
     return *this;
 }
 
@@ -105,9 +109,15 @@ void SymState::insertNew(const SymHeap &sh)
 
     // append the pointer to our container
     heaps_.push_back(dup);
+
+    // the hash will be computed on demand
+    hashes_.push_back(CanonHashUnknown);
 }
 
-bool SymState::insert(const SymHeap &sh, bool /* allowThreeWay */ )
+bool SymState::insert(
+        const SymHeap                   &sh,
+        bool                            /* allowThreeWay */,
+        const IR::TIntSet               * /* thresholds */)
 {
     if (-1 != this->lookup(sh))
         return false;
@@ -122,6 +132,19 @@ void SymState::rotateExisting(const int idxA, const int idxB)
     TList::iterator itA = heaps_.begin() + idxA;
     TList::iterator itB = heaps_.begin() + idxB;
     rotate(itA, itB, heaps_.end());
+
+    THashList::iterator hashA = hashes_.begin() + idxA;
+    THashList::iterator hashB = hashes_.begin() + idxB;
+    rotate(hashA, hashB, hashes_.end());
+}
+
+TCanonHash SymState::canonHashOf(const int nth) const
+{
+    TCanonHash &hash = hashes_.at(nth);
+    if (CanonHashUnknown == hash)
+        hash = canonHash(*heaps_[nth]);
+
+    return hash;
 }
 
 void SymState::updateTraceOf(const int idx, Trace::Node *tr, EJoinStatus status)
@@ -171,15 +194,25 @@ int SymHeapUnion::lookup(const SymHeap &lookFor) const
 {
     const int cnt = this->size();
     if (!cnt)
-        // empty state --> not found
+        // empty state --> not found, no need to compute any hash
         return -1;
 
     ++::cntLookups;
     debugPlot("lookup", 0, lookFor);
 
+#if SE_STATE_HASHING
+    // compute the hash of the given heap once per lookup
+    const TCanonHash hash = canonHash(lookFor);
+#endif
+
     for(int idx = 0; idx < cnt; ++idx) {
         const int nth = idx + 1;
 
+#if SE_STATE_HASHING
+        if (!matchCanonHashes(hash, this->canonHashOf(idx)))
+            // the heaps cannot be equal, skip the expensive check
+            continue;
+#endif
         const SymHeap &sh = this->operator[](idx);
         debugPlot("lookup", nth, sh);
 
@@ -202,7 +235,10 @@ int SymHeapUnion::lookup(const SymHeap &lookFor) const
 
 // /////////////////////////////////////////////////////////////////////////////
 // SymStateWithJoin implementation
-void SymStateWithJoin::packState(unsigned idxNew, bool allowThreeWay)
+void SymStateWithJoin::packState(
+        unsigned                        idxNew,
+        bool                            allowThreeWay,
+        const IR::TIntSet               *thresholds)
 {
     for (unsigned idxOld = 0U; idxOld < this->size();) {
         if (idxNew == idxOld) {
@@ -219,7 +255,9 @@ void SymStateWithJoin::packState(unsigned idxNew, bool allowThreeWay)
 
         EJoinStatus     status;
         SymHeap         result(stor, new Trace::TransientNode("packState()"));
-        if (!joinSymHeaps(&status, &result, shOld, shNew, allowThreeWay)) {
+        if (!joinSymHeaps(&status, &result, shOld, shNew, allowThreeWay,
+                    thresholds))
+        {
             ++idxOld;
             continue;
         }
@@ -264,7 +302,10 @@ void SymStateWithJoin::packState(unsigned idxNew, bool allowThreeWay)
 #endif
 }
 
-bool SymStateWithJoin::insert(const SymHeap &shNew, bool allowThreeWay)
+bool SymStateWithJoin::insert(
+        const SymHeap                   &shNew,
+        bool                            allowThreeWay,
+        const IR::TIntSet               *thresholds)
 {
 #if 1 < SE_JOIN_ON_LOOP_EDGES_ONLY
     if (!allowThreeWay)
@@ -287,7 +328,8 @@ bool SymStateWithJoin::insert(const SymHeap &shNew, bool allowThreeWay)
     ++::cntLookups;
     for(idx = 0; idx < cnt; ++idx) {
         const SymHeap &shOld = this->operator[](idx);
-        if (!joinSymHeaps(&status, &result, shOld, shNew, allowThreeWay))
+        if (!joinSymHeaps(&status, &result, shOld, shNew, allowThreeWay,
+                    thresholds))
             continue;
 #if SE_FORBID_HEAP_REPLACE
         if (JS_USE_SH2 == status)
@@ -333,7 +375,7 @@ bool SymStateWithJoin::insert(const SymHeap &shNew, bool allowThreeWay)
             }
 
             this->swapExisting(idx, result);
-            this->packState(idx, allowThreeWay);
+            this->packState(idx, allowThreeWay, thresholds);
             return true;
 
         case JS_THREE_WAY:
@@ -346,7 +388,7 @@ bool SymStateWithJoin::insert(const SymHeap &shNew, bool allowThreeWay)
             debugPlot("join", 2, result);
 
             this->swapExisting(idx, result);
-            this->packState(idx, allowThreeWay);
+            this->packState(idx, allowThreeWay, thresholds);
             return true;
     }
 
@@ -594,7 +636,8 @@ SymStateMarked& SymStateMap::operator[](const CodeStorage::Block *bb)
 bool SymStateMap::insert(
         const CodeStorage::Block        *dst,
         const SymHeap                   &sh,
-        const bool                      allowThreeWay)
+        const bool                      allowThreeWay,
+        const IR::TIntSet               *thresholds)
 {
     // look for the _target_ block
     Private::BlockState &ref = d->cont[dst];
@@ -611,7 +654,7 @@ bool SymStateMap::insert(
     }
     else
 #endif
-        changed = ref.state.insert(sh, allowThreeWay);
+        changed = ref.state.insert(sh, allowThreeWay, thresholds);
 
     if (ref.state.size() <= size)
         // if the size did not grow, there must have been at least join
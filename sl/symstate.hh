@@ -28,7 +28,9 @@
 #include <set>
 #include <vector>
 
+#include "intrange.hh"
 #include "join_status.hh"
+#include "symcmp.hh"
 #include "symheap.hh"
 
 namespace CodeStorage {
@@ -54,6 +56,7 @@ class SymState {
 
         virtual void swap(SymState &other) {
             heaps_.swap(other.heaps_);
+            hashes_.swap(other.hashes_);
         }
 
         /**
@@ -62,8 +65,15 @@ class SymState {
          */
         virtual int lookup(const SymHeap &heap) const = 0;
 
-        /// insert given SymHeap object into the state
-        virtual bool insert(const SymHeap &sh, bool allowThreeWay = true);
+        /**
+         * insert given SymHeap object into the state
+         * @param thresholds thresholds for widening of integral ranges by join
+         * (see SE_INT_RANGE_WIDENING in config.h), no widening if null
+         */
+        virtual bool insert(
+                const SymHeap                  &sh,
+                bool                            allowThreeWay = true,
+                const IR::TIntSet              *thresholds    = 0);
 
         /// return count of object stored in the container
         size_t size()          const { return heaps_.size();  }
@@ -73,6 +83,23 @@ class SymState {
             return *heaps_[nth];
         }
 
+        /**
+         * return nth SymHeap object for writing, 0 <= nth < size()
+         * @note the heaps are owned by the container, the cached canonHash()
+         * of the nth heap is dropped
+         */
+        SymHeap& writable(int nth) const {
+            hashes_.at(nth) = CanonHashUnknown;
+            return *heaps_[nth];
+        }
+
+        /**
+         * return canonHash() of the nth SymHeap object, computed on demand
+         * @note the cached value is dropped each time the heap can be changed,
+         * i.e. by writable() and by the non-const iterators
+         */
+        TCanonHash canonHashOf(int nth) const;
+
         /// return STL-like iterator to go through the container
         const_iterator begin() const { return heaps_.begin(); }
 
@@ -80,10 +107,17 @@ class SymState {
         const_iterator end()   const { return heaps_.end();   }
 
         /// @copydoc begin() const
-        iterator begin()             { return heaps_.begin(); }
+        iterator begin() {
+            // the heaps can be changed via the iterator
+            this->dropHashes();
+            return heaps_.begin();
+        }
 
         /// @copydoc begin() const
-        iterator end()               { return heaps_.end();   }
+        iterator end() {
+            this->dropHashes();
+            return heaps_.end();
+        }
 
     protected:
         /// insert @b new SymHeap that @ must be guaranteed to be not yet in
@@ -92,22 +126,32 @@ class SymState {
         virtual void eraseExisting(int nth) {
             delete heaps_[nth];
             heaps_.erase(heaps_.begin() + nth);
+            hashes_.erase(hashes_.begin() + nth);
         }
 
         virtual void swapExisting(int nth, SymHeap &sh) {
             SymHeap &existing = *heaps_.at(nth);
             existing.swap(sh);
+            hashes_[nth] = CanonHashUnknown;
         }
 
         virtual void rotateExisting(int idxA, int idxB);
 
         void updateTraceOf(int idx, Trace::Node *tr, EJoinStatus status);
 
+        /// drop all the cached hashes
+        void dropHashes() {
+            hashes_.assign(hashes_.size(), CanonHashUnknown);
+        }
+
         /// lookup/insert optimization in SymCallCache implementation
         friend class PerFncCache;
 
     private:
-        TList heaps_;
+        typedef std::vector<TCanonHash> THashList;
+
+        TList               heaps_;
+        mutable THashList   hashes_;
 };
 
 class SymHeapList: public SymState {
@@ -148,10 +192,16 @@ class SymHeapUnion: public SymState {
 
 class SymStateWithJoin: public SymHeapUnion {
     public:
-        virtual bool insert(const SymHeap &sh, bool allowThreeWay = true);
+        virtual bool insert(
+                const SymHeap                  &sh,
+                bool                            allowThreeWay = true,
+                const IR::TIntSet              *thresholds    = 0);
 
     private:
-        void packState(unsigned idx, bool allowThreeWay);
+        void packState(
+                unsigned                        idx,
+                bool                            allowThreeWay,
+                const IR::TIntSet              *thresholds);
 };
 
 /**
@@ -273,10 +323,12 @@ class SymStateMap: public IPendingCountProvider {
          * @param dst @b destination basic block (where the insertion occurs)
          * @param sh an instance of symbolic heap that should be inserted
          * @param allowThreeWay if true, three-way join is allowed
+         * @param thresholds thresholds for widening of integral ranges by join
          */
         bool insert(const CodeStorage::Block       *dst,
                     const SymHeap                  &sh,
-                    bool                            allowThreeWay = true);
+                    bool                            allowThreeWay = true,
+                    const IR::TIntSet              *thresholds    = 0);
 
         /// true if the specified block has ever joined/entailed any given state
         bool anyReuseHappened(const CodeStorage::Block *) const;
@@ -24,11 +24,11 @@
 #include <cl/storage.hh>
 
 #include "plotenum.hh"
+#include "plotwriter.hh"
 #include "symstate.hh"
 #include "worklist.hh"
 
 #include <algorithm>
-#include <fstream>
 #include <map>
 #include <set>
 #include <sstream>
@@ -543,34 +543,24 @@ bool plotTrace(const std::string &name, TWorkList &wl, std::string *pName = 0)
         // propagate the resulting name back to the caller
         *pName = plotName;
 
-    // create a dot file
-    std::fstream out(fileName.c_str(), std::ios::out);
-    if (!out) {
-        CL_ERROR("unable to create file '" << fileName << "'");
-        return false;
-    }
+    // render the graph in memory, PlotWriter takes care of the file I/O
+    std::ostringstream out;
 
     // open graph
     out << "digraph " << SL_QUOTE(plotName)
         << " {\n\tlabel=<<FONT POINT-SIZE=\"18\">" << plotName
         << "</FONT>>;\n\tlabelloc=t;\n";
 
-    // check whether we can write to stream
-    if (!out.flush()) {
-        CL_ERROR("unable to write file '" << fileName << "'");
-        out.close();
-        return false;
-    }
-
     // do our stuff
     TracePlotter tplot(out, wl);
     plotTraceCore(tplot);
 
     // close graph
     out << "}\n";
-    out.close();
-    CL_NOTE("trace graph dumped to '" << fileName << "'");
-    return !!out;
+
+    // the note is printed once the file has been written (maybe in background)
+    std::string contents(out.str());
+    return PlotWriter::instance()->write(fileName, contents, "trace graph");
 }
 
 bool plotTrace(Node *endPoint, const std::string &name, std::string *pName)
@@ -302,32 +302,64 @@ bool /* complete */ traverseLiveFieldsGeneric(
         const TObjId                objs[N],
         TVisitor                    &visitor)
 {
-    // collect all live objects from everywhere
-    typedef std::pair<TOffset, TObjType> TItem;
-    std::set<TItem> all;
+    // collect all live objects from everywhere, sorted by (offset, type)
+    //
+    // The visitors may write to the heaps (e.g. joinFields() writes to the
+    // destination object, which may even be in the same heap when joining
+    // data).  The (offset, type) pairs to be visited are taken as they were
+    // before the traversal, but a field handle from the table is used only
+    // if the field is still live once its turn comes.  Otherwise the field is
+    // looked up again, which is what we would do without the table.
+    FldTable tabs[N];
     for (unsigned i = 0; i < N; ++i) {
-        SymHeap &sh = *heaps[i];
         const TObjId obj = objs[i];
-        if (OBJ_INVALID == obj)
-            continue;
+        if (OBJ_INVALID != obj)
+            heaps[i]->gatherLiveFields(tabs[i], obj);
+    }
+
+    // go through all live objects by merging the sorted tables
+    typedef std::pair<TOffset, TObjType> TItem;
+    unsigned pos[N] = { 0 };
+    for (;;) {
+        // look for the least (offset, type) pair not yet traversed
+        bool found = false;
+        TItem least;
+        for (unsigned i = 0; i < N; ++i) {
+            const FldTable &tab = tabs[i];
+            if (tab.size() <= pos[i])
+                continue;
 
-        FldList fields;
-        sh.gatherLiveFields(fields, obj);
-        BOOST_FOREACH(const FldHandle &fld, fields) {
-            const TOffset off = fld.offset();
-            const TObjType clt = fld.type();
-            const TItem item(off, clt);
-            all.insert(item);
+            const TItem item(tab.offs[pos[i]], tab.types[pos[i]]);
+            if (found && !(item < least))
+                continue;
+
+            least = item;
+            found = true;
         }
-    }
 
-    // go through all live objects
-    BOOST_FOREACH(const TItem &item, all) {
-        const TOffset  off = item.first;
-        const TObjType clt = item.second;
+        if (!found)
+            // all tables traversed
+            break;
+
+        const TOffset  off = least.first;
+        const TObjType clt = least.second;
 
         FldHandle fields[N];
         for (unsigned i = 0; i < N; ++i) {
+            const FldTable &tab = tabs[i];
+            unsigned &idx = pos[i];
+            if (idx < tab.size()
+                    && off == tab.offs[idx]
+                    && clt == tab.types[idx])
+            {
+                const FldHandle &fld = tab.flds[idx++];
+                if (heaps[i]->isLiveField(fld.fieldId())) {
+                    // live field found in this heap, no need to look it up
+                    fields[i] = fld;
+                    continue;
+                }
+            }
+
             SymHeap &sh = *heaps[i];
             const TObjId obj = objs[i];
             fields[i] = FldHandle(sh, obj, clt, off);